@@ -31,6 +31,7 @@ using namespace OpenSim;
 using namespace std;
 
 void testTwoMusclesOnBlock();
+void testReuseActuatorEvaluations();
 
 int main() {
 
@@ -40,6 +41,11 @@ int main() {
     catch (const std::exception& e)
         {  cout << e.what() <<endl; failures.push_back("testTwoMusclesOnBlock"); }
 
+    try {testReuseActuatorEvaluations();}
+    catch (const std::exception& e)
+        {  cout << e.what() <<endl;
+           failures.push_back("testReuseActuatorEvaluations"); }
+
     // redo with the Millard2012EquilibriumMuscle 
     Object::renameType("Thelen2003Muscle", "Millard2012EquilibriumMuscle");
 
@@ -143,3 +149,32 @@ void testTwoMusclesOnBlock() {
     cout << "\n" << base << " passed\n" << endl;
 }
 
+void testReuseActuatorEvaluations() {
+    cout<<"\n******************************************************************" << endl;
+    cout << "*                  testReuseActuatorEvaluations                  *" << endl;
+    cout << "******************************************************************\n" << endl;
+
+    // Reusing integrations of the actuator system must not change the
+    // controls, so the states match with and without reuse.
+    CMCTool cmcReuse("twoMusclesOnBlock_Setup_CMC.xml");
+    ASSERT(cmcReuse.getReuseActuatorEvaluations());
+    cmcReuse.setResultsDir("twoMusclesOnBlock_ResultsCMC_reuse");
+    cmcReuse.run();
+
+    CMCTool cmcNoReuse("twoMusclesOnBlock_Setup_CMC.xml");
+    cmcNoReuse.setReuseActuatorEvaluations(false);
+    cmcNoReuse.setResultsDir("twoMusclesOnBlock_ResultsCMC_noReuse");
+    cmcNoReuse.run();
+
+    const string states = "/twoMusclesOnBlock_tugOfWar_states.sto";
+    Storage reuse_result("twoMusclesOnBlock_ResultsCMC_reuse" + states);
+    Storage noReuse_result("twoMusclesOnBlock_ResultsCMC_noReuse" + states);
+    ASSERT(reuse_result.getSize() == noReuse_result.getSize());
+
+    CHECK_STORAGE_AGAINST_STANDARD(reuse_result, noReuse_result,
+        std::vector<double>(6, 1e-6), __FILE__, __LINE__,
+        "testReuseActuatorEvaluations failed");
+
+    cout << "\ntestReuseActuatorEvaluations passed\n" << endl;
+}
+
@@ -31,6 +31,7 @@
 #include <OpenSim/Simulation/Model/Model.h>
 #include <OpenSim/Simulation/OrientationsReference.h>
 #include <OpenSim/Simulation/InverseKinematicsSolver.h>
+#include <OpenSim/Simulation/OpenSense/StreamingInverseKinematics.h>
 #include <OpenSim/Tools/InverseKinematicsTool.h>
 #include <OpenSim/Tools/IKTaskSet.h>
 #include <OpenSim/Auxiliary/auxiliaryTestFunctions.h>
@@ -41,6 +42,7 @@ using namespace std;
 
 void testInverseKinematicsSolverWithOrientations();
 void testInverseKinematicsSolverWithEulerAnglesFromFile();
+void testStreamingInverseKinematics();
 TimeSeriesTable_<SimTK::Rotation> convertMotionFileToRotations(
         Model& model, const std::string& motionFile);
 
@@ -157,7 +159,68 @@ int main() {
     catch (const std::exception& e) { 
         cout << e.what() << endl; 
     }
+
+    testStreamingInverseKinematics();
 }
+
+void testStreamingInverseKinematics() {
+    Model model("subject01_simbody.osim");
+    TimeSeriesTable_<SimTK::Rotation> orientationsData =
+            convertMotionFileToRotations(model, "std_subject01_walk1_ik.mot");
+    TimeSeriesTable_<SimTK::Rotation> initialOrientations{orientationsData};
+    initialOrientations.trim(0.4, 0.41);
+    orientationsData.trimFrom(0.41);
+
+    StreamingInverseKinematics streamingIK(model, initialOrientations);
+    // Solve every frame so the results can be checked against offline IK.
+    streamingIK.setSkipStaleFrames(false);
+
+    TimeSeriesTable report;
+    report.setColumnLabels(streamingIK.getCoordinateNames());
+    streamingIK.setFrameCallback(
+            [&report](double time, const SimTK::RowVector& values) {
+                report.appendRow(time, values);
+            });
+    const auto stats = streamingIK.replay(orientationsData);
+
+    const size_t numFrames = orientationsData.getNumRows();
+    ASSERT(stats.numFramesSolved == numFrames);
+    ASSERT(stats.numFramesSkipped == 0);
+    ASSERT(report.getNumRows() == numFrames);
+    ASSERT(streamingIK.updOutputQueue().size() == numFrames);
+    size_t numBinned = 0;
+    for (auto count : stats.latencyHistogram) numBinned += count;
+    ASSERT(numBinned == numFrames);
+    ASSERT(stats.maxLatency >= stats.meanLatency);
+
+    // Streamed frames must match the offline IK solution.
+    const TimeSeriesTable standard("std_subject01_walk1_ik.mot");
+    const auto& stdLabels = standard.getColumnLabels();
+    const auto& reportLabels = report.getColumnLabels();
+    for (size_t i = 0; i < reportLabels.size(); ++i) {
+        if (reportLabels[i].find("pelvis_t") == 0) continue;
+        auto found = std::find(
+                stdLabels.begin(), stdLabels.end(), reportLabels[i]);
+        if (found == stdLabels.end()) continue;
+        const size_t stdIndex = std::distance(stdLabels.begin(), found);
+        double sumSqr = 0;
+        for (size_t r = 0; r < numFrames; ++r) {
+            const double time = report.getIndependentColumn()[r];
+            const double error =
+                    SimTK_RTD * report.getRowAtIndex(r)[int(i)] -
+                    standard.getNearestRow(time)[int(stdIndex)];
+            sumSqr += error * error;
+        }
+        const double rmse = sqrt(sumSqr / numFrames);
+        cout << "Streamed column '" << reportLabels[i] << "' has RMSE = "
+             << rmse << " degrees" << endl;
+        SimTK_ASSERT1_ALWAYS(rmse < 0.1,
+                "Streamed column '%s' FAILED to meet accuracy of 0.1 degree "
+                "RMS.",
+                reportLabels[i].c_str());
+    }
+}
+
 TimeSeriesTable_<SimTK::Rotation> convertMotionFileToRotations(
     Model& model,
     const std::string& motionFile)
@@ -345,8 +408,5 @@ void testInverseKinematicsSolverWithEulerAnglesFromFile()
 }
 void producer(std::shared_ptr<BufferedOrientationsReference> oRef,
         TimeSeriesTable_<SimTK::Rotation>& dataSource) {
-    auto times = dataSource.getIndependentColumn();
-    for (auto t : times) { 
-        oRef->putValues(t, dataSource.getNearestRow(t));
-    }
+    oRef->replayValues(dataSource);
 }
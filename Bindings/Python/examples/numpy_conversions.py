@@ -56,3 +56,17 @@ print(osimMatrix)
 npArray4 = osimMatrix.to_numpy()
 print(npArray4)
 
+
+# to_numpy() copies the data. For large data, you can instead obtain a NumPy
+# array that shares memory with the OpenSim object. Pass writable=True to
+# modify the OpenSim object through the array.
+npView = osimMatrix.to_numpy_view()
+print(npView)
+
+# Create a TimeSeriesTable from NumPy arrays, and view its data as NumPy
+# arrays without copying.
+time = np.array([0.0, 0.1, 0.2])
+table = osim.TimeSeriesTable.createFromMat(time, npArray2D, ['a', 'b'])
+print(table)
+print(table.getIndependentColumnNumPyView())
+print(table.getMatrixNumPyView())
@@ -0,0 +1,27 @@
+// Zero-copy NumPy views
+// =====================
+// to_numpy() copies the data of a SimTK or OpenSim object into a new NumPy
+// array. For large tables (e.g., marker or EMG data with many rows), that
+// copy dominates the cost of handing data to NumPy. The helper below instead
+// wraps the object's own (contiguous) memory in a NumPy array. The array
+// holds a reference to the Python proxy of the object that owns the memory,
+// so the memory outlives the array as long as that proxy owns its C++ object.
+// A view is invalidated by any operation that reallocates the object's
+// memory (e.g., resizing a Matrix or appending a row to a table).
+// This file must be included after numpy.i.
+%{
+static PyObject* opensim_numpy_view(PyObject* owner, int nd, npy_intp* dims,
+        npy_intp* strides, const double* data, bool writable) {
+    int flags = NPY_ARRAY_ALIGNED;
+    if (writable) flags |= NPY_ARRAY_WRITEABLE;
+    PyObject* array = PyArray_New(&PyArray_Type, nd, dims, NPY_DOUBLE,
+            strides, const_cast<double*>(data), 0, flags, NULL);
+    if (!array) return NULL;
+    Py_INCREF(owner);
+    if (PyArray_SetBaseObject((PyArrayObject*)array, owner) < 0) {
+        Py_DECREF(array);
+        return NULL;
+    }
+    return array;
+}
+%}
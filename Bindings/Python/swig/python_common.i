@@ -167,7 +167,22 @@ note: ## is a "glue" operator: `a ## b` --> `ab`.
 // ====================
 //%include <OpenSim/Common/LoadOpenSimLibrary.h>
 
-// %include "numpy.i"
+// Add support for converting between NumPy and C arrays (for DataTable and
+// TimeSeriesTable).
+%include "numpy.i"
+%init %{
+    import_array();
+%}
+%include "numpy_views.i"
+
+// The Python version of TimeSeriesTable.createFromMat() takes the time column
+// and the dependent data as NumPy arrays.
+%apply (int DIM1, double* IN_ARRAY1) {
+    (int ntime, double* time)
+};
+%apply (int DIM1, int DIM2, double* IN_ARRAY2) {
+    (int nrow, int ncol, double* data)
+};
 
 // Pythonic operators
 // ==================
@@ -289,6 +304,54 @@ note: ## is a "glue" operator: `a ## b` --> `ab`.
     }
 }
 
+%extend OpenSim::DataTable_<double, double> {
+    PyObject* _getMatrixNumPyView(PyObject* owner, bool writable) {
+        const auto& matrix = $self->getMatrix();
+        npy_intp dims[2] = {matrix.nrow(), matrix.ncol()};
+        // SimTK stores matrices by column, so the view is Fortran-ordered.
+        npy_intp strides[2] = {(npy_intp)sizeof(double),
+                               (npy_intp)(sizeof(double) * matrix.nrow())};
+        return opensim_numpy_view(owner, 2, dims, strides,
+                writable ? $self->updMatrix().updContiguousScalarData()
+                         : matrix.getContiguousScalarData(),
+                writable);
+    }
+    PyObject* _getIndependentColumnNumPyView(PyObject* owner) {
+        const auto& column = $self->getIndependentColumn();
+        npy_intp dims[1] = {(npy_intp)column.size()};
+        return opensim_numpy_view(owner, 1, dims, NULL, column.data(), false);
+    }
+%pythoncode %{
+    def getMatrixNumPyView(self, writable=False):
+        """Return the dependent columns as a 2D NumPy array (rows x columns)
+        that shares memory with this table, without copying. If writable is
+        True, writing to the array modifies this table. The array is
+        invalidated by any operation that adds or removes rows or
+        columns."""
+        return self._getMatrixNumPyView(self, writable)
+    def getIndependentColumnNumPyView(self):
+        """Return the independent column (e.g., time) as a read-only NumPy
+        array that shares memory with this table, without copying. The array
+        is invalidated by any operation that adds or removes rows."""
+        return self._getIndependentColumnNumPyView(self)
+%}
+}
+
+// Ideally we would add a constructor taking NumPy arrays, but this conflicts
+// with existing constructors. So we resort to a static function.
+%extend OpenSim::TimeSeriesTable_<double> {
+    static TimeSeriesTable_<double> createFromMat(int ntime, double* time,
+            int nrow, int ncol, double* data,
+            const std::vector<std::string>& labels) {
+        OPENSIM_THROW_IF(ntime != nrow, OpenSim::Exception,
+                "Length of time column does not match number of rows of "
+                "data.");
+        // NumPy provides the data by row.
+        return TimeSeriesTable_<double>(std::vector<double>(time, time + ntime),
+                SimTK::Matrix(nrow, ncol, data), labels);
+    }
+}
+
 // Include all the OpenSim code.
 // =============================
 %include <Bindings/preliminaries.i>
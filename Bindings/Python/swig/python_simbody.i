@@ -21,6 +21,7 @@ using namespace SimTK;
 %init %{
     import_array();
 %}
+%include "numpy_views.i"
 
 %include "python_preliminaries.i"
 
@@ -200,9 +201,23 @@ namespace SimTK {
                              $self->size());
         std::copy_n($self->getContiguousScalarData(), n, numpyout);
     }
+    PyObject* _to_numpy_view(PyObject* owner, bool writable) {
+        SimTK_ASSERT_ALWAYS($self->hasContiguousData(),
+                "Vector data is not contiguous; use to_numpy() instead.");
+        npy_intp dims[1] = {$self->size()};
+        return opensim_numpy_view(owner, 1, dims, NULL,
+                writable ? $self->updContiguousScalarData()
+                         : $self->getContiguousScalarData(),
+                writable);
+    }
 %pythoncode %{
     def to_numpy(self):
         return self._to_numpy(self.size())
+    def to_numpy_view(self, writable=False):
+        """Return a NumPy array that shares memory with this Vector, without
+        copying. If writable is True, writing to the array modifies this
+        Vector. The array is invalidated if this Vector is resized."""
+        return self._to_numpy_view(self, writable)
 %};
 }
 
@@ -229,9 +244,24 @@ namespace SimTK {
                              $self->size());
         std::copy_n($self->getContiguousScalarData(), n, numpyout);
     }
+    PyObject* _to_numpy_view(PyObject* owner, bool writable) {
+        SimTK_ASSERT_ALWAYS($self->hasContiguousData(),
+                "RowVector data is not contiguous; use to_numpy() instead.");
+        npy_intp dims[1] = {$self->size()};
+        return opensim_numpy_view(owner, 1, dims, NULL,
+                writable ? $self->updContiguousScalarData()
+                         : $self->getContiguousScalarData(),
+                writable);
+    }
 %pythoncode %{
     def to_numpy(self):
         return self._to_numpy(self.size())
+    def to_numpy_view(self, writable=False):
+        """Return a NumPy array that shares memory with this RowVector,
+        without copying. If writable is True, writing to the array modifies
+        this RowVector. The array is invalidated if this RowVector is
+        resized."""
+        return self._to_numpy_view(self, writable)
 %};
 }
 
@@ -249,12 +279,29 @@ namespace SimTK {
                 "Number of columns must be %i.", $self->ncol());
         std::copy_n($self->getContiguousScalarData(), nrow * ncol, numpyout);
     }
+    PyObject* _to_numpy_view(PyObject* owner, bool writable) {
+        SimTK_ASSERT_ALWAYS($self->hasContiguousData(),
+                "Matrix data is not contiguous; use to_numpy() instead.");
+        // SimTK stores matrices by column, so the view is Fortran-ordered.
+        npy_intp dims[2] = {$self->nrow(), $self->ncol()};
+        npy_intp strides[2] = {(npy_intp)sizeof(double),
+                               (npy_intp)(sizeof(double) * $self->nrow())};
+        return opensim_numpy_view(owner, 2, dims, strides,
+                writable ? $self->updContiguousScalarData()
+                         : $self->getContiguousScalarData(),
+                writable);
+    }
 %pythoncode %{
     def to_numpy(self):
         import numpy as np
         mat = np.empty([self.nrow(), self.ncol()])
         self._to_numpy(mat)
         return mat
+    def to_numpy_view(self, writable=False):
+        """Return a NumPy array that shares memory with this Matrix, without
+        copying. If writable is True, writing to the array modifies this
+        Matrix. The array is invalidated if this Matrix is resized."""
+        return self._to_numpy_view(self, writable)
 %};
 }
 
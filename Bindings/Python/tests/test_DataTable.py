@@ -2,6 +2,7 @@
 Test DataTable interface.
 """
 import os, unittest
+import numpy as np
 import opensim as osim
 
 class TestDataTable(unittest.TestCase):
@@ -565,3 +566,37 @@ class TestDataTable(unittest.TestCase):
                                                  '2_x', '2_y', '2_z')
         print(tableDouble)
         
+
+    def test_TimeSeriesTable_numpy(self):
+        time = np.array([0.0, 0.1, 0.2, 0.3])
+        data = np.array([[1, 2], [3, 4], [5, 6], [7, 8]])
+        table = osim.TimeSeriesTable.createFromMat(time, data, ['a', 'b'])
+        assert table.getNumRows() == 4
+        assert table.getNumColumns() == 2
+        assert table.getColumnLabels() == ('a', 'b')
+        assert table.getRowAtIndex(1)[0] == 3
+        assert table.getRowAtIndex(1)[1] == 4
+
+        # Lengths of time and data do not match.
+        with self.assertRaises(RuntimeError):
+            osim.TimeSeriesTable.createFromMat(time[:3], data, ['a', 'b'])
+        # Time must be increasing.
+        with self.assertRaises(RuntimeError):
+            osim.TimeSeriesTable.createFromMat(time[::-1], data, ['a', 'b'])
+
+        times = table.getIndependentColumnNumPyView()
+        assert (times == time).all()
+        assert not times.flags.writeable
+
+        matrix = table.getMatrixNumPyView()
+        assert matrix.shape == (4, 2)
+        assert (matrix == data).all()
+        assert not matrix.flags.writeable
+        matrix = table.getMatrixNumPyView(writable=True)
+        matrix[2, 1] = 10
+        assert table.getRowAtIndex(2)[1] == 10
+
+        # The views keep the table alive.
+        matrix = osim.TimeSeriesTable.createFromMat(
+            time, data, ['a', 'b']).getMatrixNumPyView()
+        assert (matrix == data).all()
@@ -133,6 +133,38 @@ class TestSimbody(unittest.TestCase):
         with self.assertRaises(TypeError):
             osim.Matrix.createFromMat(npm)
 
+    def test_numpy_views(self):
+        v = osim.Vector.createFromMat(np.array([5, 3, 6]))
+        view = v.to_numpy_view()
+        assert (view == np.array([5, 3, 6])).all()
+        assert not view.flags.writeable
+        with self.assertRaises(ValueError):
+            view[0] = 1
+        # The view shares memory with the Vector.
+        v[0] = 8
+        assert view[0] == 8
+        view = v.to_numpy_view(writable=True)
+        view[1] = 2
+        assert v[1] == 2
+
+        rv = osim.RowVector.createFromMat(np.array([5, 3, 6]))
+        view = rv.to_numpy_view(True)
+        view[2] = 4
+        assert rv[2] == 4
+
+        npm = np.array([[5, 3], [3, 6], [8, 1]])
+        m = osim.Matrix.createFromMat(npm)
+        view = m.to_numpy_view()
+        assert view.shape == (3, 2)
+        assert (view == npm).all()
+        view = m.to_numpy_view(writable=True)
+        view[2, 0] = 7
+        assert m.getElt(2, 0) == 7
+
+        # The view keeps the Matrix alive.
+        view = osim.Matrix.createFromMat(npm).to_numpy_view()
+        assert (view == npm).all()
+
     def test_vector_operators(self):
         v = osim.Vector(5, 3)
 
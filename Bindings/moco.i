@@ -118,6 +118,7 @@ EXPOSE_BOUNDS_CONSTRUCTORS_HELPER(MocoFinalBounds);
         std::initializer_list<double>);
 
 %include <OpenSim/Moco/MocoTrajectory.h>
+%include <OpenSim/Moco/MocoTrajectoryBinary.h>
 
 %include <OpenSim/Moco/MocoSolver.h>
 %include <OpenSim/Moco/MocoDirectCollocationSolver.h>
@@ -130,6 +131,9 @@ namespace OpenSim {
 %include <OpenSim/Moco/MocoCasADiSolver/MocoCasADiSolver.h>
 %include <OpenSim/Moco/MocoStudy.h>
 %include <OpenSim/Moco/MocoStudyFactory.h>
+%include <OpenSim/Moco/MocoSolutionCache.h>
+%ignore OpenSim::MocoStudyBatch::addStudies;
+%include <OpenSim/Moco/MocoStudyBatch.h>
 
 %include <OpenSim/Moco/MocoTool.h>
 %include <OpenSim/Moco/MocoInverse.h>
@@ -29,6 +29,10 @@
 #include <OpenSim/Simulation/Model/Model.h>
 #include "OpenSim/Common/STOFileAdapter.h"
 
+#include <algorithm>
+#include <map>
+#include <mutex>
+
 using namespace OpenSim;
 
 const std::string DeGrooteFregly2016Muscle::STATE_ACTIVATION_NAME("activation");
@@ -68,6 +72,678 @@ constexpr int DeGrooteFregly2016Muscle::
 constexpr int
         DeGrooteFregly2016Muscle::m_mdi_partialTendonForcePartialFiberLength;
 
+namespace OpenSim {
+
+/// Computes the length, fiber velocity, and dynamics info of a group of
+/// DeGrooteFregly2016Muscles with the same tendon compliance settings. The
+/// muscle parameters are gathered into a structure of arrays, and each
+/// quantity is computed for all muscles in a loop over contiguous arrays with
+/// no function calls other than those to math functions, which allows the
+/// compiler to vectorize the loops.
+///
+/// The parameters and the arrays for intermediate results are allocated when
+/// the batch is created. The parameters of a muscle are read from its
+/// properties again whenever the muscle is out of date with its properties
+/// (Object::isObjectUpToDateWithProperties()), so edits to the properties
+/// (e.g., by a MocoParameter) are seen without reconnecting the model, just as
+/// when each muscle is evaluated on its own.
+///
+/// The formulas (and the order in which they are evaluated) are the same as in
+/// the DeGrooteFregly2016Muscle::calc*InfoHelper() functions, so the results
+/// match those computed by each muscle on its own, up to differences in
+/// rounding if the compiler vectorizes or contracts the arithmetic.
+///
+/// When a muscle requests its info for a given state, the info for each other
+/// muscle in the batch that applies force and does not yet have valid info
+/// in its cache is computed as well, and stored in that muscle's cache. The
+/// preallocated arrays are guarded by a mutex, so the batch can be used from
+/// multiple threads at once; the evaluations are then serialized. The mutex
+/// is recursive since computing the velocity info may compute the length
+/// info, and computing the dynamics info may compute both; each of these
+/// uses its own arrays.
+class DeGrooteFregly2016MuscleBatch {
+public:
+    using DGF = DeGrooteFregly2016Muscle;
+
+    DeGrooteFregly2016MuscleBatch(std::vector<const DGF*> muscles,
+            bool ignoreTendonCompliance, bool isTendonDynamicsExplicit);
+
+    void calcMuscleLengthInfo(const SimTK::State& s, const DGF& requester,
+            Muscle::MuscleLengthInfo& requesterInfo) const;
+    void calcFiberVelocityInfo(const SimTK::State& s, const DGF& requester,
+            Muscle::FiberVelocityInfo& requesterInfo) const;
+    void calcMuscleDynamicsInfo(const SimTK::State& s, const DGF& requester,
+            Muscle::MuscleDynamicsInfo& requesterInfo) const;
+
+private:
+    /// The parameters of each muscle in the batch, as a structure of arrays.
+    struct Parameters {
+        explicit Parameters(size_t numMuscles);
+        /// Copy the parameters of the muscle at the given index.
+        void update(size_t index, const DGF& muscle);
+        std::vector<double> maxIsometricForce;
+        std::vector<double> optimalFiberLength;
+        std::vector<double> tendonSlackLength;
+        std::vector<double> fiberWidth;
+        std::vector<double> squareFiberWidth;
+        std::vector<double> maxContractionVelocityInMetersPerSecond;
+        std::vector<double> kT;
+        std::vector<double> activeForceWidthScale;
+        std::vector<double> fiberDamping;
+        std::vector<char> ignorePassiveFiberForce;
+        std::vector<double> passiveFiberStrainAtOneNormForce;
+        // The offset and denominator of the passive force-length curve (see
+        // DeGrooteFregly2016Muscle::calcPassiveForceMultiplier()).
+        std::vector<double> passiveForceOffset;
+        std::vector<double> passiveForceDenom;
+    };
+
+    /// Which muscles to compute info for, and the intermediate results, for
+    /// one of the calc*Info() functions.
+    struct Workspace {
+        Workspace(size_t numMuscles, size_t numArrays)
+                : evaluate(numMuscles), values(numArrays * numMuscles) {}
+        /// Zero the intermediate results and return the first array.
+        double* resetValues() {
+            std::fill(values.begin(), values.end(), 0.0);
+            return values.data();
+        }
+        std::vector<char> evaluate;
+        std::vector<double> values;
+    };
+
+    /// Copy the parameters of the muscles that are out of date with their
+    /// properties.
+    void updateParameters() const;
+
+    /// Set `evaluate` to which muscles to compute info for: the requester,
+    /// and the other muscles that apply force and whose info in the given
+    /// cache variable is not valid.
+    template <typename T>
+    void findMusclesToEvaluate(const SimTK::State& s, const DGF& requester,
+            Component::CacheVariable<T> Muscle::*cv,
+            std::vector<char>& evaluate) const;
+
+    std::vector<const DGF*> m_muscles;
+    bool m_ignoreTendonCompliance;
+    bool m_isTendonDynamicsExplicit;
+    mutable std::recursive_mutex m_mutex;
+    mutable Parameters m_params;
+    mutable Workspace m_lengthWorkspace;
+    mutable Workspace m_velocityWorkspace;
+    mutable Workspace m_dynamicsWorkspace;
+};
+
+DeGrooteFregly2016MuscleBatch::DeGrooteFregly2016MuscleBatch(
+        std::vector<const DGF*> muscles, bool ignoreTendonCompliance,
+        bool isTendonDynamicsExplicit)
+        : m_muscles(std::move(muscles)),
+          m_ignoreTendonCompliance(ignoreTendonCompliance),
+          m_isTendonDynamicsExplicit(isTendonDynamicsExplicit),
+          m_params(m_muscles.size()),
+          m_lengthWorkspace(m_muscles.size(), 12),
+          m_velocityWorkspace(m_muscles.size(), 17),
+          m_dynamicsWorkspace(m_muscles.size(), 32) {
+    for (size_t i = 0; i < m_muscles.size(); ++i) {
+        m_params.update(i, *m_muscles[i]);
+    }
+}
+
+DeGrooteFregly2016MuscleBatch::Parameters::Parameters(size_t n) {
+    maxIsometricForce.resize(n);
+    optimalFiberLength.resize(n);
+    tendonSlackLength.resize(n);
+    fiberWidth.resize(n);
+    squareFiberWidth.resize(n);
+    maxContractionVelocityInMetersPerSecond.resize(n);
+    kT.resize(n);
+    activeForceWidthScale.resize(n);
+    fiberDamping.resize(n);
+    ignorePassiveFiberForce.resize(n);
+    passiveFiberStrainAtOneNormForce.resize(n);
+    passiveForceOffset.resize(n);
+    passiveForceDenom.resize(n);
+}
+
+void DeGrooteFregly2016MuscleBatch::Parameters::update(
+        size_t i, const DGF& muscle) {
+    maxIsometricForce[i] = muscle.get_max_isometric_force();
+    optimalFiberLength[i] = muscle.get_optimal_fiber_length();
+    tendonSlackLength[i] = muscle.get_tendon_slack_length();
+    fiberWidth[i] = muscle.m_fiberWidth;
+    squareFiberWidth[i] = muscle.m_squareFiberWidth;
+    maxContractionVelocityInMetersPerSecond[i] =
+            muscle.m_maxContractionVelocityInMetersPerSecond;
+    kT[i] = muscle.m_kT;
+    activeForceWidthScale[i] = muscle.get_active_force_width_scale();
+    fiberDamping[i] = muscle.get_fiber_damping();
+    ignorePassiveFiberForce[i] = muscle.get_ignore_passive_fiber_force();
+    const double e0 = muscle.get_passive_fiber_strain_at_one_norm_force();
+    passiveFiberStrainAtOneNormForce[i] = e0;
+    passiveForceOffset[i] =
+            exp(DGF::kPE * (DGF::m_minNormFiberLength - 1.0) / e0);
+    passiveForceDenom[i] = exp(DGF::kPE) - passiveForceOffset[i];
+}
+
+void DeGrooteFregly2016MuscleBatch::updateParameters() const {
+    for (size_t i = 0; i < m_muscles.size(); ++i) {
+        const DGF& muscle = *m_muscles[i];
+        if (!muscle.isObjectUpToDateWithProperties()) {
+            m_params.update(i, muscle);
+        }
+    }
+}
+
+template <typename T>
+void DeGrooteFregly2016MuscleBatch::findMusclesToEvaluate(
+        const SimTK::State& s, const DGF& requester,
+        Component::CacheVariable<T> Muscle::*cv,
+        std::vector<char>& evaluate) const {
+    for (size_t i = 0; i < m_muscles.size(); ++i) {
+        const DGF& muscle = *m_muscles[i];
+        evaluate[i] = &muscle == &requester ||
+                      (muscle.appliesForce(s) &&
+                              !muscle.isCacheVariableValid(s, muscle.*cv));
+    }
+}
+
+void DeGrooteFregly2016MuscleBatch::calcMuscleLengthInfo(const SimTK::State& s,
+        const DGF& requester, Muscle::MuscleLengthInfo& requesterInfo) const {
+    using SimTK::square;
+    const int n = (int)m_muscles.size();
+    std::lock_guard<std::recursive_mutex> lock(m_mutex);
+    updateParameters();
+    const Parameters& p = m_params;
+    const std::vector<char>& evaluate = m_lengthWorkspace.evaluate;
+    findMusclesToEvaluate(s, requester, &DGF::_lengthInfoCV,
+            m_lengthWorkspace.evaluate);
+
+    // Gather inputs. Muscles we do not evaluate get inputs that produce
+    // finite values; their results are discarded.
+    double* muscleTendonLength = m_lengthWorkspace.resetValues();
+    double* normTendonForce = muscleTendonLength + n;
+    double* normTendonLength = normTendonForce + n;
+    double* tendonLength = normTendonLength + n;
+    double* fiberLengthAlongTendon = tendonLength + n;
+    double* fiberLength = fiberLengthAlongTendon + n;
+    double* normFiberLength = fiberLength + n;
+    double* cosPennationAngle = normFiberLength + n;
+    double* sinPennationAngle = cosPennationAngle + n;
+    double* pennationAngle = sinPennationAngle + n;
+    double* passiveForceMultiplier = pennationAngle + n;
+    double* activeForceLengthMultiplier = passiveForceMultiplier + n;
+    for (int i = 0; i < n; ++i) {
+        if (evaluate[i]) {
+            const DGF& muscle = *m_muscles[i];
+            muscleTendonLength[i] = muscle.getLength(s);
+            if (!m_ignoreTendonCompliance) {
+                normTendonForce[i] = muscle.getNormalizedTendonForce(s);
+            }
+        } else {
+            muscleTendonLength[i] =
+                    p.optimalFiberLength[i] + p.tendonSlackLength[i];
+        }
+    }
+
+    // Tendon.
+    // -------
+    if (m_ignoreTendonCompliance) {
+        std::fill(normTendonLength, normTendonLength + n, 1.0);
+    } else {
+        for (int i = 0; i < n; ++i) {
+            normTendonLength[i] =
+                    log((1.0 / DGF::c1) * (normTendonForce[i] + DGF::c3)) /
+                            p.kT[i] +
+                    DGF::c2;
+        }
+    }
+
+    // Fiber and pennation.
+    // --------------------
+    for (int i = 0; i < n; ++i) {
+        tendonLength[i] = p.tendonSlackLength[i] * normTendonLength[i];
+        fiberLengthAlongTendon[i] = muscleTendonLength[i] - tendonLength[i];
+        fiberLength[i] = sqrt(square(fiberLengthAlongTendon[i]) +
+                              p.squareFiberWidth[i]);
+        normFiberLength[i] = fiberLength[i] / p.optimalFiberLength[i];
+        cosPennationAngle[i] = fiberLengthAlongTendon[i] / fiberLength[i];
+        sinPennationAngle[i] = p.fiberWidth[i] / fiberLength[i];
+        pennationAngle[i] = asin(sinPennationAngle[i]);
+    }
+
+    // Multipliers.
+    // ------------
+    for (int i = 0; i < n; ++i) {
+        passiveForceMultiplier[i] =
+                p.ignorePassiveFiberForce[i]
+                        ? 0
+                        : (exp(DGF::kPE * (normFiberLength[i] - 1.0) /
+                                   p.passiveFiberStrainAtOneNormForce[i]) -
+                                  p.passiveForceOffset[i]) /
+                                  p.passiveForceDenom[i];
+    }
+    for (int i = 0; i < n; ++i) {
+        const double x =
+                (normFiberLength[i] - 1.0) / p.activeForceWidthScale[i] + 1.0;
+        activeForceLengthMultiplier[i] =
+                DGF::calcGaussianLikeCurve(
+                        x, DGF::b11, DGF::b21, DGF::b31, DGF::b41) +
+                DGF::calcGaussianLikeCurve(
+                        x, DGF::b12, DGF::b22, DGF::b32, DGF::b42) +
+                DGF::calcGaussianLikeCurve(
+                        x, DGF::b13, DGF::b23, DGF::b33, DGF::b43);
+    }
+
+    // Store the results.
+    // ------------------
+    for (int i = 0; i < n; ++i) {
+        if (!evaluate[i]) continue;
+        const DGF& muscle = *m_muscles[i];
+        const bool isRequester = &muscle == &requester;
+        Muscle::MuscleLengthInfo& mli =
+                isRequester ? requesterInfo : muscle.updMuscleLengthInfo(s);
+        mli.normTendonLength = normTendonLength[i];
+        mli.tendonStrain = normTendonLength[i] - 1.0;
+        mli.tendonLength = tendonLength[i];
+        mli.fiberLengthAlongTendon = fiberLengthAlongTendon[i];
+        mli.fiberLength = fiberLength[i];
+        mli.normFiberLength = normFiberLength[i];
+        mli.cosPennationAngle = cosPennationAngle[i];
+        mli.sinPennationAngle = sinPennationAngle[i];
+        mli.pennationAngle = pennationAngle[i];
+        mli.fiberPassiveForceLengthMultiplier = passiveForceMultiplier[i];
+        mli.fiberActiveForceLengthMultiplier = activeForceLengthMultiplier[i];
+        if (!isRequester) {
+            muscle.markCacheVariableValid(s, muscle._lengthInfoCV);
+        }
+
+        if (mli.tendonLength < p.tendonSlackLength[i]) {
+            log_info("DeGrooteFregly2016Muscle '{}' is buckling (length < "
+                     "tendon_slack_length) at time {} s.",
+                    muscle.getName(), s.getTime());
+        }
+    }
+}
+
+void DeGrooteFregly2016MuscleBatch::calcFiberVelocityInfo(const SimTK::State& s,
+        const DGF& requester, Muscle::FiberVelocityInfo& requesterInfo) const {
+    const int n = (int)m_muscles.size();
+    std::lock_guard<std::recursive_mutex> lock(m_mutex);
+    updateParameters();
+    const Parameters& p = m_params;
+    const std::vector<char>& evaluate = m_velocityWorkspace.evaluate;
+    findMusclesToEvaluate(s, requester, &DGF::_velInfoCV,
+            m_velocityWorkspace.evaluate);
+
+    // Gather inputs. Muscles we do not evaluate get inputs that produce
+    // finite values; their results are discarded.
+    double* muscleTendonVelocity = m_velocityWorkspace.resetValues();
+    double* activation = muscleTendonVelocity + n;
+    double* normTendonForce = activation + n;
+    double* normTendonForceDerivative = normTendonForce + n;
+    double* normTendonLength = normTendonForceDerivative + n;
+    double* fiberLength = normTendonLength + n;
+    double* fiberLengthAlongTendon = fiberLength + n;
+    double* cosPennationAngle = fiberLengthAlongTendon + n;
+    double* activeForceLengthMultiplier = cosPennationAngle + n;
+    double* passiveForceMultiplier = activeForceLengthMultiplier + n;
+    double* forceVelocityMultiplier = passiveForceMultiplier + n;
+    double* normFiberVelocity = forceVelocityMultiplier + n;
+    double* fiberVelocity = normFiberVelocity + n;
+    double* fiberVelocityAlongTendon = fiberVelocity + n;
+    double* tendonVelocity = fiberVelocityAlongTendon + n;
+    double* normTendonVelocity = tendonVelocity + n;
+    double* pennationAngularVelocity = normTendonVelocity + n;
+    for (int i = 0; i < n; ++i) {
+        if (evaluate[i]) {
+            const DGF& muscle = *m_muscles[i];
+            const auto& mli = muscle.getMuscleLengthInfo(s);
+            muscleTendonVelocity[i] = muscle.getLengtheningSpeed(s);
+            activation[i] = muscle.getActivation(s);
+            if (!m_ignoreTendonCompliance) {
+                if (m_isTendonDynamicsExplicit) {
+                    normTendonForce[i] = muscle.getNormalizedTendonForce(s);
+                } else {
+                    normTendonForceDerivative[i] =
+                            muscle.getNormalizedTendonForceDerivative(s);
+                }
+            }
+            normTendonLength[i] = mli.normTendonLength;
+            fiberLength[i] = mli.fiberLength;
+            fiberLengthAlongTendon[i] = mli.fiberLengthAlongTendon;
+            cosPennationAngle[i] = mli.cosPennationAngle;
+            activeForceLengthMultiplier[i] =
+                    mli.fiberActiveForceLengthMultiplier;
+            passiveForceMultiplier[i] = mli.fiberPassiveForceLengthMultiplier;
+        } else {
+            activation[i] = 1.0;
+            normTendonForce[i] = 1.0;
+            normTendonLength[i] = 1.0;
+            fiberLength[i] = p.optimalFiberLength[i];
+            fiberLengthAlongTendon[i] = p.optimalFiberLength[i];
+            cosPennationAngle[i] = 1.0;
+            activeForceLengthMultiplier[i] = 1.0;
+        }
+    }
+
+    if (m_isTendonDynamicsExplicit && !m_ignoreTendonCompliance) {
+        for (int i = 0; i < n; ++i) {
+            const double normFiberForce =
+                    normTendonForce[i] / cosPennationAngle[i];
+            forceVelocityMultiplier[i] =
+                    (normFiberForce - passiveForceMultiplier[i]) /
+                    (activation[i] * activeForceLengthMultiplier[i]);
+            normFiberVelocity[i] = DGF::calcForceVelocityInverseCurve(
+                    forceVelocityMultiplier[i]);
+            fiberVelocity[i] = normFiberVelocity[i] *
+                               p.maxContractionVelocityInMetersPerSecond[i];
+            fiberVelocityAlongTendon[i] =
+                    fiberVelocity[i] / cosPennationAngle[i];
+            tendonVelocity[i] =
+                    muscleTendonVelocity[i] - fiberVelocityAlongTendon[i];
+            normTendonVelocity[i] = tendonVelocity[i] / p.tendonSlackLength[i];
+        }
+    } else {
+        if (m_ignoreTendonCompliance) {
+            std::fill(normTendonVelocity, normTendonVelocity + n, 0.0);
+        } else {
+            for (int i = 0; i < n; ++i) {
+                normTendonVelocity[i] =
+                        normTendonForceDerivative[i] /
+                        (DGF::c1 * p.kT[i] *
+                                exp(p.kT[i] * (normTendonLength[i] - DGF::c2)));
+            }
+        }
+        for (int i = 0; i < n; ++i) {
+            tendonVelocity[i] = p.tendonSlackLength[i] * normTendonVelocity[i];
+            fiberVelocityAlongTendon[i] =
+                    muscleTendonVelocity[i] - tendonVelocity[i];
+            fiberVelocity[i] =
+                    fiberVelocityAlongTendon[i] * cosPennationAngle[i];
+            normFiberVelocity[i] = fiberVelocity[i] /
+                                   p.maxContractionVelocityInMetersPerSecond[i];
+            forceVelocityMultiplier[i] =
+                    DGF::calcForceVelocityMultiplier(normFiberVelocity[i]);
+        }
+    }
+
+    for (int i = 0; i < n; ++i) {
+        const double tanPennationAngle =
+                p.fiberWidth[i] / fiberLengthAlongTendon[i];
+        pennationAngularVelocity[i] =
+                -fiberVelocity[i] / fiberLength[i] * tanPennationAngle;
+    }
+
+    // Store the results.
+    // ------------------
+    for (int i = 0; i < n; ++i) {
+        if (!evaluate[i]) continue;
+        const DGF& muscle = *m_muscles[i];
+        const bool isRequester = &muscle == &requester;
+        Muscle::FiberVelocityInfo& fvi =
+                isRequester ? requesterInfo : muscle.updFiberVelocityInfo(s);
+        fvi.fiberForceVelocityMultiplier = forceVelocityMultiplier[i];
+        fvi.normFiberVelocity = normFiberVelocity[i];
+        fvi.fiberVelocity = fiberVelocity[i];
+        fvi.fiberVelocityAlongTendon = fiberVelocityAlongTendon[i];
+        fvi.tendonVelocity = tendonVelocity[i];
+        fvi.normTendonVelocity = normTendonVelocity[i];
+        fvi.pennationAngularVelocity = pennationAngularVelocity[i];
+        if (!isRequester) {
+            muscle.markCacheVariableValid(s, muscle._velInfoCV);
+        }
+
+        if (fvi.normFiberVelocity < -1.0) {
+            log_info("DeGrooteFregly2016Muscle '{}' is exceeding maximum "
+                     "contraction velocity at time {} s.",
+                    muscle.getName(), s.getTime());
+        }
+    }
+}
+
+void DeGrooteFregly2016MuscleBatch::calcMuscleDynamicsInfo(
+        const SimTK::State& s, const DGF& requester,
+        Muscle::MuscleDynamicsInfo& requesterInfo) const {
+    using SimTK::square;
+    const int n = (int)m_muscles.size();
+    std::lock_guard<std::recursive_mutex> lock(m_mutex);
+    updateParameters();
+    const Parameters& p = m_params;
+    const std::vector<char>& evaluate = m_dynamicsWorkspace.evaluate;
+    findMusclesToEvaluate(s, requester, &DGF::_dynamicsInfoCV,
+            m_dynamicsWorkspace.evaluate);
+
+    // Gather inputs. Muscles we do not evaluate get inputs that produce
+    // finite values; their results are discarded.
+    double* activation = m_dynamicsWorkspace.resetValues();
+    double* normTendonForce = activation + n;
+    double* muscleTendonVelocity = normTendonForce + n;
+    double* normTendonLength = muscleTendonVelocity + n;
+    double* fiberLength = normTendonLength + n;
+    double* normFiberLength = fiberLength + n;
+    double* cosPennationAngle = normFiberLength + n;
+    double* sinPennationAngle = cosPennationAngle + n;
+    double* activeForceLengthMultiplier = sinPennationAngle + n;
+    double* passiveForceMultiplier = activeForceLengthMultiplier + n;
+    double* forceVelocityMultiplier = passiveForceMultiplier + n;
+    double* normFiberVelocity = forceVelocityMultiplier + n;
+    double* fiberVelocity = normFiberVelocity + n;
+    double* tendonVelocity = fiberVelocity + n;
+    double* activeFiberForce = tendonVelocity + n;
+    double* conPassiveFiberForce = activeFiberForce + n;
+    double* nonConPassiveFiberForce = conPassiveFiberForce + n;
+    double* totalFiberForce = nonConPassiveFiberForce + n;
+    double* fiberForceAlongTendon = totalFiberForce + n;
+    double* normTendonForceOut = fiberForceAlongTendon + n;
+    double* tendonForce = normTendonForceOut + n;
+    double* fiberStiffness = tendonForce + n;
+    double* partialPennationAnglePartialFiberLength = fiberStiffness + n;
+    double* partialFiberForceAlongTendonPartialFiberLength =
+            partialPennationAnglePartialFiberLength + n;
+    double* fiberStiffnessAlongTendon =
+            partialFiberForceAlongTendonPartialFiberLength + n;
+    double* tendonStiffness = fiberStiffnessAlongTendon + n;
+    double* muscleStiffness = tendonStiffness + n;
+    double* partialTendonForcePartialFiberLength = muscleStiffness + n;
+    double* fiberActivePower = partialTendonForcePartialFiberLength + n;
+    double* fiberPassivePower = fiberActivePower + n;
+    double* tendonPower = fiberPassivePower + n;
+    double* musclePower = tendonPower + n;
+    for (int i = 0; i < n; ++i) {
+        if (evaluate[i]) {
+            const DGF& muscle = *m_muscles[i];
+            activation[i] = muscle.getActivation(s);
+            if (!m_ignoreTendonCompliance) {
+                normTendonForce[i] = muscle.getNormalizedTendonForce(s);
+            }
+            muscleTendonVelocity[i] = muscle.getLengtheningSpeed(s);
+            const auto& mli = muscle.getMuscleLengthInfo(s);
+            const auto& fvi = muscle.getFiberVelocityInfo(s);
+            normTendonLength[i] = mli.normTendonLength;
+            fiberLength[i] = mli.fiberLength;
+            normFiberLength[i] = mli.normFiberLength;
+            cosPennationAngle[i] = mli.cosPennationAngle;
+            sinPennationAngle[i] = mli.sinPennationAngle;
+            activeForceLengthMultiplier[i] =
+                    mli.fiberActiveForceLengthMultiplier;
+            passiveForceMultiplier[i] = mli.fiberPassiveForceLengthMultiplier;
+            forceVelocityMultiplier[i] = fvi.fiberForceVelocityMultiplier;
+            normFiberVelocity[i] = fvi.normFiberVelocity;
+            fiberVelocity[i] = fvi.fiberVelocity;
+            tendonVelocity[i] = fvi.tendonVelocity;
+        } else {
+            normTendonLength[i] = 1.0;
+            fiberLength[i] = p.optimalFiberLength[i];
+            normFiberLength[i] = 1.0;
+            cosPennationAngle[i] = 1.0;
+        }
+    }
+
+    // Forces.
+    // -------
+    for (int i = 0; i < n; ++i) {
+        const double maxIsometricForce = p.maxIsometricForce[i];
+        activeFiberForce[i] =
+                maxIsometricForce * (activation[i] *
+                                            activeForceLengthMultiplier[i] *
+                                            forceVelocityMultiplier[i]);
+        conPassiveFiberForce[i] = maxIsometricForce * passiveForceMultiplier[i];
+        nonConPassiveFiberForce[i] =
+                maxIsometricForce * p.fiberDamping[i] * normFiberVelocity[i];
+        totalFiberForce[i] = activeFiberForce[i] + conPassiveFiberForce[i] +
+                             nonConPassiveFiberForce[i];
+        fiberForceAlongTendon[i] = totalFiberForce[i] * cosPennationAngle[i];
+    }
+    if (m_ignoreTendonCompliance) {
+        for (int i = 0; i < n; ++i) {
+            normTendonForceOut[i] = totalFiberForce[i] /
+                                    p.maxIsometricForce[i] *
+                                    cosPennationAngle[i];
+            tendonForce[i] = fiberForceAlongTendon[i];
+        }
+    } else {
+        for (int i = 0; i < n; ++i) {
+            normTendonForceOut[i] = normTendonForce[i];
+            tendonForce[i] = p.maxIsometricForce[i] * normTendonForce[i];
+        }
+    }
+
+    // Stiffnesses.
+    // ------------
+    for (int i = 0; i < n; ++i) {
+        const double scale = p.activeForceWidthScale[i];
+        const double x = (normFiberLength[i] - 1.0) / scale + 1.0;
+        const double activeForceLengthMultiplierDerivative =
+                (1.0 / scale) *
+                (DGF::calcGaussianLikeCurveDerivative(
+                         x, DGF::b11, DGF::b21, DGF::b31, DGF::b41) +
+                        DGF::calcGaussianLikeCurveDerivative(
+                                x, DGF::b12, DGF::b22, DGF::b32, DGF::b42) +
+                        DGF::calcGaussianLikeCurveDerivative(
+                                x, DGF::b13, DGF::b23, DGF::b33, DGF::b43));
+        const double e0 = p.passiveFiberStrainAtOneNormForce[i];
+        const double passiveForceMultiplierDerivative =
+                p.ignorePassiveFiberForce[i]
+                        ? 0
+                        : (DGF::kPE *
+                                  exp((DGF::kPE * (normFiberLength[i] - 1)) /
+                                          e0)) /
+                                  (e0 * p.passiveForceDenom[i]);
+        const double partialNormFiberLengthPartialFiberLength =
+                1.0 / p.optimalFiberLength[i];
+        const double partialNormActiveForcePartialFiberLength =
+                partialNormFiberLengthPartialFiberLength *
+                activeForceLengthMultiplierDerivative;
+        const double partialNormPassiveForcePartialFiberLength =
+                partialNormFiberLengthPartialFiberLength *
+                passiveForceMultiplierDerivative;
+        fiberStiffness[i] =
+                p.maxIsometricForce[i] *
+                (activation[i] * partialNormActiveForcePartialFiberLength *
+                                forceVelocityMultiplier[i] +
+                        partialNormPassiveForcePartialFiberLength);
+    }
+    for (int i = 0; i < n; ++i) {
+        partialPennationAnglePartialFiberLength[i] =
+                (-p.fiberWidth[i] / square(fiberLength[i])) /
+                sqrt(1.0 - square(p.fiberWidth[i] / fiberLength[i]));
+        const double partialCosPennationAnglePartialFiberLength =
+                -sinPennationAngle[i] *
+                partialPennationAnglePartialFiberLength[i];
+        partialFiberForceAlongTendonPartialFiberLength[i] =
+                fiberStiffness[i] * cosPennationAngle[i] +
+                totalFiberForce[i] * partialCosPennationAnglePartialFiberLength;
+        const double partialFiberLengthAlongTendonPartialFiberLength =
+                cosPennationAngle[i] -
+                fiberLength[i] * sinPennationAngle[i] *
+                        partialPennationAnglePartialFiberLength[i];
+        fiberStiffnessAlongTendon[i] =
+                partialFiberForceAlongTendonPartialFiberLength[i] *
+                (1.0 / partialFiberLengthAlongTendonPartialFiberLength);
+    }
+    if (m_ignoreTendonCompliance) {
+        for (int i = 0; i < n; ++i) {
+            tendonStiffness[i] = SimTK::Infinity;
+            muscleStiffness[i] = fiberStiffnessAlongTendon[i];
+        }
+    } else {
+        for (int i = 0; i < n; ++i) {
+            tendonStiffness[i] =
+                    (p.maxIsometricForce[i] / p.tendonSlackLength[i]) *
+                    (DGF::c1 * p.kT[i] *
+                            exp(p.kT[i] * (normTendonLength[i] - DGF::c2)));
+            muscleStiffness[i] =
+                    (fiberStiffnessAlongTendon[i] * tendonStiffness[i]) /
+                    (fiberStiffnessAlongTendon[i] + tendonStiffness[i]);
+        }
+    }
+    for (int i = 0; i < n; ++i) {
+        const double partialTendonLengthPartialFiberLength =
+                fiberLength[i] * sinPennationAngle[i] *
+                        partialPennationAnglePartialFiberLength[i] -
+                cosPennationAngle[i];
+        partialTendonForcePartialFiberLength[i] =
+                tendonStiffness[i] * partialTendonLengthPartialFiberLength;
+    }
+
+    // Powers.
+    // -------
+    for (int i = 0; i < n; ++i) {
+        fiberActivePower[i] =
+                -(activeFiberForce[i] + nonConPassiveFiberForce[i]) *
+                fiberVelocity[i];
+        fiberPassivePower[i] = -conPassiveFiberForce[i] * fiberVelocity[i];
+        tendonPower[i] = -tendonForce[i] * tendonVelocity[i];
+        musclePower[i] = -tendonForce[i] * muscleTendonVelocity[i];
+    }
+
+    // Store the results.
+    // ------------------
+    for (int i = 0; i < n; ++i) {
+        if (!evaluate[i]) continue;
+        const DGF& muscle = *m_muscles[i];
+        const bool isRequester = &muscle == &requester;
+        Muscle::MuscleDynamicsInfo& mdi =
+                isRequester ? requesterInfo : muscle.updMuscleDynamicsInfo(s);
+        mdi.activation = activation[i];
+        mdi.fiberForce = totalFiberForce[i];
+        mdi.activeFiberForce = activeFiberForce[i];
+        mdi.passiveFiberForce =
+                conPassiveFiberForce[i] + nonConPassiveFiberForce[i];
+        mdi.normFiberForce = totalFiberForce[i] / p.maxIsometricForce[i];
+        mdi.fiberForceAlongTendon = fiberForceAlongTendon[i];
+        mdi.normTendonForce = normTendonForceOut[i];
+        mdi.tendonForce = tendonForce[i];
+        mdi.fiberStiffness = fiberStiffness[i];
+        mdi.fiberStiffnessAlongTendon = fiberStiffnessAlongTendon[i];
+        mdi.tendonStiffness = tendonStiffness[i];
+        mdi.muscleStiffness = muscleStiffness[i];
+        mdi.fiberActivePower = fiberActivePower[i];
+        mdi.fiberPassivePower = fiberPassivePower[i];
+        mdi.tendonPower = tendonPower[i];
+        mdi.musclePower = musclePower[i];
+        mdi.userDefinedDynamicsExtras.resize(5);
+        mdi.userDefinedDynamicsExtras[DGF::m_mdi_passiveFiberElasticForce] =
+                conPassiveFiberForce[i];
+        mdi.userDefinedDynamicsExtras[DGF::m_mdi_passiveFiberDampingForce] =
+                nonConPassiveFiberForce[i];
+        mdi.userDefinedDynamicsExtras
+                [DGF::m_mdi_partialPennationAnglePartialFiberLength] =
+                partialPennationAnglePartialFiberLength[i];
+        mdi.userDefinedDynamicsExtras
+                [DGF::m_mdi_partialFiberForceAlongTendonPartialFiberLength] =
+                partialFiberForceAlongTendonPartialFiberLength[i];
+        mdi.userDefinedDynamicsExtras
+                [DGF::m_mdi_partialTendonForcePartialFiberLength] =
+                partialTendonForcePartialFiberLength[i];
+        if (!isRequester) {
+            muscle.markCacheVariableValid(s, muscle._dynamicsInfoCV);
+        }
+    }
+}
+
+} // namespace OpenSim
+
 void DeGrooteFregly2016Muscle::constructProperties() {
     constructProperty_activation_time_constant(0.015);
     constructProperty_deactivation_time_constant(0.060);
@@ -164,6 +840,34 @@ void DeGrooteFregly2016Muscle::extendFinalizeFromProperties() {
             get_tendon_compliance_dynamics_mode() == "explicit";
 }
 
+void DeGrooteFregly2016Muscle::extendConnectToModel(Model& model) {
+    Super::extendConnectToModel(model);
+
+    // The first DeGrooteFregly2016Muscle in the model assigns batches to all
+    // of the DeGrooteFregly2016Muscles in the model.
+    const auto muscles = model.getComponentList<DeGrooteFregly2016Muscle>();
+    if (&*muscles.begin() != this) return;
+
+    using MuscleGroup = std::vector<const DeGrooteFregly2016Muscle*>;
+    std::map<std::pair<bool, bool>, MuscleGroup> groups;
+    for (const auto& muscle : muscles) {
+        muscle.m_batch.reset();
+        if (!muscle.getBatchEvaluation()) continue;
+        // Subclasses may override the calc*Info() functions.
+        if (muscle.getConcreteClassName() != getClassName()) continue;
+        groups[{muscle.get_ignore_tendon_compliance(),
+                       muscle.m_isTendonDynamicsExplicit}]
+                .push_back(&muscle);
+    }
+    for (auto& group : groups) {
+        if (group.second.size() < 2) continue;
+        const std::shared_ptr<const DeGrooteFregly2016MuscleBatch> batch =
+                std::make_shared<DeGrooteFregly2016MuscleBatch>(group.second,
+                        group.first.first, group.first.second);
+        for (const auto* muscle : group.second) { muscle->m_batch = batch; }
+    }
+}
+
 void DeGrooteFregly2016Muscle::extendAddToSystem(
         SimTK::MultibodySystem& system) const {
     Super::extendAddToSystem(system);
@@ -474,6 +1178,11 @@ void DeGrooteFregly2016Muscle::calcMusclePotentialEnergyInfoHelper(
 void DeGrooteFregly2016Muscle::calcMuscleLengthInfo(
         const SimTK::State& s, MuscleLengthInfo& mli) const {
 
+    if (m_batch) {
+        m_batch->calcMuscleLengthInfo(s, *this, mli);
+        return;
+    }
+
     const auto& muscleTendonLength = getLength(s);
     SimTK::Real normTendonForce = SimTK::NaN;
     if (!get_ignore_tendon_compliance()) {
@@ -494,6 +1203,11 @@ void DeGrooteFregly2016Muscle::calcMuscleLengthInfo(
 void DeGrooteFregly2016Muscle::calcFiberVelocityInfo(
         const SimTK::State& s, FiberVelocityInfo& fvi) const {
 
+    if (m_batch) {
+        m_batch->calcFiberVelocityInfo(s, *this, fvi);
+        return;
+    }
+
     const auto& mli = getMuscleLengthInfo(s);
     const auto& muscleTendonVelocity = getLengtheningSpeed(s);
     const auto& activation = getActivation(s);
@@ -521,6 +1235,11 @@ void DeGrooteFregly2016Muscle::calcFiberVelocityInfo(
 
 void DeGrooteFregly2016Muscle::calcMuscleDynamicsInfo(
         const SimTK::State& s, MuscleDynamicsInfo& mdi) const {
+    if (m_batch) {
+        m_batch->calcMuscleDynamicsInfo(s, *this, mdi);
+        return;
+    }
+
     const auto& activation = getActivation(s);
     SimTK::Real normTendonForce = SimTK::NaN;
     if (!get_ignore_tendon_compliance()) {
@@ -852,9 +1571,14 @@ double DeGrooteFregly2016Muscle::getImplicitResidualNormalizedTendonForce(
     // Recompute residual if cache is invalid.
     if (!isCacheVariableValid(s, RESIDUAL_NORMALIZED_TENDON_FORCE_NAME)) {
         // Compute muscle-tendon equilibrium residual value to update the
-        // cache variable.
+        // cache variable. In implicit mode, the muscle dynamics info is
+        // computed exactly as in calcEquilibriumResidual(), so we reuse it
+        // (it may have been computed along with other muscles in a batch)
+        // instead of computing the residual from scratch.
+        const auto& mdi = getMuscleDynamicsInfo(s);
         setCacheVariableValue(s, RESIDUAL_NORMALIZED_TENDON_FORCE_NAME,
-                getEquilibriumResidual(s));
+                mdi.normTendonForce -
+                        mdi.fiberForceAlongTendon / get_max_isometric_force());
         markCacheVariableValid(s, RESIDUAL_NORMALIZED_TENDON_FORCE_NAME);
     }
 
@@ -31,6 +31,8 @@
 
 namespace OpenSim {
 
+class DeGrooteFregly2016MuscleBatch;
+
 // TODO avoid checking ignore_tendon_compliance() in each function;
 //       might be slow.
 // TODO prohibit fiber length from going below 0.2.
@@ -84,6 +86,21 @@ time-stepping.
    The methods getMinNormalizedTendonForce() and 
    getMaxNormalizedTendonForce() provide these bounds for use in custom solvers.
 
+@section batch Batch evaluation
+
+The DeGrooteFregly2016Muscles in a model for which batch evaluation is enabled
+(see setBatchEvaluation()) and that have the same values for
+ignore_tendon_compliance and tendon_compliance_dynamics_mode are evaluated
+together: when one of them
+computes its length, velocity, or dynamics info, the info for the others is
+computed in the same pass (using loops over contiguous arrays of muscle
+parameters) and stored in their caches. The results match those of evaluating
+each muscle on its own, up to rounding. Edits to the muscle parameters take
+effect immediately, but the groups are formed when the model is connected
+(e.g., by Model::initSystem()), so changes to the batch evaluation setting or
+the tendon compliance settings take effect only then.
+Subclasses of this muscle are never evaluated in batches.
+
 @section departures Departures from the Muscle base class
 
 The documentation for Muscle::MuscleLengthInfo states that the
@@ -163,6 +180,7 @@ protected:
     /// @name Component interface
     /// @{
     void extendFinalizeFromProperties() override;
+    void extendConnectToModel(Model& model) override;
     void extendAddToSystem(SimTK::MultibodySystem& system) const override;
     void extendInitStateFromProperties(SimTK::State& s) const override;
     void extendSetPropertiesFromState(const SimTK::State& s) override;
@@ -350,6 +368,9 @@ public:
     SimTK::Vec2 getBoundsNormalizedFiberLength() const {
         return {getMinNormalizedTendonForce(), getMaxNormalizedTendonForce()};
     }
+
+    /// @copydoc setBatchEvaluation()
+    bool getBatchEvaluation() const { return m_batchEvaluation; }
     /// @}
 
     /// @name Set methods.
@@ -365,6 +386,14 @@ public:
             markCacheVariableInvalid(s, "dynamicsInfo");
         }
     }
+
+    /// Evaluate this muscle together with the other muscles in the model for
+    /// which this is enabled (see @ref batch). This only affects
+    /// performance, so it is not a property: it is not serialized, but it is
+    /// kept when the muscle is copied. Default: true.
+    void setBatchEvaluation(bool batchEvaluation) {
+        m_batchEvaluation = batchEvaluation;
+    }
     /// @}
 
     /// @name Calculation methods.
@@ -795,9 +824,12 @@ public:
     /// ignores the 'default_fiber_length' property in replaced muscles.
     static void replaceMuscles(
             Model& model, bool allowUnsupportedMuscles = false);
+
     /// @}
 
 private:
+    friend class DeGrooteFregly2016MuscleBatch;
+
     void constructProperties();
 
     void calcMuscleLengthInfoHelper(const SimTK::Real& muscleTendonLength,
@@ -941,6 +973,14 @@ private:
     SimTK::Real m_kT = SimTK::NaN;
     bool m_isTendonDynamicsExplicit = true;
 
+    bool m_batchEvaluation = true;
+    // The batch (if any) this muscle is evaluated with. This is shared with
+    // the other muscles in the batch and is assigned in
+    // extendConnectToModel().
+    mutable SimTK::ResetOnCopy<
+            std::shared_ptr<const DeGrooteFregly2016MuscleBatch>>
+            m_batch;
+
     // Indices for MuscleDynamicsInfo::userDefinedDynamicsExtras.
     constexpr static int m_mdi_passiveFiberElasticForce = 0;
     constexpr static int m_mdi_passiveFiberDampingForce = 1;
@@ -322,6 +322,26 @@ void Millard2012EquilibriumMuscle::extendFinalizeFromProperties()
     const double phi = penMdl.calcPennationAngle(m_minimumFiberLength);
     m_minimumFiberLengthAlongTendon =
         penMdl.calcFiberLengthAlongTendon(m_minimumFiberLength, cos(phi));
+
+    // Cache the parameters and curves used when evaluating the muscle.
+    updateParameters();
+    m_falCurve.reset(&falCurve);
+    m_fvCurve.reset(&fvCurve);
+    m_fpeCurve.reset(&fpeCurve);
+    m_fseCurve.reset(&fseCurve);
+    m_penMdl.reset(&penMdl);
+    m_actMdl.reset(&getActivationModel());
+}
+
+void Millard2012EquilibriumMuscle::updateParameters() const
+{
+    m_params.maxIsometricForce = getMaxIsometricForce();
+    m_params.optimalFiberLength = getOptimalFiberLength();
+    m_params.tendonSlackLength = getTendonSlackLength();
+    m_params.maxContractionVelocity = getMaxContractionVelocity();
+    m_params.fiberDamping = getFiberDamping();
+    m_params.ignoreTendonCompliance = get_ignore_tendon_compliance();
+    m_params.ignoreActivationDynamics = get_ignore_activation_dynamics();
 }
 
 //==============================================================================
@@ -495,19 +515,31 @@ setMinimumActivation(double minimumActivation)
 
 void Millard2012EquilibriumMuscle::setActiveForceLengthCurve(
 ActiveForceLengthCurve& aActiveForceLengthCurve)
-{   set_ActiveForceLengthCurve(aActiveForceLengthCurve); }
+{
+    set_ActiveForceLengthCurve(aActiveForceLengthCurve);
+    m_falCurve.reset(&get_ActiveForceLengthCurve());
+}
 
 void Millard2012EquilibriumMuscle::setForceVelocityCurve(
 ForceVelocityCurve& aForceVelocityCurve)
-{   set_ForceVelocityCurve(aForceVelocityCurve); }
+{
+    set_ForceVelocityCurve(aForceVelocityCurve);
+    m_fvCurve.reset(&get_ForceVelocityCurve());
+}
 
 void Millard2012EquilibriumMuscle::setFiberForceLengthCurve(
 FiberForceLengthCurve& aFiberForceLengthCurve)
-{   set_FiberForceLengthCurve(aFiberForceLengthCurve); }
+{
+    set_FiberForceLengthCurve(aFiberForceLengthCurve);
+    m_fpeCurve.reset(&get_FiberForceLengthCurve());
+}
 
 void Millard2012EquilibriumMuscle::setTendonForceLengthCurve(
 TendonForceLengthCurve& aTendonForceLengthCurve)
-{   set_TendonForceLengthCurve(aTendonForceLengthCurve); }
+{
+    set_TendonForceLengthCurve(aTendonForceLengthCurve);
+    m_fseCurve.reset(&get_TendonForceLengthCurve());
+}
 
 void Millard2012EquilibriumMuscle::
 setFiberLength(SimTK::State& s, double fiberLength) const
@@ -621,20 +653,21 @@ extendPostScale(const SimTK::State& s, const ScaleSet& scaleSet)
 void Millard2012EquilibriumMuscle::calcMuscleLengthInfo(const SimTK::State& s,
     MuscleLengthInfo& mli) const
 {
+    const Parameters& params = getParameters();
     // Get musculotendon actuator properties.
-    //double maxIsoForce    = getMaxIsometricForce();
-    double optFiberLength = getOptimalFiberLength();
-    double tendonSlackLen = getTendonSlackLength();
+    //double maxIsoForce    = params.maxIsometricForce;
+    double optFiberLength = params.optimalFiberLength;
+    double tendonSlackLen = params.tendonSlackLength;
 
     try {
         // Get muscle-specific properties.
-        const ActiveForceLengthCurve& falCurve = get_ActiveForceLengthCurve();
-        const FiberForceLengthCurve&  fpeCurve = get_FiberForceLengthCurve();
-        //const TendonForceLengthCurve& fseCurve = get_TendonForceLengthCurve();
+        const ActiveForceLengthCurve& falCurve = *m_falCurve;
+        const FiberForceLengthCurve&  fpeCurve = *m_fpeCurve;
+        const MuscleFixedWidthPennationModel& penMdl = *m_penMdl;
 
-        if(get_ignore_tendon_compliance()) {                //rigid tendon
+        if(params.ignoreTendonCompliance) {                 //rigid tendon
             mli.fiberLength = clampFiberLength(
-                               getPennationModel().calcFiberLength(getLength(s),
+                               penMdl.calcFiberLength(getLength(s),
                                tendonSlackLen));
         } else {                                            // elastic tendon
             mli.fiberLength = clampFiberLength(
@@ -642,14 +675,13 @@ void Millard2012EquilibriumMuscle::calcMuscleLengthInfo(const SimTK::State& s,
         }
 
         mli.normFiberLength   = mli.fiberLength / optFiberLength;
-        mli.pennationAngle    = getPennationModel().
-                                    calcPennationAngle(mli.fiberLength);
+        mli.pennationAngle    = penMdl.calcPennationAngle(mli.fiberLength);
         mli.cosPennationAngle = cos(mli.pennationAngle);
         mli.sinPennationAngle = sin(mli.pennationAngle);
         mli.fiberLengthAlongTendon = mli.fiberLength * mli.cosPennationAngle;
 
         // Necessary even for the rigid tendon, as it might have gone slack.
-        mli.tendonLength      = getPennationModel().
+        mli.tendonLength      = penMdl.
                                     calcTendonLength(mli.cosPennationAngle,
                                                      mli.fiberLength,
                                                      getLength(s));
@@ -731,13 +763,16 @@ void Millard2012EquilibriumMuscle::
 void Millard2012EquilibriumMuscle::
 calcFiberVelocityInfo(const SimTK::State& s, FiberVelocityInfo& fvi) const
 {
+    const Parameters& params = getParameters();
     try {
         // Get the quantities that we've already computed.
         const MuscleLengthInfo &mli = getMuscleLengthInfo(s);
 
         // Get the static properties of this muscle.
         double dlenMcl   = getLengtheningSpeed(s);
-        double optFibLen = getOptimalFiberLength();
+        double optFibLen = params.optimalFiberLength;
+        double vmax      = params.maxContractionVelocity;
+        const MuscleFixedWidthPennationModel& penMdl = *m_penMdl;
 
         //======================================================================
         // Compute fv by inverting the force-velocity relationship in the
@@ -748,38 +783,36 @@ calcFiberVelocityInfo(const SimTK::State& s, FiberVelocityInfo& fvi) const
         double fv    = SimTK::NaN;
 
         // Calculate fiber velocity.
-        if(get_ignore_tendon_compliance()) {
+        if(params.ignoreTendonCompliance) {
 
             // Rigid tendon.
 
-            if(mli.tendonLength < getTendonSlackLength()
+            if(mli.tendonLength < params.tendonSlackLength
                                   - SimTK::SignificantReal) {
                 // The tendon is buckling, so fiber velocity is zero.
                 dlce  = 0.0;
                 dlceN = 0.0;
                 fv    = 1.0;
             } else {
-                dlce = getPennationModel().
+                dlce = penMdl.
                          calcFiberVelocity(mli.cosPennationAngle, dlenMcl, 0.0);
-                dlceN = dlce/(optFibLen*getMaxContractionVelocity());
-                fv = get_ForceVelocityCurve().calcValue(dlceN);
+                dlceN = dlce/(optFibLen*vmax);
+                fv = m_fvCurve->calcValue(dlceN);
             }
 
-        } else if(!get_ignore_tendon_compliance() && !use_fiber_damping) {
+        } else if(!params.ignoreTendonCompliance && !use_fiber_damping) {
 
             // Elastic tendon, no damping.
 
             double a = SimTK::NaN;
-            if(!get_ignore_activation_dynamics()) {
-                a = getActivationModel().clampActivation(
+            if(!params.ignoreActivationDynamics) {
+                a = m_actMdl->clampActivation(
                         getStateVariableValue(s, STATE_ACTIVATION_NAME));
             } else {
-                a = getActivationModel().clampActivation(getControl(s));
+                a = m_actMdl->clampActivation(getControl(s));
             }
 
-            const TendonForceLengthCurve& fseCurve =
-                get_TendonForceLengthCurve();
-            double fse = fseCurve.calcValue(mli.normTendonLength);
+            double fse = m_fseCurve->calcValue(mli.normTendonLength);
 
             SimTK_ERRCHK_ALWAYS(mli.cosPennationAngle > SimTK::SignificantReal,
                 "calcFiberVelocityInfo",
@@ -798,45 +831,42 @@ calcFiberVelocityInfo(const SimTK::State& s, FiberVelocityInfo& fvi) const
 
             // Evaluate the inverse force-velocity curve.
             dlceN = fvInvCurve.calcValue(fv);
-            dlce  = dlceN*getMaxContractionVelocity()*optFibLen;
+            dlce  = dlceN*vmax*optFibLen;
 
         } else {
 
             // Elastic tendon, with damping.
 
             double a = SimTK::NaN;
-            if(!get_ignore_activation_dynamics()) {
-                a = getActivationModel().clampActivation(
+            if(!params.ignoreActivationDynamics) {
+                a = m_actMdl->clampActivation(
                         getStateVariableValue(s, STATE_ACTIVATION_NAME));
             } else {
-                a = getActivationModel().clampActivation(getControl(s));
+                a = m_actMdl->clampActivation(getControl(s));
             }
 
-            const TendonForceLengthCurve& fseCurve =
-                get_TendonForceLengthCurve();
-            double fse = fseCurve.calcValue(mli.normTendonLength);
+            double fse = m_fseCurve->calcValue(mli.normTendonLength);
 
             // Newton solve for fiber velocity.
             fv = 1.0;
             dlce = -1;
             dlceN = -1;
-            double beta = get_fiber_damping();
+            double beta = params.fiberDamping;
 
             SimTK_ERRCHK_ALWAYS(beta > SimTK::SignificantReal,
                 "calcFiberVelocityInfo",
                 "Fiber damping coefficient must be greater than 0.");
 
             SimTK::Vec3 fiberVelocityV = calcDampedNormFiberVelocity(
-                getMaxIsometricForce(), a, mli.fiberActiveForceLengthMultiplier,
+                params.maxIsometricForce, a, mli.fiberActiveForceLengthMultiplier,
                 mli.fiberPassiveForceLengthMultiplier, fse, beta,
                 mli.cosPennationAngle);
 
             // If the Newton method converged, update the fiber velocity.
             if(fiberVelocityV[2] > 0.5) { //flag is set to 0.0 or 1.0
                 dlceN = fiberVelocityV[0];
-                dlce  = dlceN*getOptimalFiberLength()
-                        *getMaxContractionVelocity();
-                fv = get_ForceVelocityCurve().calcValue(dlceN);
+                dlce  = dlceN*optFibLen*vmax;
+                fv = m_fvCurve->calcValue(dlceN);
             } else {
                 // Throw an exception here because there is no point integrating
                 // a muscle velocity that is invalid (it will end up producing
@@ -849,16 +879,16 @@ calcFiberVelocityInfo(const SimTK::State& s, FiberVelocityInfo& fvi) const
         }
 
         // Compute the other velocity-related components.
-        double dphidt = getPennationModel().calcPennationAngularVelocity(
+        double dphidt = penMdl.calcPennationAngularVelocity(
             tan(mli.pennationAngle), mli.fiberLength, dlce);
-        double dlceAT = getPennationModel().calcFiberVelocityAlongTendon(
+        double dlceAT = penMdl.calcFiberVelocityAlongTendon(
             mli.fiberLength, dlce, mli.sinPennationAngle, mli.cosPennationAngle,
             dphidt);
         double dmcldt = getLengtheningSpeed(s);
         double dtl = 0;
 
-        if(!get_ignore_tendon_compliance()) {
-            dtl = getPennationModel().calcTendonVelocity(mli.cosPennationAngle,
+        if(!params.ignoreTendonCompliance) {
+            dtl = penMdl.calcTendonVelocity(mli.cosPennationAngle,
                 mli.sinPennationAngle, dphidt, mli.fiberLength, dlce, dmcldt);
         }
 
@@ -880,7 +910,7 @@ calcFiberVelocityInfo(const SimTK::State& s, FiberVelocityInfo& fvi) const
         fvi.fiberVelocityAlongTendon     = dlceAT;
         fvi.pennationAngularVelocity     = dphidt;
         fvi.tendonVelocity               = dtl;
-        fvi.normTendonVelocity           = dtl/getTendonSlackLength();
+        fvi.normTendonVelocity           = dtl/params.tendonSlackLength;
         fvi.fiberForceVelocityMultiplier = fv;
 
         fvi.userDefinedVelocityExtras.resize(1);
@@ -900,6 +930,7 @@ calcFiberVelocityInfo(const SimTK::State& s, FiberVelocityInfo& fvi) const
 void Millard2012EquilibriumMuscle::
 calcMuscleDynamicsInfo(const SimTK::State& s, MuscleDynamicsInfo& mdi) const
 {
+    const Parameters& params = getParameters();
     try {
         // Get the quantities that we've already computed.
         const MuscleLengthInfo &mli = getMuscleLengthInfo(s);
@@ -907,19 +938,19 @@ calcMuscleDynamicsInfo(const SimTK::State& s, MuscleDynamicsInfo& mdi) const
         double fiberStateClamped = mvi.userDefinedVelocityExtras[0];
 
         // Get the properties of this muscle.
-        double tendonSlackLen = getTendonSlackLength();
-        double optFiberLen    = getOptimalFiberLength();
-        double fiso           = getMaxIsometricForce();
+        double tendonSlackLen = params.tendonSlackLength;
+        double optFiberLen    = params.optimalFiberLength;
+        double fiso           = params.maxIsometricForce;
         //double penHeight      = penMdl.getParallelogramHeight();
-        const TendonForceLengthCurve& fseCurve = get_TendonForceLengthCurve();
+        const TendonForceLengthCurve& fseCurve = *m_fseCurve;
 
         // Compute dynamic quantities.
         double a = SimTK::NaN;
-        if(!get_ignore_activation_dynamics()) {
-            a = getActivationModel().clampActivation(
+        if(!params.ignoreActivationDynamics) {
+            a = m_actMdl->clampActivation(
                     getStateVariableValue(s, STATE_ACTIVATION_NAME));
         } else {
-            a = getActivationModel().clampActivation(getControl(s));
+            a = m_actMdl->clampActivation(getControl(s));
         }
 
         // Compute the stiffness of the muscle fiber.
@@ -960,7 +991,7 @@ calcMuscleDynamicsInfo(const SimTK::State& s, MuscleDynamicsInfo& mdi) const
             // compressive force. Here, we must enforce that the fiber generates
             // only tensile forces by saturating the damping force generated by
             // the parallel element.
-            if(get_ignore_tendon_compliance()) {
+            if(params.ignoreTendonCompliance) {
                 if(fm < 0) {
                     fm   = 0.0;
                     p2Fm = -aFm - p1Fm;
@@ -980,7 +1011,7 @@ calcMuscleDynamicsInfo(const SimTK::State& s, MuscleDynamicsInfo& mdi) const
                 mli.sinPennationAngle, mli.cosPennationAngle, mli.fiberLength);
 
             // Compute the stiffness of the tendon.
-            if(!get_ignore_tendon_compliance()) {
+            if(!params.ignoreTendonCompliance) {
                 dFt_dtl = fseCurve.calcDerivative(mli.normTendonLength,1)
                           *(fiso/tendonSlackLen);
 
@@ -996,7 +1027,7 @@ calcMuscleDynamicsInfo(const SimTK::State& s, MuscleDynamicsInfo& mdi) const
         }
 
         double fse = 0.0;
-        if(!get_ignore_tendon_compliance()) {
+        if(!params.ignoreTendonCompliance) {
             fse = fseCurve.calcValue(mli.normTendonLength);
         } else {
             fse = fmAT/fiso;
@@ -1165,7 +1196,7 @@ calcDampedNormFiberVelocity(double fiso,
     double df_d_dlceNdt = 0.0;
 
     while(abs(err) > tol && iter < maxIter) {
-        fv = get_ForceVelocityCurve().calcValue(dlceN_dt);
+        fv = m_fvCurve->calcValue(dlceN_dt);
         fiberForceV = calcFiberForce(fiso,a,fal,fv,fpe,dlceN_dt);
         fiberForce = fiberForceV[0];
 
@@ -1219,7 +1250,8 @@ calcFiberForce(double fiso,
                double fpe,
                double dlceN) const
 {
-    double beta = getFiberDamping();
+    const Parameters& params = getParameters();
+    double beta = params.fiberDamping;
     double fa   = fiso * (a*fal*fv);
     double fp1  = fiso * fpe;
     double fp2  = fiso * beta*dlceN;
@@ -1241,7 +1273,8 @@ double Millard2012EquilibriumMuscle::calcActivation(double fiso,
                                                     double fpe,
                                                     double dlceN) const
 {
-    double beta = getFiberDamping();
+    const Parameters& params = getParameters();
+    double beta = params.fiberDamping;
     double activation = 0.0;
 
     // If the fiber cannot generate any force due to its pennation angle,
@@ -1258,8 +1291,8 @@ double Millard2012EquilibriumMuscle::calcFiberStiffness(double fiso,
                                                         double lceN,
                                                         double optFibLen) const
 {
-    const FiberForceLengthCurve& fpeCurve  = get_FiberForceLengthCurve();
-    const ActiveForceLengthCurve& falCurve = get_ActiveForceLengthCurve();
+    const FiberForceLengthCurve& fpeCurve  = *m_fpeCurve;
+    const ActiveForceLengthCurve& falCurve = *m_falCurve;
     double DlceN_Dlce = 1.0/optFibLen;
     double Dfal_Dlce  = falCurve.calcDerivative(lceN,1) * DlceN_Dlce;
     double Dfpe_Dlce  = fpeCurve.calcDerivative(lceN,1) * DlceN_Dlce;
@@ -1276,7 +1309,7 @@ calc_DFiberForce_DNormFiberVelocity(double fiso,
                                     double dlceN_dt) const
 {
     // dfm_d_dlceNdt
-    return fiso * (a*fal*get_ForceVelocityCurve().calcDerivative(dlceN_dt,1)
+    return fiso * (a*fal*m_fvCurve->calcDerivative(dlceN_dt,1)
                    + beta);
 }
 
@@ -1287,8 +1320,7 @@ calc_DFiberForceAT_DFiberLength(double fiberForce,
                                 double sinPhi,
                                 double cosPhi) const
 {
-    double Dphi_Dlce    = getPennationModel().
-                              calc_DPennationAngle_DfiberLength(lce);
+    double Dphi_Dlce    = m_penMdl->calc_DPennationAngle_DfiberLength(lce);
     double Dcosphi_Dlce = -sinPhi*Dphi_Dlce;
 
     // The stiffness of the fiber along the direction of the tendon. For small
@@ -1304,8 +1336,7 @@ calc_DFiberForceAT_DFiberLengthAT(double dFmAT_d_lce,
                                   double cosPhi,
                                   double lce) const
 {
-    double dphi_d_lce = getPennationModel().
-                            calc_DPennationAngle_DfiberLength(lce);
+    double dphi_d_lce = m_penMdl->calc_DPennationAngle_DfiberLength(lce);
 
     // The change in length of the fiber length along the tendon.
     // lceAT = lce*cos(phi)
@@ -1322,9 +1353,8 @@ calc_DTendonForce_DFiberLength(double dFt_d_tl,
                                double sinphi,
                                double cosphi) const
 {
-    double dphi_d_lce = getPennationModel().
-                            calc_DPennationAngle_DfiberLength(lce);
-    double dtl_d_lce  = getPennationModel().
+    double dphi_d_lce = m_penMdl->calc_DPennationAngle_DfiberLength(lce);
+    double dtl_d_lce  = m_penMdl->
                             calc_DTendonLength_DfiberLength(lce, sinphi, cosphi,
                                                             dphi_d_lce);
     // dFt_d_lce
@@ -1340,7 +1370,7 @@ isFiberStateClamped(double lce, double dlceN) const
     bool clamped = false;
 
     // Get the minimum active fiber length (in meters).
-    double minFiberLength = getMinimumFiberLength();
+    double minFiberLength = m_minimumFiberLength;
 
     // If the fiber is clamped and shortening, then the fiber is either shorter
     // than the pennation model allows or shorter than the active-force-length
@@ -1353,7 +1383,7 @@ isFiberStateClamped(double lce, double dlceN) const
 
 double Millard2012EquilibriumMuscle::clampFiberLength(double lce) const
 {   
-    return max(lce, getMinimumFiberLength());
+    return max(lce, m_minimumFiberLength);
 }
 
 std::pair<Millard2012EquilibriumMuscle::StatusFromEstimateMuscleFiberState,
@@ -726,6 +726,34 @@ private:
     double m_minimumFiberLength;
     double m_minimumFiberLengthAlongTendon;
 
+    // Parameters and curves read when evaluating the muscle. These are cached
+    // in extendFinalizeFromProperties() so that the calc*Info() methods use
+    // plain member access instead of going through the Property system. If a
+    // property is edited without finalizing the muscle (e.g., by a
+    // MocoParameter, when initSystem() is not invoked), getParameters()
+    // copies the parameters again.
+    struct Parameters {
+        double maxIsometricForce = SimTK::NaN;
+        double optimalFiberLength = SimTK::NaN;
+        double tendonSlackLength = SimTK::NaN;
+        double maxContractionVelocity = SimTK::NaN;
+        double fiberDamping = SimTK::NaN;
+        bool ignoreTendonCompliance = false;
+        bool ignoreActivationDynamics = false;
+    };
+    mutable Parameters m_params;
+    void updateParameters() const;
+    const Parameters& getParameters() const {
+        if (!isObjectUpToDateWithProperties()) updateParameters();
+        return m_params;
+    }
+    SimTK::ReferencePtr<const ActiveForceLengthCurve> m_falCurve;
+    SimTK::ReferencePtr<const ForceVelocityCurve> m_fvCurve;
+    SimTK::ReferencePtr<const FiberForceLengthCurve> m_fpeCurve;
+    SimTK::ReferencePtr<const TendonForceLengthCurve> m_fseCurve;
+    SimTK::ReferencePtr<const MuscleFixedWidthPennationModel> m_penMdl;
+    SimTK::ReferencePtr<const MuscleFirstOrderActivationDynamicModel> m_actMdl;
+
     // Returns true if the fiber length is currently shorter than the minimum
     // value allowed by the pennation model and the active force length curve
     bool isFiberStateClamped(double lce, double dlceN) const;
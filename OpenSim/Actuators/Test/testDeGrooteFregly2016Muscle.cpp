@@ -1085,3 +1085,116 @@ TEST_CASE("DeGrooteFregly2016Muscle basics") {
         CHECK(state.getY()[2] == Approx(0.451));
     }
 }
+
+TEST_CASE("DeGrooteFregly2016Muscle batch evaluation") {
+    // Muscles with the same tendon compliance settings are evaluated
+    // together; the results must match those computed by each muscle on its
+    // own.
+    auto evaluate = [](bool batch, bool ignoreTendonCompliance,
+                            const std::string& mode) {
+        Model model;
+        auto* body = new Body("body", 0.5, SimTK::Vec3(0), SimTK::Inertia(0));
+        model.addComponent(body);
+        auto* joint = new SliderJoint("joint", model.getGround(), *body);
+        auto& coord = joint->updCoordinate(SliderJoint::Coord::TranslationX);
+        coord.setName("x");
+        model.addComponent(joint);
+        for (int i = 0; i < 4; ++i) {
+            auto* muscle = new DeGrooteFregly2016Muscle();
+            muscle->setName("muscle" + std::to_string(i));
+            muscle->set_max_isometric_force(500 + 100 * i);
+            muscle->set_optimal_fiber_length(0.10 + 0.01 * i);
+            muscle->set_tendon_slack_length(0.20 - 0.01 * i);
+            muscle->set_pennation_angle_at_optimal(0.05 * i);
+            muscle->set_active_force_width_scale(1.0 + 0.1 * i);
+            muscle->set_fiber_damping(0.01 * i);
+            muscle->set_ignore_passive_fiber_force(i == 2);
+            muscle->set_ignore_activation_dynamics(i == 3);
+            muscle->set_ignore_tendon_compliance(ignoreTendonCompliance);
+            muscle->set_tendon_compliance_dynamics_mode(mode);
+            muscle->setBatchEvaluation(batch);
+            muscle->addNewPathPoint("origin", model.updGround(),
+                    SimTK::Vec3(0, 0.01 * i, 0));
+            muscle->addNewPathPoint("insertion", *body, SimTK::Vec3(0));
+            model.addComponent(muscle);
+        }
+        // A muscle with different settings is not part of the batch.
+        auto* other = new DeGrooteFregly2016Muscle();
+        other->setName("other");
+        other->set_ignore_tendon_compliance(!ignoreTendonCompliance);
+        other->setBatchEvaluation(batch);
+        CHECK(DeGrooteFregly2016Muscle(*other).getBatchEvaluation() == batch);
+        other->addNewPathPoint("origin", model.updGround(), SimTK::Vec3(0));
+        other->addNewPathPoint("insertion", *body, SimTK::Vec3(0));
+        model.addComponent(other);
+
+        SimTK::State state = model.initSystem();
+        // Editing a property without reconnecting the model (as
+        // MocoParameter does) affects the batch.
+        auto& muscle1 = model.updComponent<DeGrooteFregly2016Muscle>("muscle1");
+        muscle1.set_max_isometric_force(1500);
+        coord.setValue(state, 0.29);
+        coord.setSpeedValue(state, -0.1);
+        int i = 0;
+        for (const auto& muscle :
+                model.getComponentList<DeGrooteFregly2016Muscle>()) {
+            muscle.setActivation(state, 0.3 + 0.1 * i);
+            muscle.setNormalizedTendonForce(state, 0.4 + 0.05 * i);
+            if (muscle.getImplicitEnabledNormalizedTendonForce(state)) {
+                muscle.setDiscreteVariableValue(state,
+                        DeGrooteFregly2016Muscle::
+                                getImplicitDynamicsDerivativeName(),
+                        0.1 * i);
+            }
+            ++i;
+        }
+        model.realizeAcceleration(state);
+        if (!ignoreTendonCompliance) {
+            CHECK(muscle1.getTendonForce(state) == Approx(1500 * 0.45));
+        }
+
+        std::vector<double> values;
+        for (const auto& muscle :
+                model.getComponentList<DeGrooteFregly2016Muscle>()) {
+            values.push_back(muscle.getFiberLength(state));
+            values.push_back(muscle.getTendonLength(state));
+            values.push_back(muscle.getPennationAngle(state));
+            values.push_back(muscle.getActiveForceLengthMultiplier(state));
+            values.push_back(muscle.getPassiveForceMultiplier(state));
+            values.push_back(muscle.getFiberVelocity(state));
+            values.push_back(muscle.getTendonVelocity(state));
+            values.push_back(muscle.getForceVelocityMultiplier(state));
+            values.push_back(muscle.getPennationAngularVelocity(state));
+            values.push_back(muscle.getActivation(state));
+            values.push_back(muscle.getFiberForce(state));
+            values.push_back(muscle.getTendonForce(state));
+            values.push_back(muscle.getFiberStiffnessAlongTendon(state));
+            values.push_back(muscle.getTendonStiffness(state));
+            values.push_back(muscle.getMuscleStiffness(state));
+            values.push_back(muscle.getFiberActivePower(state));
+            values.push_back(muscle.getTendonPower(state));
+            values.push_back(muscle.getPassiveFiberDampingForce(state));
+            values.push_back(
+                    muscle.getImplicitResidualNormalizedTendonForce(state));
+        }
+        return values;
+    };
+
+    for (const bool ignoreTendonCompliance : {true, false}) {
+        for (const std::string mode : {"explicit", "implicit"}) {
+            CAPTURE(ignoreTendonCompliance, mode);
+            const auto batched = evaluate(true, ignoreTendonCompliance, mode);
+            const auto unbatched =
+                    evaluate(false, ignoreTendonCompliance, mode);
+            REQUIRE(batched.size() == unbatched.size());
+            for (size_t i = 0; i < batched.size(); ++i) {
+                CAPTURE(i);
+                if (std::isnan(unbatched[i])) {
+                    CHECK(std::isnan(batched[i]));
+                } else {
+                    CHECK(batched[i] == Approx(unbatched[i]).margin(1e-10));
+                }
+            }
+        }
+    }
+}
@@ -103,6 +103,9 @@ void testDelp1990Muscle();
 
 void testMuscleEquilibriumSolve(const Model& model, const Storage& statesStore);
 
+template <typename MuscleType>
+void testMuscleParameterCache(MuscleType* muscle);
+
 int main()
 {
     SimTK::Array_<std::string> failures;
@@ -837,6 +840,9 @@ void testThelen2003Muscle()
         muscle->setMinimumActivation(0.01);
         model.finalizeFromProperties();
     }
+
+    testMuscleParameterCache(new Thelen2003Muscle("mcl", MaxIsometricForce0,
+            OptimalFiberLength0, TendonSlackLength0, PennationAngle0));
 }
 
 
@@ -946,6 +952,10 @@ void testMillard2012EquilibriumMuscle()
         muscle->setMinimumActivation(0.01);
         model.finalizeFromProperties();
     }
+
+    testMuscleParameterCache(new Millard2012EquilibriumMuscle("mcl",
+            MaxIsometricForce0, OptimalFiberLength0, TendonSlackLength0,
+            PennationAngle0));
 }
 
 void testMillard2012AccelerationMuscle()
@@ -1149,3 +1159,52 @@ void testMuscleEquilibriumSolve(const Model& model, const Storage& statesStore)
         }
     }
 }
+
+/* Thelen2003Muscle and Millard2012EquilibriumMuscle cache parameters derived
+from their properties in extendFinalizeFromProperties(). Ensure the cache
+follows edits to the properties, including edits made without finalizing the
+muscle (as MocoParameter does), and is rebuilt in copies of the model. */
+template <typename MuscleType>
+void testMuscleParameterCache(MuscleType* muscle)
+{
+    Model model;
+    // Stretch the tendon 5% beyond its slack length.
+    const double pathLength = OptimalFiberLength0 + 1.05*TendonSlackLength0;
+    muscle->addNewPathPoint("p1", model.updGround(), SimTK::Vec3(0));
+    muscle->addNewPathPoint("p2", model.updGround(),
+                            SimTK::Vec3(0, 0, pathLength));
+    model.addForce(muscle);
+
+    auto calcTendonForce = [](Model& aModel) {
+        SimTK::State& state = aModel.initSystem();
+        auto mcl = aModel.getComponentList<MuscleType>().begin();
+        mcl->setActivation(state, 0.5);
+        mcl->setFiberLength(state, OptimalFiberLength0);
+        aModel.realizeDynamics(state);
+        return mcl->getTendonForce(state);
+    };
+
+    const double tendonForce = calcTendonForce(model);
+    ASSERT(tendonForce > 0, __FILE__, __LINE__,
+           "Expected the tendon to be stretched.");
+
+    Model copy(model);
+    ASSERT_EQUAL(tendonForce, calcTendonForce(copy), 1e-10,
+                 __FILE__, __LINE__, "Copied model has a different force.");
+
+    muscle->setMaxIsometricForce(2*MaxIsometricForce0);
+    ASSERT_EQUAL(2*tendonForce, calcTendonForce(model), 1e-10*tendonForce,
+                 __FILE__, __LINE__,
+                 "Cached parameters were not updated from the properties.");
+
+    SimTK::State& state = model.initSystem();
+    muscle->setActivation(state, 0.5);
+    muscle->setFiberLength(state, OptimalFiberLength0);
+    model.realizeDynamics(state);
+    muscle->setMaxIsometricForce(MaxIsometricForce0);
+    state.invalidateAllCacheAtOrAbove(SimTK::Stage::Position);
+    model.realizeDynamics(state);
+    ASSERT_EQUAL(tendonForce, muscle->getTendonForce(state),
+                 1e-10*tendonForce, __FILE__, __LINE__,
+                 "Cached parameters were not updated without finalizing.");
+}
@@ -142,6 +142,43 @@ void Thelen2003Muscle::extendFinalizeFromProperties()
         actMdl = actMdlCopy;
         throw;
     }
+
+    // Cache the parameters used when evaluating the muscle.
+    m_pennMdl.reset(&pennMdl);
+    m_actMdl.reset(&actMdl);
+
+    updateParameters();
+}
+
+void Thelen2003Muscle::updateParameters() const
+{
+    m_params.maxIsometricForce = getMaxIsometricForce();
+    m_params.optimalFiberLength = getOptimalFiberLength();
+    m_params.tendonSlackLength = getTendonSlackLength();
+    m_params.maxContractionVelocity = getMaxContractionVelocity();
+    m_params.fmaxTendonStrain = get_FmaxTendonStrain();
+    m_params.fmaxMuscleStrain = get_FmaxMuscleStrain();
+    m_params.kShapeActive = get_KshapeActive();
+    m_params.kShapePassive = get_KshapePassive();
+    m_params.af = get_Af();
+    m_params.flen = get_Flen();
+    m_params.fvLinearExtrapThreshold = get_fv_linear_extrap_threshold();
+    m_params.expKShapePassive = exp(m_params.kShapePassive);
+
+    /*The paper reports etoe = 0.609e0, however, this is a severely rounded off
+        The exact answer, to SimTK::Eps is
+        etoe =  99*e0*e^3 / ( 166*e^3 - 67)
+        klin =  67 /( 100*(e0 - (99*e0*e^3)/(166*e^3-67)) )
+        See thelenINIT_20120127.mw for details
+    */
+    const double e0 = m_params.fmaxTendonStrain;
+    const double t1 = exp(0.3e1);
+    m_params.tendonToeStrain = (0.99e2*e0*t1) / (0.166e3*t1 - 0.67e2);
+    m_params.tendonLinearStiffness = (0.67e2/0.100e3)
+                * 1.0/(e0 - (0.99e2*e0*t1) / (0.166e3*t1 - 0.67e2));
+
+    m_params.minimumFiberLength = m_pennMdl->getMinimumFiberLength();
+    m_params.parallelogramHeight = m_pennMdl->getParallelogramHeight();
 }
 
 //====================================================================
@@ -381,25 +418,26 @@ void Thelen2003Muscle::computeInitialFiberEquilibrium(SimTK::State& s) const
 void Thelen2003Muscle::calcMuscleLengthInfo(const SimTK::State& s,
                                             MuscleLengthInfo& mli) const
 {    
+    const Parameters& params = getParameters();
     try{
-        double optFiberLength   = getOptimalFiberLength();
+        const MuscleFixedWidthPennationModel& pennMdl = *m_pennMdl;
+        double optFiberLength   = params.optimalFiberLength;
         double mclLength        = getLength(s);
-        double tendonSlackLen   = getTendonSlackLength();
+        double tendonSlackLen   = params.tendonSlackLength;
 
         //Clamp the minimum fiber length to its minimum physical value.
-        mli.fiberLength  = getPennationModel().clampFiberLength(
+        mli.fiberLength  = pennMdl.clampFiberLength(
                                 getStateVariableValue(s, STATE_FIBER_LENGTH_NAME));
 
         mli.normFiberLength = mli.fiberLength/optFiberLength;       
-        mli.pennationAngle  = getPennationModel()
-                              .calcPennationAngle(mli.fiberLength);
+        mli.pennationAngle  = pennMdl.calcPennationAngle(mli.fiberLength);
 
         mli.cosPennationAngle = cos(mli.pennationAngle);
         mli.sinPennationAngle = sin(mli.pennationAngle);
 
         mli.fiberLengthAlongTendon = mli.fiberLength*mli.cosPennationAngle;
     
-        mli.tendonLength      = getPennationModel().calcTendonLength(
+        mli.tendonLength      = pennMdl.calcTendonLength(
                                     mli.cosPennationAngle,
                                     mli.fiberLength,mclLength );
         mli.normTendonLength  = mli.tendonLength / tendonSlackLen;
@@ -442,14 +480,16 @@ void Thelen2003Muscle::calcMusclePotentialEnergyInfo(const SimTK::State& s,
 void Thelen2003Muscle::calcFiberVelocityInfo(const SimTK::State& s, 
                                                FiberVelocityInfo& fvi) const
 {
+    const Parameters& params = getParameters();
     try{
         //Get the quantities that we've already computed
             const MuscleLengthInfo &mli = getMuscleLengthInfo(s);
 
         //Get the static properties of this muscle
             // double mclLength      = getLength(s);
-            double tendonSlackLen = getTendonSlackLength();
-            double optFiberLen    = getOptimalFiberLength();
+            const MuscleFixedWidthPennationModel& pennMdl = *m_pennMdl;
+            double tendonSlackLen = params.tendonSlackLength;
+            double optFiberLen    = params.optimalFiberLength;
         //=========================================================================
         // Compute fv by inverting the force-velocity relationship in the 
         // equilibrium equations
@@ -458,7 +498,7 @@ void Thelen2003Muscle::calcFiberVelocityInfo(const SimTK::State& s,
         //1. Get fiber/tendon kinematic information
 
         //clamp activation to a legal range
-        double a = getActivationModel().clampActivation(getStateVariableValue(s,
+        double a = m_actMdl->clampActivation(getStateVariableValue(s,
                                           STATE_ACTIVATION_NAME));
    
 
@@ -509,13 +549,12 @@ void Thelen2003Muscle::calcFiberVelocityInfo(const SimTK::State& s,
                                               //is clamped
         double fv     = afalfv/(a*fal);
         double dlceN  = calcdlceN(a,fal,afalfv);
-        double dlce   = dlceN*getMaxContractionVelocity()*optFiberLen;
+        double dlce   = dlceN*params.maxContractionVelocity*optFiberLen;
         double tanPhi = tan(phi);
-        double dphidt = getPennationModel().calcPennationAngularVelocity(
-                                            tanPhi,lce,dlce);
-        double dlceAT = getPennationModel().calcFiberVelocityAlongTendon(
+        double dphidt = pennMdl.calcPennationAngularVelocity(tanPhi,lce,dlce);
+        double dlceAT = pennMdl.calcFiberVelocityAlongTendon(
                             lce, dlce, sinphi, cosphi, dphidt);
-        double dtl    = getPennationModel().calcTendonVelocity(
+        double dtl    = pennMdl.calcTendonVelocity(
                             cosphi, sinphi, dphidt, lce, dlce, dmcldt);
     
     
@@ -540,7 +579,7 @@ void Thelen2003Muscle::calcFiberVelocityInfo(const SimTK::State& s,
         fvi.pennationAngularVelocity    = dphidt;
 
         fvi.tendonVelocity              = dtl;
-        fvi.normTendonVelocity          = dtl/getTendonSlackLength();
+        fvi.normTendonVelocity          = dtl/tendonSlackLen;
 
         fvi.fiberForceVelocityMultiplier = fv;
 
@@ -565,22 +604,23 @@ void Thelen2003Muscle::calcFiberVelocityInfo(const SimTK::State& s,
 void Thelen2003Muscle::calcMuscleDynamicsInfo(const SimTK::State& s, 
                                                MuscleDynamicsInfo& mdi) const
 {
+    const Parameters& params = getParameters();
     try {
         //Get the quantities that we've already computed
         const MuscleLengthInfo &mli = getMuscleLengthInfo(s);
         const FiberVelocityInfo &mvi = getFiberVelocityInfo(s);
         //Get the static properties of this muscle
         // double mclLength      = getLength(s);
-        double tendonSlackLen = getTendonSlackLength();
-        double optFiberLen    = getOptimalFiberLength();
-        double fiso           = getMaxIsometricForce();
-        double penHeight      = getPennationModel().getParallelogramHeight();
+        double tendonSlackLen = params.tendonSlackLength;
+        double optFiberLen    = params.optimalFiberLength;
+        double fiso           = params.maxIsometricForce;
+        double penHeight      = params.parallelogramHeight;
 
         //=========================================================================
         // Compute required quantities
         //=========================================================================
         //1. Get fiber/tendon kinematic information
-        double a = getActivationModel().clampActivation(
+        double a = m_actMdl->clampActivation(
                        getStateVariableValue(s, STATE_ACTIVATION_NAME) );
 
         double lce      = mli.fiberLength;
@@ -685,12 +725,13 @@ double Thelen2003Muscle::getMinimumFiberLength() const
 bool Thelen2003Muscle::
     isFiberStateClamped(const SimTK::State& s, double dlceN) const
 {
+    const Parameters& params = getParameters();
     bool clamped = false;
 
     //Is the fiber length  clamped and it is shortening, then the fiber length
     //not valid
     if( (getStateVariableValue(s, STATE_FIBER_LENGTH_NAME) 
-            <= getMinimumFiberLength())
+            <= params.minimumFiberLength)
         && dlceN <= 0){
         clamped = true;
     }
@@ -708,7 +749,7 @@ double Thelen2003Muscle::calcActivationRate(const SimTK::State& s) const
 {    
     double excitation = getExcitation(s);
     double activation = getActivation(s);
-    double dadt = getActivationModel().calcDerivative(activation,excitation);
+    double dadt = m_actMdl->calcDerivative(activation,excitation);
     return dadt;
 }  
 
@@ -1278,22 +1319,14 @@ void Thelen2003Muscle::
 
 double Thelen2003Muscle::calcfse(const double tlN) const 
 {
+    const Parameters& params = getParameters();
     double x = tlN-1;
-    double e0 = get_FmaxTendonStrain();
-    
-    /*The paper reports etoe = 0.609e0, however, this is a severely rounded off
-        The exact answer, to SimTK::Eps is   
-        etoe =  99*e0*e^3 / ( 166*e^3 - 67)
-        klin =  67 /( 100*(e0 - (99*e0*e^3)/(166*e^3-67)) )
-        See thelenINIT_20120127.mw for details
-    */    
+
+    // eToe and klin are computed in extendFinalizeFromProperties().
     double kToe = 3.0;
     double Ftoe = 33.0/100.0;
-    double t1   = exp(0.3e1);
-    double eToe = (0.99e2*e0*t1) / (0.166e3*t1 - 0.67e2);
-    t1 = exp(0.3e1);
-    double klin = (0.67e2/0.100e3) 
-                * 1.0/(e0 - (0.99e2*e0*t1) / (0.166e3*t1 - 0.67e2));
+    double eToe = params.tendonToeStrain;
+    double klin = params.tendonLinearStiffness;
 
     //Compute tendon force
     double fse = 0;
@@ -1309,28 +1342,14 @@ double Thelen2003Muscle::calcfse(const double tlN) const
 
 
 double Thelen2003Muscle::calcDfseDtlN(const double tlN) const {
+    const Parameters& params = getParameters();
     double x = tlN-1;
-    double e0 = get_FmaxTendonStrain();
-    
-    /*The paper reports etoe = 0.609e0, however, this is a severely rounded off
-    result of the exact answer:    
-        etoe =  99*e0*e^3 / ( 166*e^3 - 67)
-        See thelenINIT_20120127.mw for details
-    */
+
+    // eToe and klin are computed in extendFinalizeFromProperties().
     double kToe = 3.0;
     double Ftoe = 33.0/100.0;
-
-    double t1   = exp(0.3e1);
-    double eToe = (0.99e2*e0*t1) / (0.166e3*t1 - 0.67e2);
-
-    /*The paper reports etoe = 0.609e0, however, this is a severely rounded off
-    result of the exact answer:    
-        klin =  67 /( 100*(e0 - (99*e0*e^3)/(166*e^3-67)) )
-        See thelenINIT_20120127.mw for details
-    */
-    t1 = exp(0.3e1);
-    double klin = (0.67e2/0.100e3) 
-                * 1.0/(e0 - (0.99e2*e0*t1) / (0.166e3*t1 - 0.67e2));
+    double eToe = params.tendonToeStrain;
+    double klin = params.tendonLinearStiffness;
 
     //Compute tendon force
     double dfse_d_dtlN = 0;
@@ -1346,32 +1365,23 @@ double Thelen2003Muscle::calcDfseDtlN(const double tlN) const {
 
 double Thelen2003Muscle::calcfsefisoPE(double tendonStrain) const
 {
+    const Parameters& params = getParameters();
 
     double tendon_strain =  tendonStrain;
-    double fmaxTendonStrain = get_FmaxTendonStrain();       
-
-    //Future optimization opportunity: precompute kToe, fToe, eToe and klin
-    //when the muscle is initialized. Store these values rather than 
-    //computing them every time.
 
+    // eToe and klin are computed in extendFinalizeFromProperties().
     double kToe = 3.0;
     double Ftoe = 33.0/100.0;
-
-    double t1   = exp(0.3e1);
-    double eToe = (0.99e2*fmaxTendonStrain*t1) / (0.166e3*t1 - 0.67e2);
-
-    t1 = exp(0.3e1);
-    double klin = (0.67e2/0.100e3) 
-                * 1.0/(fmaxTendonStrain - (0.99e2*fmaxTendonStrain*t1) 
-                / (0.166e3*t1 - 0.67e2));
+    double eToe = params.tendonToeStrain;
+    double klin = params.tendonLinearStiffness;
 
     //Compute the energy stored in the tendon. 
     //Integrals computed symbolically in muscle_kepew_20111021.mw just to check
     double tendonPE = 0.0;
-    double lenR        = getTendonSlackLength();
+    double lenR        = params.tendonSlackLength;
     double lenTdn    = (tendon_strain+1)*lenR;
     double lenToe    = (eToe+1.0)*lenR;    
-    double fiso        = getMaxIsometricForce();
+    double fiso        = params.maxIsometricForce;
 
     if (tendon_strain>eToe){
        //compute the energy stored in the toe portion of the tendon strain curve
@@ -1423,13 +1433,15 @@ double Thelen2003Muscle::calcfsefisoPE(double tendonStrain) const
 //
 //==============================================================================
 double Thelen2003Muscle::calcfal(const double lceN) const{       
-    double kShapeActive = get_KshapeActive();   
+    const Parameters& params = getParameters();
+    double kShapeActive = params.kShapeActive;
     double x=(lceN-1.)*(lceN-1.);
     double fal = exp(-x/kShapeActive);
     return fal;
 }
 double Thelen2003Muscle::calcDfalDlceN(const double lceN) const {
-    double kShapeActive = get_KshapeActive();   
+    const Parameters& params = getParameters();
+    double kShapeActive = params.kShapeActive;
     double t1 = lceN - 0.10e1;
     double t2 = 0.1e1 / kShapeActive;
     double t4 = t1 * t1;
@@ -1444,28 +1456,30 @@ double Thelen2003Muscle::calcDfalDlceN(const double lceN) const {
 //
 //=============================================================================
 double Thelen2003Muscle::calcfpe(const double lceN) const {
+    const Parameters& params = getParameters();
     double fpe = 0;
-    double e0 = get_FmaxMuscleStrain();
-    double kpe = get_KshapePassive();
+    double e0 = params.fmaxMuscleStrain;
+    double kpe = params.kShapePassive;
 
     //Compute the passive force developed by the muscle
     if(lceN > 1.0){
         double t5 = exp(kpe * (lceN - 0.10e1) / e0);
-        double t7 = exp(kpe);
+        double t7 = params.expKShapePassive;
         fpe = (t5 - 0.10e1) / (t7 - 0.10e1);
     }
     return fpe;
 }
 
 double Thelen2003Muscle::calcDfpeDlceN(const double lceN) const {
+    const Parameters& params = getParameters();
     double dfpe_d_lceN = 0;
-    double e0 = get_FmaxMuscleStrain();
-    double kpe = get_KshapePassive();
+    double e0 = params.fmaxMuscleStrain;
+    double kpe = params.kShapePassive;
 
     if(lceN > 1.0){
         double t1 = 0.1e1 / e0;
         double t6 = exp(kpe * (lceN - 0.10e1) * t1);
-        double t7 = exp(kpe);
+        double t7 = params.expKShapePassive;
         dfpe_d_lceN = kpe * t1 * t6 / (t7 - 0.10e1);
     }
     return dfpe_d_lceN;
@@ -1473,15 +1487,16 @@ double Thelen2003Muscle::calcDfpeDlceN(const double lceN) const {
 
 double Thelen2003Muscle::calcfpefisoPE(double lceN) const
 {
-    double fmaxMuscleStrain = get_FmaxMuscleStrain();
-    double kShapePassive = get_KshapePassive();
+    const Parameters& params = getParameters();
+    double fmaxMuscleStrain = params.fmaxMuscleStrain;
+    double kShapePassive = params.kShapePassive;
 
     double musclePE = 0.0;
     //Compute the potential energy stored in the muscle
     if(lceN > 1.0){
         //Shorter variable names to make the equations readable.
-        double lenR = getOptimalFiberLength();
-        double fiso = getMaxIsometricForce();
+        double lenR = params.optimalFiberLength;
+        double fiso = params.maxIsometricForce;
         double len = lceN*lenR;        
         double kpe = kShapePassive;
         double e0 = fmaxMuscleStrain;
@@ -1514,15 +1529,16 @@ double Thelen2003Muscle::calcfpefisoPE(double lceN) const
 
 double Thelen2003Muscle::calcdlceN(double act,double fal,double actFalFv) const
 {
+    const Parameters& params = getParameters();
     //The variable names have all been switched to closely match 
     //with the notation in Thelen 2003.
     double dlceN = 0.0;      //contractile element velocity    
-    double af   = get_Af();
+    double af   = params.af;
 
     double a    = act;
     double afl  = a*fal; //afl = a*fl
     double Fm   = actFalFv;     //Fm = a*fl*fv    
-    double flen = get_Flen();
+    double flen = params.flen;
     // double Fmlen_afl = flen*afl;
 
     double dlcedFm = 0.0; //partial derivative of contractile element
@@ -1534,7 +1550,7 @@ double Thelen2003Muscle::calcdlceN(double act,double fal,double actFalFv) const
     double Fm_asyC = 0;           //Concentric contraction asymptote
     double Fm_asyE = afl*flen;    
                                 //Eccentric contraction asymptote
-    double asyE_thresh = get_fv_linear_extrap_threshold();
+    double asyE_thresh = params.fvLinearExtrapThreshold;
 
     //If fv is in the appropriate region, use 
     //Thelen 2003 Eqns 6 & 7 to compute dlceN
@@ -1599,15 +1615,16 @@ double Thelen2003Muscle::
 double Thelen2003Muscle::calcDdlceDaFalFv(double aAct, 
                                           double aFal, double aFalFv) const
 {
+    const Parameters& params = getParameters();
     //The variable names have all been switched to closely match with 
     //the notation in Thelen 2003.
     // double dlceN = 0.0;      //contractile element velocity    
-    double af   = get_Af();
+    double af   = params.af;
 
     double a    = aAct;
     double afl  = aAct*aFal;  //afl = a*fl
     double Fm   = aFalFv;    //Fm = a*fl*fv    
-    double flen = get_Flen();
+    double flen = params.flen;
     // double Fmlen_afl = flen*aAct*aFal;
 
     double dlcedFm = 0.0; //partial derivative of contractile element 
@@ -1619,7 +1636,7 @@ double Thelen2003Muscle::calcDdlceDaFalFv(double aAct,
     double Fm_asyC = 0;           //Concentric contraction asymptote
     double Fm_asyE = aAct*aFal*flen;    
                                 //Eccentric contraction asymptote
-    double asyE_thresh = get_fv_linear_extrap_threshold();
+    double asyE_thresh = params.fvLinearExtrapThreshold;
 
     //If fv is in the appropriate region, use 
     //Thelen 2003 Eqns 6 & 7 to compute dlceN
@@ -296,6 +296,43 @@ private:
     MemberSubcomponentIndex actMdlIdx{
       constructSubcomponent<MuscleFirstOrderActivationDynamicModel>("actMdl") };
 
+    // Parameters read by the calc*Info() methods and the curve functions
+    // below. They are copied from the properties (and the constants of the
+    // tendon curve are derived from them) in extendFinalizeFromProperties(),
+    // so that evaluating the muscle does not go through the Property system.
+    // If a property is edited without finalizing the muscle (e.g., by a
+    // MocoParameter, when initSystem() is not invoked), getParameters()
+    // copies them again.
+    struct Parameters {
+        double maxIsometricForce = SimTK::NaN;
+        double optimalFiberLength = SimTK::NaN;
+        double tendonSlackLength = SimTK::NaN;
+        double maxContractionVelocity = SimTK::NaN;
+        double fmaxTendonStrain = SimTK::NaN;
+        double fmaxMuscleStrain = SimTK::NaN;
+        double kShapeActive = SimTK::NaN;
+        double kShapePassive = SimTK::NaN;
+        double af = SimTK::NaN;
+        double flen = SimTK::NaN;
+        double fvLinearExtrapThreshold = SimTK::NaN;
+        // exp(kShapePassive).
+        double expKShapePassive = SimTK::NaN;
+        // Strain at the end of the toe region of the tendon force-length
+        // curve, and the stiffness of its linear region.
+        double tendonToeStrain = SimTK::NaN;
+        double tendonLinearStiffness = SimTK::NaN;
+        double minimumFiberLength = SimTK::NaN;
+        double parallelogramHeight = SimTK::NaN;
+    };
+    mutable Parameters m_params;
+    void updateParameters() const;
+    const Parameters& getParameters() const {
+        if (!isObjectUpToDateWithProperties()) updateParameters();
+        return m_params;
+    }
+    SimTK::ReferencePtr<const MuscleFixedWidthPennationModel> m_pennMdl;
+    SimTK::ReferencePtr<const MuscleFirstOrderActivationDynamicModel> m_actMdl;
+
     //=====================================================================
     // Private Computation
     //      -Computes curve values, derivatives and integrals
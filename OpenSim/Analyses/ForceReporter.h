@@ -118,6 +118,7 @@ public:
     int begin(const SimTK::State& s ) override;
     int step(const SimTK::State& s, int setNumber ) override;
     int end(const SimTK::State& s ) override;
+    bool canRecordOnModelCopy() const override { return true; }
 
 protected:
     virtual int
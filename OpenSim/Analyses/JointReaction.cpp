@@ -168,6 +168,7 @@ setNull()
     _inFrame[0] = "ground";
 
     _storeActuation = NULL;
+    _storageList.append(&_storeReactionLoads);
 
 }
 //_____________________________________________________________________________
@@ -394,11 +394,13 @@ record(const SimTK::State& s)
         optimizer->optimize(_parameters);
     }
     catch (const SimTK::Exception::Base& ex) {
-        log_warn(ex.getMessage());
-        log_warn("OPTIMIZATION FAILED...");
-        log_warn("StaticOptimization.record: The optimizer could not find a "
-                 "solution at time = {}.",
-                s.getTime());
+        // An infeasible motion makes the optimizer fail at every time step,
+        // so only log some of the failures.
+        const long logEveryN = 100;
+        OPENSIM_LOG_WARN_EVERY_N(logEveryN,
+                "StaticOptimization.record: OPTIMIZATION FAILED; the optimizer "
+                "could not find a solution at time = {}: {}",
+                s.getTime(), ex.getMessage());
 
         double tolBounds = 1e-1;
         bool weakModel = false;
@@ -441,7 +443,7 @@ record(const SimTK::State& s)
                 }
             }
         }
-        if(weakModel) log_warn(msgWeak);
+        if(weakModel) OPENSIM_LOG_WARN_EVERY_N(logEveryN, msgWeak);
 
         if(!weakModel) {
             double tolConstraints = 1e-6;
@@ -466,7 +468,9 @@ record(const SimTK::State& s)
                 }
             }
             _forceReporter->step(sWorkingCopy, 1);
-            if(incompleteModel) log_warn(msgIncomplete);
+            if(incompleteModel) {
+                OPENSIM_LOG_WARN_EVERY_N(logEveryN, msgIncomplete);
+            }
         }
     }
 
@@ -0,0 +1,374 @@
+/* -------------------------------------------------------------------------- *
+ *                       OpenSim:  benchmarkOpenSim.cpp                        *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * See http://opensim.stanford.edu and the NOTICE file for more information.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2005-2020 Stanford University and the Authors                *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+// Timed scenarios on reference models, for detecting performance regressions
+// across commits. Each scenario runs in the subdirectory holding its data
+// files (copied there by CMake). Results are printed as a table and, with
+// --output, written as JSON:
+//
+//     benchmarkOpenSim [--filter <substring>] [--repetitions <n>]
+//                      [--output <file.json>]
+//
+// Rates (e.g., frames per second) are computed from the fastest repetition.
+// Peak resident memory is that of the whole process after the scenario, so it
+// only grows from one scenario to the next; run a single scenario with
+// --filter to measure its peak memory alone.
+
+#include <OpenSim/Actuators/DeGrooteFregly2016Muscle.h>
+#include <OpenSim/Actuators/ModelOperators.h>
+#include <OpenSim/Analyses/StaticOptimization.h>
+#include <OpenSim/Auxiliary/getRSS.h>
+#include <OpenSim/Common/About.h>
+#include <OpenSim/Common/Constant.h>
+#include <OpenSim/Common/GCVSplineSet.h>
+#include <OpenSim/Common/IO.h>
+#include <OpenSim/Common/Stopwatch.h>
+#include <OpenSim/Moco/osimMoco.h>
+#include <OpenSim/Simulation/InverseDynamicsSolver.h>
+#include <OpenSim/Simulation/InverseKinematicsSolver.h>
+#include <OpenSim/Simulation/Manager/Manager.h>
+#include <OpenSim/Simulation/Model/Model.h>
+#include <OpenSim/Tools/AnalyzeTool.h>
+#include <OpenSim/Tools/CMCTool.h>
+
+#include <algorithm>
+#include <fstream>
+#include <functional>
+
+using namespace OpenSim;
+
+namespace {
+
+struct Benchmark {
+    std::string name;
+    /// Subdirectory (of the working directory) holding the data files.
+    std::string directory;
+    /// Unit of the amount of work returned by run(), e.g., "frames". If
+    /// empty, the result is the wall-clock time of the scenario.
+    std::string workUnit;
+    int defaultRepetitions;
+    /// Run the scenario once and return the amount of work done (e.g.,
+    /// the number of frames solved).
+    std::function<double()> run;
+};
+
+struct Result {
+    const Benchmark* benchmark;
+    std::vector<double> wallTimes;
+    double work;
+    std::size_t peakRSS;
+
+    double getBestWallTime() const {
+        return *std::min_element(wallTimes.begin(), wallTimes.end());
+    }
+    double getMedianWallTime() const {
+        std::vector<double> sorted = wallTimes;
+        std::sort(sorted.begin(), sorted.end());
+        return sorted[sorted.size() / 2];
+    }
+    double getValue() const {
+        return benchmark->workUnit.empty() ? getBestWallTime()
+                                           : work / getBestWallTime();
+    }
+    std::string getUnit() const {
+        return benchmark->workUnit.empty() ? "s" : benchmark->workUnit + "/s";
+    }
+};
+
+// Realize the full right-hand side of the equations of motion (all forces,
+// including the muscles) at perturbed states. If given, editModel is applied
+// to the model before it is initialized.
+double benchmarkRHS(const std::string& modelFile, int numEvaluations,
+        const std::function<void(Model&)>& editModel = {}) {
+    Model model(modelFile);
+    if (editModel) editModel(model);
+    SimTK::State state = model.initSystem();
+    model.equilibrateMuscles(state);
+    const SimTK::Vector q0 = state.getQ();
+    for (int i = 0; i < numEvaluations; ++i) {
+        // Changing q and u invalidates every stage from Position on.
+        state.setTime(1e-3 * i);
+        state.updQ() = q0;
+        state.updQ()[i % q0.size()] += 1e-3;
+        state.updU() = 1e-2 * (i % 7);
+        model.realizeAcceleration(state);
+    }
+    return numEvaluations;
+}
+
+// Integrate the unactuated arm26 model; the work is simulated seconds.
+double benchmarkForward() {
+    Model model("arm26.osim");
+    SimTK::State& state = model.initSystem();
+    model.equilibrateMuscles(state);
+    const double finalTime = 1.0;
+    Manager manager(model);
+    manager.setIntegratorAccuracy(1e-5);
+    manager.initialize(state);
+    manager.integrate(finalTime);
+    return finalTime;
+}
+
+double benchmarkIK() {
+    Model model("gait10dof18musc_subject01.osim");
+    SimTK::State& state = model.initSystem();
+    auto markersRef = std::make_shared<MarkersReference>(
+            "gait10dof18musc_walk_CRLF_line_ending.trc",
+            Set<MarkerWeight>(), Units(Units::Meters));
+    SimTK::Array_<CoordinateReference> coordinateRefs;
+    InverseKinematicsSolver ikSolver(model, markersRef, coordinateRefs);
+    ikSolver.setAccuracy(1e-5);
+    const auto& times = markersRef->getMarkerTable().getIndependentColumn();
+    // The trial is short, so track it several times.
+    const int numPasses = 20;
+    for (int pass = 0; pass < numPasses; ++pass) {
+        state.updTime() = times.front();
+        ikSolver.assemble(state);
+        for (std::size_t i = 1; i < times.size(); ++i) {
+            state.updTime() = times[i];
+            ikSolver.track(state);
+        }
+    }
+    return (double)numPasses * times.size();
+}
+
+double benchmarkID() {
+    Model model("gait10dof18musc_subject01.osim");
+    SimTK::State& state = model.initSystem();
+    Storage motion("gait10dof18musc_ik_CRLF_line_ending.mot");
+    if (motion.isInDegrees()) {
+        model.getSimbodyEngine().convertDegreesToRadians(motion);
+    }
+    GCVSplineSet splines(5, &motion);
+    FunctionSet coordinateFunctions;
+    for (const auto& coord : model.getComponentList<Coordinate>()) {
+        if (splines.contains(coord.getName())) {
+            coordinateFunctions.cloneAndAppend(splines.get(coord.getName()));
+        } else {
+            coordinateFunctions.adoptAndAppend(
+                    new Constant(coord.getDefaultValue()));
+        }
+    }
+    const double initialTime = motion.getFirstTime();
+    const double finalTime = motion.getLastTime();
+    const int numFrames = 1000;
+    SimTK::Array_<double> times(numFrames);
+    for (int i = 0; i < numFrames; ++i) {
+        times[i] = initialTime +
+                   (finalTime - initialTime) * i / (numFrames - 1);
+    }
+    InverseDynamicsSolver idSolver(model);
+    SimTK::Array_<SimTK::Vector> generalizedForces;
+    idSolver.solve(state, coordinateFunctions, times, generalizedForces);
+    return numFrames;
+}
+
+double benchmarkStaticOptimization() {
+    AnalyzeTool tool("arm26_Setup_StaticOptimization.xml");
+    tool.run();
+    auto& so = dynamic_cast<StaticOptimization&>(
+            tool.updAnalysisSet().get(0));
+    return so.getActivationStorage()->getSize();
+}
+
+double benchmarkCMC() {
+    CMCTool tool("arm26_Setup_CMC.xml");
+    tool.run();
+    return 0;
+}
+
+#ifdef OPENSIM_WITH_CASADI
+double benchmarkMocoInverse(const std::string& variableOrdering) {
+    MocoInverse inverse;
+    inverse.setModel(ModelProcessor("subject_walk_armless_18musc.osim") |
+                     ModOpReplaceJointsWithWelds(
+                             {"subtalar_r", "subtalar_l", "mtp_r", "mtp_l"}) |
+                     ModOpReplaceMusclesWithDeGrooteFregly2016() |
+                     ModOpIgnorePassiveFiberForcesDGF() |
+                     ModOpTendonComplianceDynamicsModeDGF("implicit") |
+                     ModOpAddExternalLoads(
+                             "subject_walk_armless_external_loads.xml"));
+    inverse.setKinematics(
+            TableProcessor("subject_walk_armless_coordinates.mot") |
+            TabOpLowPassFilter(6));
+    inverse.set_initial_time(0.450);
+    inverse.set_final_time(1.0);
+    inverse.set_kinematics_allow_extra_columns(true);
+    inverse.set_mesh_interval(0.025);
+    inverse.set_constraint_tolerance(1e-4);
+    inverse.set_convergence_tolerance(1e-4);
+    MocoStudy study = inverse.initialize();
+    study.updSolver<MocoCasADiSolver>().set_optim_variable_ordering(
+            variableOrdering);
+    study.solve();
+    return 0;
+}
+
+double benchmarkMocoTrack() {
+    MocoTrack track;
+    track.setModel(ModelProcessor("testMocoTrack_subject01.osim") |
+                   ModOpRemoveMuscles() | ModOpAddReserves(100) |
+                   ModOpAddExternalLoads("walk_gait1018_subject01_grf.xml"));
+    track.setStatesReference(
+            TableProcessor("walk_gait1018_state_reference.mot") |
+            TabOpLowPassFilter(6));
+    track.set_initial_time(0.01);
+    track.set_final_time(1.3);
+    track.solve();
+    return 0;
+}
+#endif
+
+std::vector<Benchmark> createBenchmarks() {
+    std::vector<Benchmark> benchmarks;
+    benchmarks.push_back({"rhs_gait10dof18musc", "shared", "evaluations", 5,
+            [] {
+                return benchmarkRHS("gait10dof18musc_subject01.osim", 2000);
+            }});
+    // 92 Thelen2003Muscles.
+    benchmarks.push_back({"rhs_gait2392", "shared", "evaluations", 5,
+            [] {
+                return benchmarkRHS("gait2392_pelvisFixed.osim", 500);
+            }});
+    // The same muscles as DeGrooteFregly2016Muscles, evaluated in a batch
+    // and each on its own.
+    for (bool batch : {true, false}) {
+        benchmarks.push_back({std::string("rhs_gait2392_degroote") +
+                                      (batch ? "" : "_unbatched"),
+                "shared", "evaluations", 5, [batch] {
+                    return benchmarkRHS("gait2392_pelvisFixed.osim", 500,
+                            [batch](Model& model) {
+                                DeGrooteFregly2016Muscle::replaceMuscles(
+                                        model);
+                                for (auto& muscle : model.updComponentList<
+                                             DeGrooteFregly2016Muscle>()) {
+                                    muscle.setBatchEvaluation(batch);
+                                }
+                            });
+                }});
+    }
+    benchmarks.push_back({"forward_arm26", "shared", "simulated seconds", 3,
+            benchmarkForward});
+    benchmarks.push_back({"ik_gait10dof18musc", "shared", "frames", 5,
+            benchmarkIK});
+    benchmarks.push_back({"id_gait10dof18musc", "shared", "frames", 5,
+            benchmarkID});
+    benchmarks.push_back({"so_arm26", "so", "frames", 3,
+            benchmarkStaticOptimization});
+    benchmarks.push_back({"cmc_arm26", "cmc", "", 1, benchmarkCMC});
+#ifdef OPENSIM_WITH_CASADI
+    benchmarks.push_back({"mocoinverse_subject_walk_armless_18musc", "moco",
+            "", 1, [] { return benchmarkMocoInverse("by-type"); }});
+    // The same problem with the NLP variables ordered by grid point (see
+    // MocoCasADiSolver's optim_variable_ordering).
+    benchmarks.push_back(
+            {"mocoinverse_subject_walk_armless_18musc_by_grid_point", "moco",
+                    "", 1,
+                    [] { return benchmarkMocoInverse("by-grid-point"); }});
+    benchmarks.push_back({"mocotrack_gait10dof18musc", "moco", "", 1,
+            benchmarkMocoTrack});
+#endif
+    return benchmarks;
+}
+
+void writeJSON(const std::string& filename,
+        const std::vector<Result>& results) {
+    std::ofstream stream(filename);
+    OPENSIM_THROW_IF(!stream.good(), Exception,
+            fmt::format("Could not open file '{}' for writing.", filename));
+    stream << "{\n";
+    stream << fmt::format("  \"opensim_version\": \"{}\",\n", GetVersion());
+    stream << fmt::format("  \"os\": \"{}\",\n", GetOSInfo());
+    stream << fmt::format("  \"compiler\": \"{}\",\n", GetCompilerVersion());
+    stream << "  \"results\": [";
+    for (std::size_t i = 0; i < results.size(); ++i) {
+        const auto& result = results[i];
+        stream << (i ? ",\n" : "\n");
+        stream << fmt::format("    {{\"name\": \"{}\", \"value\": {:.6g}, "
+                              "\"unit\": \"{}\", \"best_wall_time\": {:.6g}, "
+                              "\"median_wall_time\": {:.6g}, "
+                              "\"repetitions\": {}, \"peak_rss_bytes\": {}}}",
+                result.benchmark->name, result.getValue(), result.getUnit(),
+                result.getBestWallTime(), result.getMedianWallTime(),
+                result.wallTimes.size(), result.peakRSS);
+    }
+    stream << "\n  ]\n}\n";
+}
+
+} // anonymous namespace
+
+int main(int argc, char* argv[]) {
+    std::string filter;
+    std::string outputFile;
+    int repetitions = 0;
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        if (arg == "--filter" && i + 1 < argc) {
+            filter = argv[++i];
+        } else if (arg == "--repetitions" && i + 1 < argc) {
+            repetitions = std::stoi(argv[++i]);
+        } else if (arg == "--output" && i + 1 < argc) {
+            outputFile = argv[++i];
+        } else {
+            std::cout << "Usage: " << argv[0]
+                      << " [--filter <substring>] [--repetitions <n>]"
+                         " [--output <file.json>]"
+                      << std::endl;
+            return arg == "--help" || arg == "-h" ? 0 : 1;
+        }
+    }
+
+    try {
+        // The tools log every frame; only the benchmark results are of
+        // interest here.
+        Logger::setLevel(Logger::Level::Warn);
+        const std::string rootDir = IO::getCwd();
+        const auto benchmarks = createBenchmarks();
+        std::vector<Result> results;
+        for (const auto& benchmark : benchmarks) {
+            if (benchmark.name.find(filter) == std::string::npos) continue;
+            IO::chDir(rootDir + "/" + benchmark.directory);
+            Result result{&benchmark, {}, 0, 0};
+            const int numRepetitions =
+                    repetitions > 0 ? repetitions
+                                    : benchmark.defaultRepetitions;
+            for (int rep = 0; rep < numRepetitions; ++rep) {
+                Stopwatch watch;
+                result.work = benchmark.run();
+                result.wallTimes.push_back(watch.getElapsedTime());
+            }
+            result.peakRSS = getPeakRSS();
+            IO::chDir(rootDir);
+            log_cout("{:<42} {:>14.6g} {:<24} (best {:.3f} s, median {:.3f} "
+                     "s, peak RSS {} MB)",
+                    benchmark.name, result.getValue(), result.getUnit(),
+                    result.getBestWallTime(), result.getMedianWallTime(),
+                    result.peakRSS / (1024 * 1024));
+            results.push_back(std::move(result));
+        }
+        if (!outputFile.empty()) writeJSON(outputFile, results);
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
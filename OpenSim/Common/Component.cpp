@@ -24,6 +24,7 @@
 
 // INCLUDES
 #include "Component.h"
+#include "ComponentProfiler.h"
 #include "OpenSim/Common/IO.h"
 #include "XMLDocument.h"
 #include <unordered_map>
@@ -86,22 +87,46 @@ public:
         const override final
     {   _Component.extendRealizeInstance(s); }
     void realizeMeasureTimeVirtual(const SimTK::State& s) const override final
-    {   _Component.extendRealizeTime(s); }
+    {
+        ComponentProfiler::Scope scope(_Component,
+                ComponentProfiler::Category::RealizeTime);
+        _Component.extendRealizeTime(s);
+    }
     void realizeMeasurePositionVirtual(const SimTK::State& s)
         const override final
-    {   _Component.extendRealizePosition(s); }
+    {
+        ComponentProfiler::Scope scope(_Component,
+                ComponentProfiler::Category::RealizePosition);
+        _Component.extendRealizePosition(s);
+    }
     void realizeMeasureVelocityVirtual(const SimTK::State& s)
         const override final
-    {   _Component.extendRealizeVelocity(s); }
+    {
+        ComponentProfiler::Scope scope(_Component,
+                ComponentProfiler::Category::RealizeVelocity);
+        _Component.extendRealizeVelocity(s);
+    }
     void realizeMeasureDynamicsVirtual(const SimTK::State& s)
         const override final
-    {   _Component.extendRealizeDynamics(s); }
+    {
+        ComponentProfiler::Scope scope(_Component,
+                ComponentProfiler::Category::RealizeDynamics);
+        _Component.extendRealizeDynamics(s);
+    }
     void realizeMeasureAccelerationVirtual(const SimTK::State& s)
         const override final
-    {   _Component.extendRealizeAcceleration(s); }
+    {
+        ComponentProfiler::Scope scope(_Component,
+                ComponentProfiler::Category::RealizeAcceleration);
+        _Component.extendRealizeAcceleration(s);
+    }
     void realizeMeasureReportVirtual(const SimTK::State& s)
         const override final
-    {   _Component.extendRealizeReport(s); }
+    {
+        ComponentProfiler::Scope scope(_Component,
+                ComponentProfiler::Category::RealizeReport);
+        _Component.extendRealizeReport(s);
+    }
 
 private:
     const Component& _Component;
@@ -1505,7 +1530,12 @@ void Component::extendRealizeAcceleration(const SimTK::State& s) const
         const SimTK::Subsystem& subSys = getDefaultSubsystem();
 
         // evaluate and set component state derivative values (in cache) 
-        computeStateVariableDerivatives(s);
+        {
+            ComponentProfiler::Scope scope(*this,
+                    ComponentProfiler::Category::
+                            ComputeStateVariableDerivatives);
+            computeStateVariableDerivatives(s);
+        }
     
         std::map<std::string, StateVariableInfo>::const_iterator it;
 
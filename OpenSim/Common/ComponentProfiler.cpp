@@ -0,0 +1,256 @@
+/* -------------------------------------------------------------------------- *
+ *                       OpenSim:  ComponentProfiler.cpp                       *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * See http://opensim.stanford.edu and the NOTICE file for more information.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2005-2020 Stanford University and the Authors                *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#include "ComponentProfiler.h"
+
+#include "Component.h"
+#include "Exception.h"
+#include "Logger.h"
+
+#include <algorithm>
+#include <fstream>
+#include <limits>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+using namespace OpenSim;
+
+std::atomic<bool> ComponentProfiler::s_enabled{false};
+
+namespace {
+
+using Category = ComponentProfiler::Category;
+
+struct Key {
+    const Component* component;
+    Category category;
+    bool operator==(const Key& other) const {
+        return component == other.component && category == other.category;
+    }
+};
+struct KeyHash {
+    std::size_t operator()(const Key& key) const {
+        return std::hash<const void*>()(key.component) * 31 +
+               static_cast<std::size_t>(key.category);
+    }
+};
+
+struct Stats {
+    std::string componentPath;
+    std::string concreteClassName;
+    long long count = 0;
+    long long totalTimeInNs = 0;
+    long long maxTimeInNs = 0;
+};
+
+struct TraceEvent {
+    const Stats* stats;
+    Category category;
+    long long startTime;
+    long long duration;
+};
+
+// The calls recorded by one thread. Only that thread adds to it, so its mutex
+// is uncontended except while results are being collected.
+struct ThreadRecord {
+    std::mutex mutex;
+    int threadIndex;
+    std::unordered_map<Key, Stats, KeyHash> stats;
+    std::vector<TraceEvent> events;
+};
+
+std::atomic<bool> traceEnabled{false};
+
+// Thread records outlive their threads so that results from worker threads
+// (e.g., of a parallel Moco solve) are kept until reset().
+std::mutex registryMutex;
+std::vector<std::shared_ptr<ThreadRecord>> threadRecords;
+
+ThreadRecord& getThreadRecord() {
+    thread_local std::shared_ptr<ThreadRecord> record;
+    if (!record) {
+        record = std::make_shared<ThreadRecord>();
+        std::lock_guard<std::mutex> lock(registryMutex);
+        record->threadIndex = (int)threadRecords.size();
+        threadRecords.push_back(record);
+    }
+    return *record;
+}
+
+std::string escapeJSON(const std::string& str) {
+    std::string escaped;
+    escaped.reserve(str.size());
+    for (const char c : str) {
+        if (c == '"' || c == '\\') escaped += '\\';
+        escaped += c;
+    }
+    return escaped;
+}
+
+} // anonymous namespace
+
+const char* ComponentProfiler::getCategoryName(Category category) {
+    switch (category) {
+    case Category::RealizeTime: return "RealizeTime";
+    case Category::RealizePosition: return "RealizePosition";
+    case Category::RealizeVelocity: return "RealizeVelocity";
+    case Category::RealizeDynamics: return "RealizeDynamics";
+    case Category::RealizeAcceleration: return "RealizeAcceleration";
+    case Category::RealizeReport: return "RealizeReport";
+    case Category::ComputeForce: return "ComputeForce";
+    case Category::ComputeStateVariableDerivatives:
+        return "ComputeStateVariableDerivatives";
+    default:
+        OPENSIM_THROW(Exception, "Internal error.");
+    }
+}
+
+void ComponentProfiler::setEnabled(bool enabled) {
+    s_enabled.store(enabled);
+}
+
+void ComponentProfiler::setTraceEnabled(bool enabled) {
+    traceEnabled.store(enabled);
+}
+
+bool ComponentProfiler::isTraceEnabled() { return traceEnabled.load(); }
+
+void ComponentProfiler::reset() {
+    std::lock_guard<std::mutex> lock(registryMutex);
+    for (auto& record : threadRecords) {
+        std::lock_guard<std::mutex> recordLock(record->mutex);
+        record->stats.clear();
+        record->events.clear();
+    }
+}
+
+void ComponentProfiler::record(const Component& component, Category category,
+        long long startTime, long long endTime) {
+    ThreadRecord& record = getThreadRecord();
+    const long long duration = endTime - startTime;
+    std::lock_guard<std::mutex> lock(record.mutex);
+    auto it = record.stats.find({&component, category});
+    if (it == record.stats.end()) {
+        // Look up the (costly) path only the first time a component is seen.
+        Stats stats;
+        stats.componentPath = component.getAbsolutePathString();
+        stats.concreteClassName = component.getConcreteClassName();
+        it = record.stats.emplace(Key{&component, category}, std::move(stats))
+                     .first;
+    }
+    Stats& stats = it->second;
+    ++stats.count;
+    stats.totalTimeInNs += duration;
+    stats.maxTimeInNs = std::max(stats.maxTimeInNs, duration);
+    if (traceEnabled.load(std::memory_order_relaxed)) {
+        record.events.push_back({&stats, category, startTime, duration});
+    }
+}
+
+std::vector<ComponentProfiler::Result> ComponentProfiler::getResults() {
+    // Aggregate by path rather than by address so that calls on copies of a
+    // model (one per thread) are combined.
+    std::map<std::pair<std::string, Category>, Result> aggregated;
+    {
+        std::lock_guard<std::mutex> lock(registryMutex);
+        for (auto& record : threadRecords) {
+            std::lock_guard<std::mutex> recordLock(record->mutex);
+            for (const auto& entry : record->stats) {
+                const Stats& stats = entry.second;
+                const auto category = entry.first.category;
+                auto it = aggregated.find({stats.componentPath, category});
+                if (it == aggregated.end()) {
+                    it = aggregated.emplace(
+                            std::make_pair(stats.componentPath, category),
+                            Result{stats.componentPath,
+                                    stats.concreteClassName, category, 0, 0,
+                                    0}).first;
+                }
+                Result& result = it->second;
+                result.count += stats.count;
+                result.totalTimeInNs += stats.totalTimeInNs;
+                result.maxTimeInNs =
+                        std::max(result.maxTimeInNs, stats.maxTimeInNs);
+            }
+        }
+    }
+    std::vector<Result> results;
+    results.reserve(aggregated.size());
+    for (auto& entry : aggregated) results.push_back(std::move(entry.second));
+    std::sort(results.begin(), results.end(),
+            [](const Result& a, const Result& b) {
+                return a.totalTimeInNs > b.totalTimeInNs;
+            });
+    return results;
+}
+
+void ComponentProfiler::printReport(int maxRows) {
+    const auto results = getResults();
+    const int numRows = maxRows < 0 ? (int)results.size()
+                                    : std::min(maxRows, (int)results.size());
+    log_cout("{:>12} {:>12} {:>12} {:>12}  {:<32} {}", "total (ms)",
+            "calls", "mean (us)", "max (us)", "category", "component");
+    for (int i = 0; i < numRows; ++i) {
+        const auto& result = results[i];
+        log_cout("{:>12.3f} {:>12} {:>12.3f} {:>12.3f}  {:<32} {} ({})",
+                1e-6 * result.totalTimeInNs, result.count,
+                1e6 * result.getMeanTime(), 1e-3 * result.maxTimeInNs,
+                getCategoryName(result.category), result.componentPath,
+                result.concreteClassName);
+    }
+}
+
+void ComponentProfiler::writeChromeTrace(const std::string& filename) {
+    std::ofstream stream(filename);
+    OPENSIM_THROW_IF(!stream.good(), Exception,
+            fmt::format("Could not open file '{}' for writing.", filename));
+    // Timestamps are in microseconds, relative to the earliest call.
+    std::lock_guard<std::mutex> lock(registryMutex);
+    long long origin = std::numeric_limits<long long>::max();
+    for (auto& record : threadRecords) {
+        std::lock_guard<std::mutex> recordLock(record->mutex);
+        for (const auto& event : record->events) {
+            origin = std::min(origin, event.startTime);
+        }
+    }
+    stream << "{\"traceEvents\":[";
+    bool first = true;
+    for (auto& record : threadRecords) {
+        std::lock_guard<std::mutex> recordLock(record->mutex);
+        for (const auto& event : record->events) {
+            if (!first) stream << ",";
+            first = false;
+            stream << fmt::format("\n{{\"name\":\"{}\",\"cat\":\"{}\","
+                                  "\"ph\":\"X\",\"ts\":{:.3f},\"dur\":{:.3f},"
+                                  "\"pid\":0,\"tid\":{},"
+                                  "\"args\":{{\"type\":\"{}\"}}}}",
+                    escapeJSON(event.stats->componentPath),
+                    getCategoryName(event.category),
+                    1e-3 * (event.startTime - origin), 1e-3 * event.duration,
+                    record->threadIndex,
+                    escapeJSON(event.stats->concreteClassName));
+        }
+    }
+    stream << "\n]}\n";
+}
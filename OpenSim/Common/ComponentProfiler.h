@@ -0,0 +1,146 @@
+#ifndef OPENSIM_COMPONENT_PROFILER_H_
+#define OPENSIM_COMPONENT_PROFILER_H_
+/* -------------------------------------------------------------------------- *
+ *                        OpenSim:  ComponentProfiler.h                        *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * See http://opensim.stanford.edu and the NOTICE file for more information.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2005-2020 Stanford University and the Authors                *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#include "osimCommonDLL.h"
+#include <SimTKcommon/internal/Timing.h>
+#include <atomic>
+#include <string>
+#include <vector>
+
+namespace OpenSim {
+
+class Component;
+
+/** Record how many times, and for how long, each Component's realize and
+compute methods are called, to find the components that dominate the cost of
+a simulation or optimization.
+
+The profiler is off by default and costs a single flag check per call while
+off. Define OPENSIM_DISABLE_COMPONENT_PROFILER when building OpenSim to
+remove even that check. Calls are recorded from all threads and aggregated
+when results are requested.
+@code
+ComponentProfiler::setEnabled(true);
+manager.integrate(finalTime);
+ComponentProfiler::setEnabled(false);
+ComponentProfiler::printReport();
+@endcode
+The times are wall-clock times. A component's realize calls include only the
+work done by that component (its subcomponents are timed separately), but a
+ComputeStateVariableDerivatives call is also part of the component's
+RealizeAcceleration time. */
+class OSIMCOMMON_API ComponentProfiler {
+public:
+    ComponentProfiler() = delete;
+
+    /** The methods that are timed. */
+    enum class Category {
+        RealizeTime,
+        RealizePosition,
+        RealizeVelocity,
+        RealizeDynamics,
+        RealizeAcceleration,
+        RealizeReport,
+        /** Force::computeForce(). */
+        ComputeForce,
+        /** Component::computeStateVariableDerivatives(). */
+        ComputeStateVariableDerivatives
+    };
+    static const char* getCategoryName(Category category);
+
+    /** Calls of one Category on one component, aggregated across threads. */
+    struct Result {
+        std::string componentPath;
+        std::string concreteClassName;
+        Category category;
+        long long count;
+        long long totalTimeInNs;
+        long long maxTimeInNs;
+        double getMeanTime() const {
+            return count ? SimTK::nsToSec(totalTimeInNs) / count : 0;
+        }
+    };
+
+    /** Start or stop recording calls. Results recorded so far are kept; see
+    reset(). */
+    static void setEnabled(bool enabled);
+    static bool isEnabled() {
+#ifdef OPENSIM_DISABLE_COMPONENT_PROFILER
+        return false;
+#else
+        return s_enabled.load(std::memory_order_relaxed);
+#endif
+    }
+    /** Also record each individual call (not only totals) so that the calls
+    can be written with writeChromeTrace(). This uses memory proportional to
+    the number of calls, so only enable it for short runs. */
+    static void setTraceEnabled(bool enabled);
+    static bool isTraceEnabled();
+
+    /** Discard all recorded calls. Call this before destroying models that
+    were profiled if the profiler will be used again, since results are
+    keyed by component address. */
+    static void reset();
+
+    /** The recorded results, sorted by decreasing total time. */
+    static std::vector<Result> getResults();
+    /** Log a table of the results with the largest total times, at most
+    maxRows rows (all rows if maxRows is negative). */
+    static void printReport(int maxRows = 30);
+    /** Write the calls recorded while tracing was enabled in the Chrome
+    trace event format, which can be opened with chrome://tracing or
+    https://ui.perfetto.dev. Each thread appears as a separate track. */
+    static void writeChromeTrace(const std::string& filename);
+
+    /** Time the enclosing scope as a call of the given Category on the given
+    component, if the profiler is enabled. */
+    class Scope {
+    public:
+        Scope(const Component& component, Category category)
+                : m_component(isEnabled() ? &component : nullptr),
+                  m_category(category),
+                  m_startTime(m_component ? SimTK::realTimeInNs() : 0) {}
+        ~Scope() {
+            if (m_component) {
+                record(*m_component, m_category, m_startTime,
+                        SimTK::realTimeInNs());
+            }
+        }
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+    private:
+        const Component* m_component;
+        Category m_category;
+        long long m_startTime;
+    };
+
+private:
+    static void record(const Component& component, Category category,
+            long long startTime, long long endTime);
+    static std::atomic<bool> s_enabled;
+};
+
+} // namespace OpenSim
+
+#endif // OPENSIM_COMPONENT_PROFILER_H_
@@ -22,10 +22,16 @@
  * See the License for the specific language governing permissions and        *
  * limitations under the License.                                             *
  * -------------------------------------------------------------------------- */
-#include <queue>
+#include <algorithm>
+#include <chrono>
 #include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <thread>
+#include <vector>
 #include <SimTKcommon.h>
 #include <OpenSim/Common/osimCommonDLL.h>
+#include <OpenSim/Common/Exception.h>
 
 namespace OpenSim {
 
@@ -37,9 +43,6 @@ namespace OpenSim {
  * potentially different in processing speeds, decoupling the producers 
  * (e.g. File or live stream) from consumers. 
  *
- * Synchronization mechanism will be implmented later to allow handling of 
- * multiple threads or significant differences in speeds.
- *
  * @author Ayman Habib
  */
 /** Template class to contain Queue Entries, typically timestamped */
@@ -60,12 +63,53 @@ private:
     double _timeStamp;
     SimTK::RowVectorView_<U> _data;
 };
+
+/** What DataQueue_::push_back() does when the queue is already full. */
+enum class DataQueueOverflowPolicy {
+    /// Double the number of slots; no data is lost and push_back() never
+    /// waits, but memory grows with the largest backlog.
+    Grow,
+    /// Wait until a consumer frees a slot; no data is lost. A thread that
+    /// has consumed from the queue gets an exception instead of waiting for
+    /// itself.
+    Block,
+    /// Overwrite the oldest entry that has not been consumed yet.
+    DropOldest,
+    /// Discard every unconsumed entry so that only the newest is kept.
+    LatestOnly
+};
+
+/** Counters describing the traffic through a DataQueue_. Latencies are the
+ * wall-clock seconds between push_back() and the pop that consumed an entry;
+ * dropped entries do not contribute to them. */
+struct DataQueueStatistics {
+    std::size_t numPushed{0};
+    std::size_t numPopped{0};
+    std::size_t numDropped{0};
+    std::size_t maxSize{0};
+    double lastLatency{0};
+    double meanLatency{0};
+    double maxLatency{0};
+};
+
 /**
- * DataQueue is a wrapper around the std::queue customized to handle data 
- * processing and synchronization, and limiting the interface to only the 
- * subset of operations needed for this use case. 
- * Synchronization is experimental as of now. Client is responsible for 
- * making sure order is preserved.
+ * DataQueue is a ring buffer customized to handle data processing and
+ * synchronization between a producer (e.g., a live IMU stream or a file
+ * being replayed) and a consumer (e.g., an InverseKinematicsSolver). Slots
+ * are allocated ahead of time; once a slot has held a row of a given size,
+ * pushing another row of that size into it copies elements in place without
+ * touching the heap.
+ *
+ * When the queue is full, push_back() follows the OverflowPolicy. By
+ * default, the queue is bounded so that its memory use stays flat over long
+ * sessions: DropOldest (the default) overwrites the oldest entry; Block
+ * waits for the consumer; and LatestOnly keeps only the newest entry and
+ * suits consumers that only care about the current pose. Opt in to Grow,
+ * which doubles the number of slots, if a producer and consumer on the same
+ * thread must be able to queue any number of rows without losing data.
+ * pop_front() waits for data, while try_pop_front() returns false if nothing
+ * arrives within a timeout.
+ *
  * timestamp is required to pass in data so that clients can enforce order,
  * however timestamp is not used/order-enforced internally.
  */
@@ -75,21 +119,40 @@ template<class T> class DataQueue_ {
 // METHODS
 //=============================================================================
 public:
+    using OverflowPolicy = DataQueueOverflowPolicy;
+    static constexpr std::size_t DefaultCapacity = 1024;
+
     //--------------------------------------------------------------------------
     // CONSTRUCTION
     //--------------------------------------------------------------------------
     virtual ~DataQueue_() {}
     
-    DataQueue_()                                = default;
+    explicit DataQueue_(std::size_t capacity = DefaultCapacity,
+            OverflowPolicy policy = OverflowPolicy::DropOldest)
+            : m_policy(policy) {
+        OPENSIM_THROW_IF(capacity == 0, Exception,
+                "DataQueue capacity must be at least 1.");
+        m_slots.resize(capacity);
+    }
     // using compiler generated methods here is problematic due to mutex 
-    DataQueue_(const DataQueue_& other){ 
-        m_data_queue = other.m_data_queue;
+    DataQueue_(const DataQueue_& other) {
+        std::lock_guard<std::mutex> otherLock(other.m_mutex);
+        copyContents(other);
     };
-    DataQueue_(DataQueue_&& other){ 
-        m_data_queue = other.m_data_queue;
+    DataQueue_(DataQueue_&& other) {
+        std::lock_guard<std::mutex> otherLock(other.m_mutex);
+        copyContents(other);
     };
     DataQueue_& operator=(const DataQueue_& other) { 
-        m_data_queue = other.m_data_queue;
+        if (this != &other) {
+            std::lock(m_mutex, other.m_mutex);
+            std::lock_guard<std::mutex> lock(m_mutex, std::adopt_lock);
+            std::lock_guard<std::mutex> otherLock(
+                    other.m_mutex, std::adopt_lock);
+            copyContents(other);
+        }
+        m_notFull.notify_all();
+        m_notEmpty.notify_all();
         return (*this);
     };
 
@@ -98,39 +161,197 @@ public:
     //--------------------------------------------------------------------------
     // push data and associated timestamp to the end of the queue
     void push_back(const double time, const SimTK::RowVectorView_<T>& data) { 
-        SimTK::RowVector_<T>* deepCopy = new SimTK::RowVector_<T>(data);
         std::unique_lock<std::mutex> mlock(m_mutex);
-        m_data_queue.push(DataQueueEntry_<T>(time, *deepCopy));
+        if (m_policy == OverflowPolicy::Block &&
+                m_size == m_slots.size()) {
+            // Nobody else would free a slot.
+            OPENSIM_THROW_IF(m_consumerThread == std::this_thread::get_id(),
+                    Exception,
+                    "DataQueue is full and its overflow policy is Block, but "
+                    "the calling thread is also the queue's consumer.");
+            m_notFull.wait(mlock, [this] {
+                return m_size < m_slots.size() ||
+                       m_policy != OverflowPolicy::Block;
+            });
+        }
+        if (m_policy == OverflowPolicy::LatestOnly) {
+            dropOldest(m_size);
+        } else if (m_size == m_slots.size()) {
+            if (m_policy == OverflowPolicy::Grow) {
+                resizeSlots(2 * m_slots.size());
+            } else {
+                dropOldest(1);
+            }
+        }
+        Slot& slot = m_slots[(m_head + m_size) % m_slots.size()];
+        slot.time = time;
+        copyRow(data, slot.data);
+        slot.pushTime = Clock::now();
+        ++m_size;
+        ++m_stats.numPushed;
+        m_stats.maxSize = std::max(m_stats.maxSize, m_size);
         mlock.unlock();     // unlock before notificiation to minimize mutex con
-        m_cond.notify_one(); 
+        m_notEmpty.notify_one();
     }
-    // pop the front of the queue and return data and associated timestamp
+    // pop the front of the queue and return data and associated timestamp,
+    // waiting for a producer if the queue is empty
     void pop_front(double& time, SimTK::RowVector_<T>& data) { 
         std::unique_lock<std::mutex> mlock(m_mutex);
-        while (m_data_queue.empty()) { m_cond.wait(mlock); }
-        DataQueueEntry_<SimTK::Rotation> frontEntry = m_data_queue.front();
-        m_data_queue.pop();
+        m_notEmpty.wait(mlock, [this] { return m_size > 0; });
+        takeFront(time, data);
         mlock.unlock(); 
-        time = frontEntry.getTimeStamp();
-        data = frontEntry.getData();
+        m_notFull.notify_one();
+    }
+    // pop the front of the queue if an entry is available within timeout;
+    // returns false (leaving time and data untouched) otherwise
+    bool try_pop_front(double& time, SimTK::RowVector_<T>& data,
+            std::chrono::microseconds timeout =
+                    std::chrono::microseconds::zero()) {
+        std::unique_lock<std::mutex> mlock(m_mutex);
+        if (!m_notEmpty.wait_for(
+                    mlock, timeout, [this] { return m_size > 0; })) {
+            return false;
+        }
+        takeFront(time, data);
+        mlock.unlock();
+        m_notFull.notify_one();
+        return true;
     }
     // check if the queue is empty
-    bool isEmpty() { 
-        bool status = false;
+    bool isEmpty() const { 
+        std::lock_guard<std::mutex> mlock(m_mutex);
+        return m_size == 0;
+    }
+    // number of entries waiting to be consumed
+    std::size_t size() const {
+        std::lock_guard<std::mutex> mlock(m_mutex);
+        return m_size;
+    }
+    // discard all entries waiting to be consumed
+    void clear() {
         std::unique_lock<std::mutex> mlock(m_mutex);
-        status = m_data_queue.empty();
-        mlock.unlock(); 
-        return status;
+        dropOldest(m_size);
+        mlock.unlock();
+        m_notFull.notify_all();
     }
+
+    std::size_t getCapacity() const {
+        std::lock_guard<std::mutex> mlock(m_mutex);
+        return m_slots.size();
+    }
+    /** Change the number of slots. If more entries are waiting than fit in
+     * the new capacity, the oldest ones are dropped. With the Grow policy,
+     * this is only the current number of slots. */
+    void setCapacity(std::size_t capacity) {
+        OPENSIM_THROW_IF(capacity == 0, Exception,
+                "DataQueue capacity must be at least 1.");
+        std::unique_lock<std::mutex> mlock(m_mutex);
+        dropOldest(m_size - std::min(m_size, capacity));
+        resizeSlots(capacity);
+        mlock.unlock();
+        m_notFull.notify_all();
+    }
+
+    OverflowPolicy getOverflowPolicy() const {
+        std::lock_guard<std::mutex> mlock(m_mutex);
+        return m_policy;
+    }
+    void setOverflowPolicy(OverflowPolicy policy) {
+        std::unique_lock<std::mutex> mlock(m_mutex);
+        m_policy = policy;
+        mlock.unlock();
+        // Producers blocked on a full queue re-check the policy.
+        m_notFull.notify_all();
+    }
+
+    DataQueueStatistics getStatistics() const {
+        std::lock_guard<std::mutex> mlock(m_mutex);
+        return m_stats;
+    }
+    void resetStatistics() {
+        std::lock_guard<std::mutex> mlock(m_mutex);
+        m_stats = DataQueueStatistics();
+        m_stats.maxSize = m_size;
+    }
+
 private:
-    // As of now we use std::queue but other data structures could be used as well
-    std::queue<DataQueueEntry_<T>> m_data_queue;
-    std::mutex m_mutex;
-    std::condition_variable m_cond;
+    using Clock = std::chrono::steady_clock;
+    struct Slot {
+        double time{SimTK::NaN};
+        SimTK::RowVector_<T> data;
+        Clock::time_point pushTime;
+    };
+
+    // Copy element-wise when sizes match so that slots and the caller's
+    // row keep their storage.
+    static void copyRow(const SimTK::RowVectorBase<T>& source,
+            SimTK::RowVector_<T>& dest) {
+        const int n = source.size();
+        if (dest.size() != n) dest.resize(n);
+        for (int i = 0; i < n; ++i) dest[i] = source[i];
+    }
+
+    // The methods below require m_mutex to be held.
+    void copyContents(const DataQueue_& other) {
+        m_slots = other.m_slots;
+        m_head = other.m_head;
+        m_size = other.m_size;
+        m_policy = other.m_policy;
+        m_stats = other.m_stats;
+    }
+    void takeFront(double& time, SimTK::RowVector_<T>& data) {
+        m_consumerThread = std::this_thread::get_id();
+        Slot& slot = m_slots[m_head];
+        time = slot.time;
+        copyRow(slot.data, data);
+        m_head = (m_head + 1) % m_slots.size();
+        --m_size;
+
+        const double latency =
+                std::chrono::duration<double>(Clock::now() - slot.pushTime)
+                        .count();
+        ++m_stats.numPopped;
+        m_stats.lastLatency = latency;
+        m_stats.meanLatency += (latency - m_stats.meanLatency) /
+                               static_cast<double>(m_stats.numPopped);
+        m_stats.maxLatency = std::max(m_stats.maxLatency, latency);
+    }
+    // Move the entries to the front of a new vector of slots; the caller
+    // ensures they fit.
+    void resizeSlots(std::size_t capacity) {
+        std::vector<Slot> slots(capacity);
+        for (std::size_t i = 0; i < m_size; ++i) {
+            std::swap(slots[i], m_slots[(m_head + i) % m_slots.size()]);
+        }
+        m_slots.swap(slots);
+        m_head = 0;
+    }
+    void dropOldest(std::size_t count) {
+        if (count == 0) return;
+        m_head = (m_head + count) % m_slots.size();
+        m_size -= count;
+        m_stats.numDropped += count;
+    }
+
+    // Slots are allocated once; entries occupy [m_head, m_head + m_size)
+    // modulo the capacity.
+    std::vector<Slot> m_slots;
+    std::size_t m_head{0};
+    std::size_t m_size{0};
+    OverflowPolicy m_policy{OverflowPolicy::DropOldest};
+    DataQueueStatistics m_stats;
+    // The last thread that popped an entry.
+    std::thread::id m_consumerThread;
+    mutable std::mutex m_mutex;
+    std::condition_variable m_notEmpty;
+    std::condition_variable m_notFull;
 
     //=============================================================================
 };  // END of class templatized DataQueue_<T>
 //=============================================================================
+
+template <class T> constexpr std::size_t DataQueue_<T>::DefaultCapacity;
+
 }
 
 #endif // OPENSIM_DATA_QUEUE_H_
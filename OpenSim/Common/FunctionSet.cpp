@@ -27,6 +27,8 @@
 
 // INCLUDES
 #include "FunctionSet.h"
+#include "GCVSpline.h"
+#include "SimmSpline.h"
 
 
 
@@ -154,3 +156,87 @@ evaluate(Array<double> &rValues,int aDerivOrder,double aX) const
         }
     }
 }
+
+//_____________________________________________________________________________
+/**
+ * Evaluate all the functions in the function set and their derivatives up
+ * to a specified order.
+ *
+ * @param aX Value of the x independent variable.
+ * @param aMaxDerivOrder Highest derivative order to evaluate (0, 1 or 2).
+ * @param rValues Values of the functions and their derivatives, ordered
+ * by function and then by derivative order.
+ */
+void FunctionSet::
+calcValuesAndDerivatives(double aX, int aMaxDerivOrder, double* rValues) const
+{
+    int gcvInterval = 0;
+    int simmInterval = 0;
+    calcValuesAndDerivatives(aX, aMaxDerivOrder, rValues, gcvInterval,
+            simmInterval);
+}
+
+//_____________________________________________________________________________
+/**
+ * Evaluate all the functions in the function set and their derivatives up
+ * to a specified order at a sequence of values of the independent variable.
+ *
+ * @param aX Values of the x independent variable.
+ * @param aMaxDerivOrder Highest derivative order to evaluate (0, 1 or 2).
+ * @param rValues Values of the functions and their derivatives; one column
+ * per entry of aX.
+ */
+void FunctionSet::
+calcValuesAndDerivatives(const SimTK::Vector& aX, int aMaxDerivOrder,
+        SimTK::Matrix& rValues) const
+{
+    const int numValues = getSize() * (aMaxDerivOrder + 1);
+    rValues.resize(numValues, aX.size());
+    if (numValues == 0) return;
+
+    // The knot intervals carry over from one time to the next.
+    int gcvInterval = 0;
+    int simmInterval = 0;
+    std::vector<double> work(numValues);
+    for (int j = 0; j < aX.size(); ++j) {
+        calcValuesAndDerivatives(aX[j], aMaxDerivOrder, work.data(),
+                gcvInterval, simmInterval);
+        for (int i = 0; i < numValues; ++i)
+            rValues(i, j) = work[i];
+    }
+}
+
+void FunctionSet::
+calcValuesAndDerivatives(double aX, int aMaxDerivOrder, double* rValues,
+        int& rGCVInterval, int& rSimmInterval) const
+{
+    OPENSIM_THROW_IF(aMaxDerivOrder < 0 || aMaxDerivOrder > 2, Exception,
+            fmt::format("Expected the derivative order to be 0, 1 or 2, "
+                        "but got {}.", aMaxDerivOrder));
+
+    static const std::vector<int> firstDeriv(1, 0);
+    static const std::vector<int> secondDeriv(2, 0);
+    const int stride = aMaxDerivOrder + 1;
+    const SimTK::Vector arg(1, aX);
+
+    const int size = getSize();
+    for (int i = 0; i < size; ++i) {
+        const Function& func = get(i);
+        double* values = rValues + i*stride;
+        // Splines in a set usually share their knots, so the interval found
+        // for one spline is (almost always) correct for the next one.
+        if (const auto* gcv = dynamic_cast<const GCVSpline*>(&func)) {
+            gcv->calcValueAndDerivatives(aX, aMaxDerivOrder, values,
+                    rGCVInterval);
+        } else if (const auto* simm = dynamic_cast<const SimmSpline*>(&func)) {
+            simm->calcValueAndDerivatives(aX, aMaxDerivOrder, values,
+                    rSimmInterval);
+        } else {
+            values[0] = func.calcValue(arg);
+            if (aMaxDerivOrder >= 1)
+                values[1] = func.calcDerivative(firstDeriv, arg);
+            if (aMaxDerivOrder >= 2)
+                values[2] = func.calcDerivative(secondDeriv, arg);
+        }
+    }
+}
@@ -75,6 +75,36 @@ public:
     virtual void
         evaluate(Array<double> &rValues,int aDerivOrder,
         double aX=0.0) const;
+#ifndef SWIG
+    /**
+     * Evaluate all functions in the set and their derivatives up to order
+     * aMaxDerivOrder (at most 2) at aX. The results are written to rValues,
+     * which must hold getSize()*(aMaxDerivOrder+1) values; the k-th
+     * derivative of function i is stored at rValues[i*(aMaxDerivOrder+1)+k].
+     *
+     * GCVSpline and SimmSpline members are evaluated directly and share
+     * their knot interval search, so a set of splines fit to the same
+     * Storage or TimeSeriesTable (e.g., a GCVSplineSet) searches the knots
+     * only once. Other functions fall back to calcValue()/calcDerivative().
+     */
+    void calcValuesAndDerivatives(double aX, int aMaxDerivOrder,
+        double* rValues) const;
+#endif
+    /**
+     * Evaluate all functions in the set and their derivatives up to order
+     * aMaxDerivOrder (at most 2) at each of the values in aX. rValues is
+     * resized to getSize()*(aMaxDerivOrder+1) rows and aX.size() columns;
+     * column j holds the values for aX[j] in the layout described for the
+     * single-value overload. When aX is sorted, the knot interval found
+     * for one value is the starting point for the next.
+     */
+    void calcValuesAndDerivatives(const SimTK::Vector& aX, int aMaxDerivOrder,
+        SimTK::Matrix& rValues) const;
+
+private:
+    void calcValuesAndDerivatives(double aX, int aMaxDerivOrder,
+        double* rValues, int& rGCVInterval, int& rSimmInterval) const;
+public:
 
 //=============================================================================
 };  // END class FunctionSet
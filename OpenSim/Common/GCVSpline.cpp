@@ -580,6 +580,29 @@ addPoint(double aX, double aY)
     return i;
 }
 
+//_____________________________________________________________________________
+void GCVSpline::
+calcValueAndDerivatives(double aX, int aMaxDerivOrder, double* rValues,
+        int& rInterval) const
+{
+    const int n = _x.getSize();
+    if (n <= 0 || _halfOrder <= 0) {
+        for (int k = 0; k <= aMaxDerivOrder; ++k) rValues[k] = SimTK::NaN;
+        return;
+    }
+
+    // The coefficients are computed when the SimTK::Spline is created.
+    if (_function == NULL)
+        _function = createSimTKFunction();
+
+    // splder() needs a work array of length 2*m; m is at most 4 (heptic).
+    double work[8];
+    for (int k = 0; k <= aMaxDerivOrder; ++k) {
+        rValues[k] = splder(k, _halfOrder, n, aX, &_x[0], &_coefficients[0],
+                &rInterval, work);
+    }
+}
+
 SimTK::Function* GCVSpline::createSimTKFunction() const {
     int degree = _halfOrder*2-1;
     Vector x(_x.getSize());
@@ -233,6 +233,24 @@ public:
     //--------------------------------------------------------------------------
     // EVALUATION
     //--------------------------------------------------------------------------
+#ifndef SWIG
+    /**
+     * Evaluate the spline and its derivatives up to order aMaxDerivOrder at
+     * aX, writing the value to rValues[0], the first derivative to
+     * rValues[1], and so on. The values are identical to those from
+     * calcValue() and calcDerivative(), but no arguments are allocated.
+     *
+     * @param aX Value of the independent variable.
+     * @param aMaxDerivOrder Highest derivative order to evaluate.
+     * @param rValues Array of at least aMaxDerivOrder+1 values.
+     * @param rInterval Knot interval containing aX (see search() in
+     * gcvspl.c). The value passed in is used as the starting point of the
+     * search, so reusing it across calls with nearby aX, or across splines
+     * that share the same knots, makes the search O(1).
+     */
+    void calcValueAndDerivatives(double aX, int aMaxDerivOrder,
+            double* rValues, int& rInterval) const;
+#endif
 
 //=============================================================================
 };  // END class GCVSpline
@@ -28,6 +28,12 @@
 
 #include "spdlog/sinks/stdout_color_sinks.h"
 
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
 using namespace OpenSim;
 
 static void initializeLogger(spdlog::logger& l, const char* pattern) {
@@ -61,7 +67,93 @@ static bool otherStaticInit = initializeLogging();
 // it is only initialized when the first log message is about to be written to
 // it. Users *may* disable this functionality before the first log message is
 // written (or disable it statically, by setting OPENSIM_DISABLE_LOG_FILE)
-static std::shared_ptr<spdlog::sinks::basic_file_sink_mt> m_filesink = nullptr;
+static std::shared_ptr<spdlog::sinks::sink> m_filesink = nullptr;
+static std::string m_filesinkPath;
+
+namespace {
+// A sink that hands messages to a background thread, which formats them and
+// writes them to a file. Messages are buffered in a bounded queue; if the
+// queue is full, the logging thread waits rather than dropping messages.
+class AsyncFileSink : public spdlog::sinks::sink {
+public:
+    AsyncFileSink(const std::string& filepath, int queueCapacity)
+            : m_fileSink(filepath),
+              m_capacity(std::max<std::size_t>(1, queueCapacity)) {
+        m_worker = std::thread(&AsyncFileSink::run, this);
+    }
+    ~AsyncFileSink() override {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stop = true;
+        }
+        m_notEmpty.notify_one();
+        m_worker.join();
+    }
+    void log(const spdlog::details::log_msg& msg) override {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_notFull.wait(lock, [this] { return m_queue.size() < m_capacity; });
+        // The payload is only a view of the caller's buffer, so we keep our
+        // own copy and point the message at it when it is written.
+        m_queue.emplace_back(msg,
+                std::string(msg.payload.begin(), msg.payload.end()));
+        lock.unlock();
+        m_notEmpty.notify_one();
+    }
+    // Called by spdlog after every message (see flush_on()); the file is
+    // flushed by the background thread once it has written the queue.
+    void flush() override {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_flushRequested = true;
+        }
+        m_notEmpty.notify_one();
+    }
+    // The file sink has its own mutex, so the pattern may be changed while
+    // the background thread writes.
+    void set_pattern(const std::string& pattern) override {
+        m_fileSink.set_pattern(pattern);
+    }
+    void set_formatter(std::unique_ptr<spdlog::formatter> formatter) override {
+        m_fileSink.set_formatter(std::move(formatter));
+    }
+
+private:
+    void run() {
+        std::deque<std::pair<spdlog::details::log_msg, std::string>> batch;
+        std::unique_lock<std::mutex> lock(m_mutex);
+        while (true) {
+            m_notEmpty.wait(lock, [this] {
+                return m_stop || m_flushRequested || !m_queue.empty();
+            });
+            batch.swap(m_queue);
+            const bool flush = m_flushRequested || m_stop;
+            m_flushRequested = false;
+            const bool stop = m_stop;
+            m_notFull.notify_all();
+            lock.unlock();
+            for (auto& entry : batch) {
+                entry.first.payload = spdlog::string_view_t(
+                        entry.second.data(), entry.second.size());
+                m_fileSink.log(entry.first);
+            }
+            batch.clear();
+            if (flush) m_fileSink.flush();
+            lock.lock();
+            if (stop && m_queue.empty()) return;
+        }
+    }
+
+    spdlog::sinks::basic_file_sink_mt m_fileSink;
+    const std::size_t m_capacity;
+    std::deque<std::pair<spdlog::details::log_msg, std::string>> m_queue;
+    std::mutex m_mutex;
+    std::condition_variable m_notEmpty;
+    std::condition_variable m_notFull;
+    bool m_flushRequested = false;
+    bool m_stop = false;
+    std::thread m_worker;
+};
+} // anonymous namespace
 
 // if a user manually calls `Logger::(remove|add)FileSink`, auto-initialization
 // should be disabled. Manual usage "overrides" lazy auto-initialization.
@@ -200,23 +292,25 @@ std::string Logger::getLevelString() {
     }
 }
 
+// The values of Logger::Level match those of spdlog::level::level_enum, which
+// lets shouldLog() (called for every message) avoid a switch.
+static_assert(static_cast<int>(Logger::Level::Off) == spdlog::level::off &&
+        static_cast<int>(Logger::Level::Critical) == spdlog::level::critical &&
+        static_cast<int>(Logger::Level::Error) == spdlog::level::err &&
+        static_cast<int>(Logger::Level::Warn) == spdlog::level::warn &&
+        static_cast<int>(Logger::Level::Info) == spdlog::level::info &&
+        static_cast<int>(Logger::Level::Debug) == spdlog::level::debug &&
+        static_cast<int>(Logger::Level::Trace) == spdlog::level::trace,
+        "Logger::Level must match spdlog::level::level_enum.");
+
 bool Logger::shouldLog(Level level) {
-    spdlog::level::level_enum spdlogLevel;
-    switch (level) {
-    case Level::Off: spdlogLevel = spdlog::level::off; break;
-    case Level::Critical: spdlogLevel = spdlog::level::critical; break;
-    case Level::Error: spdlogLevel = spdlog::level::err; break;
-    case Level::Warn: spdlogLevel = spdlog::level::warn; break;
-    case Level::Info: spdlogLevel = spdlog::level::info; break;
-    case Level::Debug: spdlogLevel = spdlog::level::debug; break;
-    case Level::Trace: spdlogLevel = spdlog::level::trace; break;
-    default:
-        OPENSIM_THROW(Exception, "Internal error.");
-    }
-    return defaultLogger->should_log(spdlogLevel);
+    return defaultLogger->should_log(
+            static_cast<spdlog::level::level_enum>(level));
 }
 
-void Logger::addFileSink(const std::string& filepath) {
+template <typename CreateSink>
+static void addFileSinkInternal(
+        const std::string& filepath, CreateSink createSink) {
     // this method is either called by the file log auto-initializer, which
     // should now be disabled, or by downstream code trying to manually specify
     // a file sink
@@ -227,15 +321,15 @@ void Logger::addFileSink(const std::string& filepath) {
 
     if (m_filesink) {
         defaultLogger->warn("Already logging to file '{}'; log file not added. Call "
-             "removeFileSink() first.", m_filesink->filename());
+             "removeFileSink() first.", m_filesinkPath);
         return;
     }
 
     // check if file can be opened at the specified path if not return meaningful
     // warning rather than bubble the exception up.
     try {
-        m_filesink =
-                std::make_shared<spdlog::sinks::basic_file_sink_mt>(filepath);
+        m_filesink = createSink();
+        m_filesinkPath = filepath;
     }
     catch (...) {
         defaultLogger->warn("Can't open file '{}' for writing. Log file will not be created. "
@@ -246,6 +340,19 @@ void Logger::addFileSink(const std::string& filepath) {
     addSinkInternal(m_filesink);
 }
 
+void Logger::addFileSink(const std::string& filepath) {
+    addFileSinkInternal(filepath, [&filepath] {
+        return std::make_shared<spdlog::sinks::basic_file_sink_mt>(filepath);
+    });
+}
+
+void Logger::addAsyncFileSink(
+        const std::string& filepath, int queueCapacity) {
+    addFileSinkInternal(filepath, [&filepath, queueCapacity] {
+        return std::make_shared<AsyncFileSink>(filepath, queueCapacity);
+    });
+}
+
 void Logger::removeFileSink() {
     // if this method is called, then we are probably at a point in the
     // application's lifetime where automatic log allocation is going to cause
@@ -260,9 +367,9 @@ void Logger::removeFileSink() {
         return;
     }
 
-    removeSinkInternal(
-            std::static_pointer_cast<spdlog::sinks::sink>(m_filesink));
+    removeSinkInternal(m_filesink);
     m_filesink.reset();
+    m_filesinkPath.clear();
 }
 
 void Logger::addSink(const std::shared_ptr<LogSink> sink) {
@@ -23,12 +23,23 @@
  * -------------------------------------------------------------------------- */
 
 #include "osimCommonDLL.h"
+#include <atomic>
+#include <limits>
 #include <set>
 #include <spdlog/spdlog.h>
 #include <spdlog/sinks/basic_file_sink.h>
 #include <string>
 #include <spdlog/fmt/ostr.h> 
 
+/// Messages below this level (an integer value of Logger::Level) are
+/// compiled out of the logging functions and OPENSIM_LOG_* macros, so that
+/// hot paths pay nothing for them, not even a check of the runtime level.
+/// For example, define OPENSIM_LOG_ACTIVE_LEVEL=2 when building OpenSim to
+/// remove all Debug and Trace messages. By default, no messages are removed.
+#ifndef OPENSIM_LOG_ACTIVE_LEVEL
+    #define OPENSIM_LOG_ACTIVE_LEVEL 0
+#endif
+
 namespace OpenSim {
 
 class LogSink;
@@ -98,48 +109,54 @@ public:
     /// @endcode
     static bool shouldLog(Level level);
 
+    /// Returns false if messages at the provided level are compiled out
+    /// (see OPENSIM_LOG_ACTIVE_LEVEL).
+    static constexpr bool isActive(Level level) {
+        return static_cast<int>(level) >= OPENSIM_LOG_ACTIVE_LEVEL;
+    }
+
     /// @name Commands to log messages
     /// Use these functions instead of using spdlog directly.
     /// @{
 
     template <typename... Args>
     static void critical(spdlog::string_view_t fmt, const Args&... args) {
-        if (shouldLog(Level::Critical)) {
+        if (isActive(Level::Critical) && shouldLog(Level::Critical)) {
             getDefaultLogger().critical(fmt, args...);
         }
     }
 
     template <typename... Args>
     static void error(spdlog::string_view_t fmt, const Args&... args) {
-        if (shouldLog(Level::Error)) {
+        if (isActive(Level::Error) && shouldLog(Level::Error)) {
             getDefaultLogger().error(fmt, args...);
         }
     }
 
     template <typename... Args>
     static void warn(spdlog::string_view_t fmt, const Args&... args) {
-        if (shouldLog(Level::Warn)) {
+        if (isActive(Level::Warn) && shouldLog(Level::Warn)) {
             getDefaultLogger().warn(fmt, args...);
         }
     }
 
     template <typename... Args>
     static void info(spdlog::string_view_t fmt, const Args&... args) {
-        if (shouldLog(Level::Info)) {
+        if (isActive(Level::Info) && shouldLog(Level::Info)) {
             getDefaultLogger().info(fmt, args...);
         }
     }
 
     template <typename... Args>
     static void debug(spdlog::string_view_t fmt, const Args&... args) {
-        if (shouldLog(Level::Debug)) {
+        if (isActive(Level::Debug) && shouldLog(Level::Debug)) {
             getDefaultLogger().debug(fmt, args...);
         }
     }
 
     template <typename... Args>
     static void trace(spdlog::string_view_t fmt, const Args&... args) {
-        if (shouldLog(Level::Trace)) {
+        if (isActive(Level::Trace) && shouldLog(Level::Trace)) {
             getDefaultLogger().trace(fmt, args...);
         }
     }
@@ -167,6 +184,17 @@ public:
     /// @note If filepath can't be opened, no log file is created.
     static void addFileSink(const std::string& filepath = "opensim.log");
 
+    /// Same as addFileSink(), but messages are written to the file by a
+    /// background thread, so that logging does not wait on the disk. Up to
+    /// queueCapacity messages are buffered; when the buffer is full, logging
+    /// blocks until the background thread catches up, so that no messages
+    /// are lost. Use this for long batch runs that produce large logs.
+    /// Remove the sink with removeFileSink(), which writes all buffered
+    /// messages before returning.
+    /// @note This function is not thread-safe, like addFileSink().
+    static void addAsyncFileSink(const std::string& filepath = "opensim.log",
+            int queueCapacity = 8192);
+
     /// Remove the filesink if it exists.
     /// If the filesink was already removed, then this does nothing.
     /// @note This function is not thread-safe. Do not invoke this function
@@ -187,6 +215,27 @@ private:
     static spdlog::logger& getDefaultLogger();
 };
 
+#ifndef SWIG
+/// Counts the occurrences of a message from one call site so that only some
+/// of them are logged. Use this through OPENSIM_LOG_WARN_EVERY_N() and
+/// OPENSIM_LOG_WARN_ONCE() rather than directly. This class is thread-safe.
+class LogRateLimiter {
+public:
+    /// Log the first occurrence and then every everyN-th occurrence.
+    explicit LogRateLimiter(long everyN) : m_everyN(everyN > 0 ? everyN : 1) {}
+    /// Count an occurrence and return the total number of occurrences,
+    /// including this one.
+    long count() { return ++m_count; }
+    /// Whether the occurrence with the given number should be logged.
+    bool shouldLog(long occurrence) const {
+        return (occurrence - 1) % m_everyN == 0;
+    }
+private:
+    std::atomic<long> m_count{0};
+    const long m_everyN;
+};
+#endif
+
 /// @name Logging functions
 /// @{
 
@@ -237,4 +286,63 @@ void log_cout(spdlog::string_view_t fmt, const Args&... args) {
 
 } // namespace OpenSim
 
+#ifndef SWIG
+
+/// @name Logging macros
+/// Unlike the logging functions, these macros evaluate their arguments only if
+/// the message is logged, and not at all if the message's level is compiled
+/// out (see OPENSIM_LOG_ACTIVE_LEVEL). Use them in hot paths (e.g., code
+/// evaluated at every integration step or optimizer iteration) where the
+/// arguments are expensive to compute or format.
+/// @code
+/// OPENSIM_LOG_DEBUG("Muscle '{}': fiber length = {}.", getName(),
+///         getFiberLength(s));
+/// @endcode
+/// @{
+
+#define OPENSIM_LOG_IMPL_(LEVEL, FUNC, ...)                                   \
+    do {                                                                      \
+        if (OpenSim::Logger::isActive(OpenSim::Logger::Level::LEVEL) &&       \
+                OpenSim::Logger::shouldLog(OpenSim::Logger::Level::LEVEL)) {  \
+            OpenSim::Logger::FUNC(__VA_ARGS__);                               \
+        }                                                                     \
+    } while (false)
+
+#define OPENSIM_LOG_CRITICAL(...)                                             \
+    OPENSIM_LOG_IMPL_(Critical, critical, __VA_ARGS__)
+#define OPENSIM_LOG_ERROR(...) OPENSIM_LOG_IMPL_(Error, error, __VA_ARGS__)
+#define OPENSIM_LOG_WARN(...) OPENSIM_LOG_IMPL_(Warn, warn, __VA_ARGS__)
+#define OPENSIM_LOG_INFO(...) OPENSIM_LOG_IMPL_(Info, info, __VA_ARGS__)
+#define OPENSIM_LOG_DEBUG(...) OPENSIM_LOG_IMPL_(Debug, debug, __VA_ARGS__)
+#define OPENSIM_LOG_TRACE(...) OPENSIM_LOG_IMPL_(Trace, trace, __VA_ARGS__)
+
+/// Log a warning the first time this line is reached and then only every
+/// N-th time, for warnings that may repeat many times in a run (e.g., a
+/// failure at every time step). Logged repetitions are followed by the
+/// number of times the warning has occurred.
+#define OPENSIM_LOG_WARN_EVERY_N(N, ...)                                      \
+    do {                                                                      \
+        if (OpenSim::Logger::isActive(OpenSim::Logger::Level::Warn) &&        \
+                OpenSim::Logger::shouldLog(OpenSim::Logger::Level::Warn)) {   \
+            static OpenSim::LogRateLimiter opensimLogRateLimiter_(N);         \
+            const long opensimLogOccurrence_ = opensimLogRateLimiter_.count(); \
+            if (opensimLogRateLimiter_.shouldLog(opensimLogOccurrence_)) {    \
+                OpenSim::Logger::warn(__VA_ARGS__);                           \
+                if (opensimLogOccurrence_ > 1) {                              \
+                    OpenSim::Logger::warn("(Warning above occurred {} times; " \
+                            "logging every {}th occurrence.)",                \
+                            opensimLogOccurrence_, (N));                      \
+                }                                                             \
+            }                                                                 \
+        }                                                                     \
+    } while (false)
+
+/// Log a warning only the first time this line is reached.
+#define OPENSIM_LOG_WARN_ONCE(...)                                            \
+    OPENSIM_LOG_WARN_EVERY_N(std::numeric_limits<long>::max(), __VA_ARGS__)
+
+/// @}
+
+#endif // SWIG
+
 #endif // OPENSIM_LOG_H_
@@ -670,6 +670,73 @@ double SimmSpline::calcDerivative(const std::vector<int>& derivComponents, const
       return (2.0*_c[k] + 6.0*dx*_d[k]);
 }
 
+void SimmSpline::calcValueAndDerivatives(double aX, int aMaxDerivOrder,
+        double* rValues, int& rInterval) const
+{
+    if (aMaxDerivOrder < 0 || aMaxDerivOrder > 2)
+        throw Exception("SimmSpline::calcValueAndDerivatives(): derivative "
+                        "order must be 0, 1 or 2.");
+
+    // NOT A NUMBER
+    if(!_y.getSize() || !_b.getSize() || !_c.getSize() || !_d.getSize()) {
+        for (int k = 0; k <= aMaxDerivOrder; ++k) rValues[k] = SimTK::NaN;
+        return;
+    }
+
+    int n = _x.getSize();
+    double value, deriv1, deriv2;
+
+    // Same extrapolation and end point handling as calcValue() and
+    // calcDerivative().
+    if (aX < _x[0]) {
+        value = _y[0] + (aX - _x[0])*_b[0];
+        deriv1 = _b[0];
+        deriv2 = 0;
+    } else if (aX > _x[n-1]) {
+        value = _y[n-1] + (aX - _x[n-1])*_b[n-1];
+        deriv1 = _b[n-1];
+        deriv2 = 0;
+    } else if (EQUAL_WITHIN_ERROR(aX,_x[0])) {
+        value = _y[0];
+        deriv1 = _b[0];
+        deriv2 = 2.0*_c[0];
+    } else if (EQUAL_WITHIN_ERROR(aX,_x[n-1])) {
+        value = _y[n-1];
+        deriv1 = _b[n-1];
+        deriv2 = 2.0*_c[n-1];
+    } else {
+        int k = 0;
+        if (n >= 3) {
+            k = rInterval;
+            if (k < 0 || k > n-2 || aX < _x[k] || aX > _x[k+1]) {
+                // Binary search for the two points the abscissa is between.
+                int i = 0;
+                int j = n;
+                while (1)
+                {
+                    k = (i+j)/2;
+                    if (aX < _x[k])
+                        j = k;
+                    else if (aX > _x[k+1])
+                        i = k;
+                    else
+                        break;
+                }
+            }
+        }
+        rInterval = k;
+
+        double dx = aX - _x[k];
+        value = _y[k] + dx*(_b[k] + dx*(_c[k] + dx*_d[k]));
+        deriv1 = _b[k] + dx*(2.0*_c[k] + 3.0*dx*_d[k]);
+        deriv2 = 2.0*_c[k] + 6.0*dx*_d[k];
+    }
+
+    rValues[0] = value;
+    if (aMaxDerivOrder >= 1) rValues[1] = deriv1;
+    if (aMaxDerivOrder >= 2) rValues[2] = deriv2;
+}
+
 int SimmSpline::getArgumentSize() const
 {
     return 1;
@@ -123,6 +123,22 @@ public:
     int getArgumentSize() const override;
     int getMaxDerivativeOrder() const override;
     SimTK::Function* createSimTKFunction() const override;
+#ifndef SWIG
+    /**
+     * Evaluate the spline and its derivatives up to order aMaxDerivOrder
+     * (at most 2) at aX, writing the value to rValues[0], the first
+     * derivative to rValues[1], and the second derivative to rValues[2].
+     * The values are identical to those from calcValue() and
+     * calcDerivative().
+     *
+     * @param rInterval Index k of the knot interval [x_k, x_k+1] containing
+     * aX. The value passed in is checked first, so reusing it across calls
+     * with nearby aX, or across splines that share the same knots, avoids
+     * the binary search.
+     */
+    void calcValueAndDerivatives(double aX, int aMaxDerivOrder,
+            double* rValues, int& rInterval) const;
+#endif
 
     void updateFromXMLNode(SimTK::Xml::Element& aNode, int versionNumber=-1) override;
 
@@ -41,6 +41,7 @@
 #include "StateVector.h"
 #include "TableUtilities.h"
 #include "TimeSeriesTable.h"
+#include <algorithm>
 #include <iostream>
 
 using namespace OpenSim;
@@ -1093,11 +1094,14 @@ getDataAtTime(double aT,int aN,double **rData) const
     }
 
 
-    for(i=0;i<ns;i++) {
+    // INTERPOLATE ALL COLUMNS IN ONE PASS OVER CONTIGUOUS MEMORY
+    if(ns>0) {
+        const double* p1 = &y1[0];
+        const double* p2 = &y2[0];
         if(pct==0.0) {
-            y[i] = y1[i];
+            std::copy(p1, p1+ns, y);
         } else {
-            y[i] = y1[i] + pct*(y2[i]-y1[i]);
+            for(i=0;i<ns;i++) y[i] = p1[i] + pct*(p2[i]-p1[i]);
         }
     }
 
@@ -1132,6 +1136,14 @@ getDataAtTime(double aT,int aN,Array<double> &rData) const
 int Storage::
 getDataAtTime(double aT,int aN,SimTK::Vector& v) const
 {
+    // Interpolate directly into v when possible.
+    if(aN>0 && v.hasContiguousData()) {
+        double* data = &v[0];
+        int r = getDataAtTime(aT,aN,&data);
+        for (int i=r; i<aN; ++i)
+            v[i] = 0.0;
+        return r;
+    }
     Array<double> rData;
     rData.setSize(aN);
     int r = getDataAtTime(aT,aN,rData);
@@ -2476,9 +2488,10 @@ lowpassFIR(int aOrder,double aCutoffFrequency)
  * or at time aT ( aT <= getTime(index) ).
  *
  * This method can be much more efficient than findIndex(aT) if a good guess
- * is made for aI.
- * If aI corresponds to a state which occurred later than aT, an exhaustive
- * search is performed by calling findIndex(aT).
+ * is made for aI. The interval starting at aI and the one following it are
+ * checked first, so that stepping forward through the storage (e.g., during
+ * an integration) takes constant time. Otherwise, a binary search over the
+ * (monotonically increasing) times is performed.
  *
  * @param aI Index at which to start searching.
  * @param aT Time.
@@ -2489,27 +2502,29 @@ int Storage::
 findIndex(int aI,double aT) const
 {
     // MAKE SURE aI IS VALID
-    if(_storage.getSize()<=0) return(-1);
-    if((aI>=_storage.getSize())||(aI<0)) aI=0;
-    if(getStateVector(aI)->getTime()>aT) aI=0;
-
-    // SEARCH
-    //cout << "Storage.findIndex: starting at " << aI << endl;
-    int i;
-    for(i=aI;i<_storage.getSize();i++) {
-        if(aT<getStateVector(i)->getTime()) break;
+    const int size = _storage.getSize();
+    if(size<=0) return(-1);
+    if((aI>=size)||(aI<0)) aI=0;
+
+    // CHECK THE GUESSED INTERVAL AND THE ONE FOLLOWING IT
+    if(_storage[aI].getTime()<=aT) {
+        for(int i=aI;i<size && i<=aI+1;i++) {
+            if((i+1==size) || (aT<_storage[i+1].getTime())) {
+                _lastI = i;
+                return(_lastI);
+            }
+        }
+        return(findIndexInRange(aI+2,size,aT));
     }
-    _lastI = i-1;
-    if(_lastI<0) _lastI=0;
-    return(_lastI);
+    return(findIndexInRange(0,aI,aT));
 }
 //_____________________________________________________________________________
 /**
  * Find the index of the storage element that occurred immediately before
  * or at a specified time ( getTime(index) <= aT ).
  *
- * This method is not very efficient because it always starts its search
- * with the first stored state.
+ * The search is a binary search, so the times in the storage are assumed
+ * to be monotonically increasing.
  *
  * @param aT Time.
  * @return Index preceding or at time aT.  If aT is less than the earliest
@@ -2519,11 +2534,25 @@ int Storage::
 findIndex(double aT) const
 {
     if(_storage.getSize()<=0) return(-1);
-    int i;
-    for(i=0;i<_storage.getSize();i++) {
-        if(aT<getStateVector(i)->getTime()) break;
+    return(findIndexInRange(0,_storage.getSize(),aT));
+}
+//_____________________________________________________________________________
+/**
+ * Binary search for the index of the first storage element in
+ * [aBegin, aEnd) whose time is greater than aT; the index preceding it is
+ * returned (and remembered for the next search).
+ */
+int Storage::
+findIndexInRange(int aBegin,int aEnd,double aT) const
+{
+    int lo = aBegin;
+    int hi = aEnd;
+    while(lo<hi) {
+        const int mid = lo + (hi-lo)/2;
+        if(aT<_storage[mid].getTime()) hi = mid;
+        else lo = mid+1;
     }
-    _lastI = i-1;
+    _lastI = lo-1;
     if(_lastI<0) _lastI=0;
     return(_lastI);
 }
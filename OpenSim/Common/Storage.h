@@ -337,6 +337,9 @@ public:
     //--------------------------------------------------------------------------
     int findIndex(double aT) const override;
     int findIndex(int aI,double aT) const override;
+private:
+    int findIndexInRange(int aBegin,int aEnd,double aT) const;
+public:
     void findFrameRange(double aStartTime, double aEndTime, int& oStartFrame, int& oEndFrame) const;
     double resample(double aDT, int aDegree);
     double resampleLinear(double aDT);
@@ -0,0 +1,144 @@
+/* -------------------------------------------------------------------------- *
+ *                        OpenSim:  testDataQueue.cpp                         *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * See http://opensim.stanford.edu and the NOTICE file for more information.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2005-2020 Stanford University and the Authors                *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#include <OpenSim/Common/DataQueue.h>
+#include <OpenSim/Auxiliary/auxiliaryTestFunctions.h>
+#include <thread>
+
+using namespace OpenSim;
+using namespace std;
+
+SimTK::RowVector_<double> makeRow(double value) {
+    return SimTK::RowVector_<double>(3, value);
+}
+
+void testProducerConsumer() {
+    // With the Block policy, a producer faster than the consumer must block
+    // rather than lose data or grow the queue beyond its capacity.
+    const int numRows = 200;
+    DataQueue_<double> queue(8, DataQueueOverflowPolicy::Block);
+    thread producer([&queue] {
+        for (int i = 0; i < numRows; ++i) queue.push_back(i, makeRow(i));
+    });
+
+    double time;
+    SimTK::RowVector_<double> row;
+    for (int i = 0; i < numRows; ++i) {
+        queue.pop_front(time, row);
+        SimTK_TEST(time == i);
+        SimTK_TEST(row.size() == 3);
+        SimTK_TEST(row[2] == i);
+    }
+    producer.join();
+
+    SimTK_TEST(queue.isEmpty());
+    const auto stats = queue.getStatistics();
+    SimTK_TEST(stats.numPushed == numRows);
+    SimTK_TEST(stats.numPopped == numRows);
+    SimTK_TEST(stats.numDropped == 0);
+    SimTK_TEST(stats.maxSize <= queue.getCapacity());
+    SimTK_TEST(stats.maxLatency >= stats.meanLatency);
+}
+
+void testOverflowPolicies() {
+    double time;
+    SimTK::RowVector_<double> row;
+
+    // The default policy is bounded.
+    SimTK_TEST(DataQueue_<double>().getOverflowPolicy() ==
+               DataQueueOverflowPolicy::DropOldest);
+
+    // With Grow, a single thread can push any number of rows before
+    // consuming them.
+    DataQueue_<double> grow(4, DataQueueOverflowPolicy::Grow);
+    for (int i = 0; i < 3000; ++i) grow.push_back(i, makeRow(i));
+    SimTK_TEST(grow.size() == 3000);
+    SimTK_TEST(grow.getCapacity() >= 3000);
+    SimTK_TEST(grow.getStatistics().numDropped == 0);
+    for (int i = 0; i < 3000; ++i) {
+        grow.pop_front(time, row);
+        SimTK_TEST(time == i);
+        SimTK_TEST(row[0] == i);
+    }
+
+    // A full Block queue throws rather than waiting for the thread that
+    // consumes from it.
+    DataQueue_<double> block(2, DataQueueOverflowPolicy::Block);
+    block.push_back(0, makeRow(0));
+    block.pop_front(time, row);
+    block.push_back(1, makeRow(1));
+    block.push_back(2, makeRow(2));
+    SimTK_TEST_MUST_THROW_EXC(block.push_back(3, makeRow(3)), Exception);
+    SimTK_TEST(block.size() == 2);
+
+    DataQueue_<double> dropOldest(4, DataQueueOverflowPolicy::DropOldest);
+    for (int i = 0; i < 10; ++i) dropOldest.push_back(i, makeRow(i));
+    SimTK_TEST(dropOldest.size() == 4);
+    SimTK_TEST(dropOldest.getStatistics().numDropped == 6);
+    dropOldest.pop_front(time, row);
+    SimTK_TEST(time == 6);
+    SimTK_TEST(row[0] == 6);
+
+    DataQueue_<double> latestOnly(4, DataQueueOverflowPolicy::LatestOnly);
+    for (int i = 0; i < 3; ++i) latestOnly.push_back(i, makeRow(i));
+    SimTK_TEST(latestOnly.size() == 1);
+    latestOnly.pop_front(time, row);
+    SimTK_TEST(time == 2);
+
+    // Shrinking keeps the newest entries.
+    DataQueue_<double> queue(8);
+    for (int i = 0; i < 5; ++i) queue.push_back(i, makeRow(i));
+    queue.setCapacity(2);
+    SimTK_TEST(queue.getCapacity() == 2);
+    SimTK_TEST(queue.size() == 2);
+    queue.pop_front(time, row);
+    SimTK_TEST(time == 3);
+
+    SimTK_TEST_MUST_THROW(DataQueue_<double>(0));
+}
+
+void testTryPop() {
+    double time = -1;
+    SimTK::RowVector_<double> row;
+    DataQueue_<double> queue(2);
+    SimTK_TEST(!queue.try_pop_front(time, row));
+    SimTK_TEST(!queue.try_pop_front(time, row, chrono::milliseconds(5)));
+    SimTK_TEST(time == -1);
+
+    thread producer([&queue] {
+        this_thread::sleep_for(chrono::milliseconds(10));
+        queue.push_back(0.5, makeRow(1));
+    });
+    SimTK_TEST(queue.try_pop_front(time, row, chrono::seconds(10)));
+    SimTK_TEST(time == 0.5);
+    producer.join();
+}
+
+int main() {
+    SimTK_START_TEST("testDataQueue");
+        SimTK_SUBTEST(testProducerConsumer);
+        SimTK_SUBTEST(testOverflowPolicies);
+        SimTK_SUBTEST(testTryPop);
+    SimTK_END_TEST();
+
+    return 0;
+}
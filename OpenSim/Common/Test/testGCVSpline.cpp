@@ -22,6 +22,8 @@
 
 #include <OpenSim/Common/GCVSpline.h>
 #include <OpenSim/Common/GCVSplineSet.h>
+#include <OpenSim/Common/SimmSpline.h>
+#include <OpenSim/Common/Constant.h>
 #include <OpenSim/Auxiliary/auxiliaryTestFunctions.h>
 
 using namespace OpenSim;
@@ -82,6 +84,89 @@ int main() {
                 SimTK::Eps, __FILE__, __LINE__,
                 "Duplicate GCVSpline failed to reproduce identical first derivative.");
         }
+
+        // Batch evaluation of a FunctionSet must match evaluating each
+        // function separately, for splines sharing knots and for others.
+        FunctionSet functions;
+        functions.cloneAndAppend(spline);
+        for (int i = 0; i < size; ++i) y[i] = cos(omega*x[i]);
+        functions.adoptAndAppend(new GCVSpline(3, size, x, y));
+        functions.adoptAndAppend(new SimmSpline(size, x, y));
+        functions.adoptAndAppend(new Constant(2.5));
+        std::vector<int> secondDerivComponents(2, 0);
+        SimTK::Vector times(2*size + 1);
+        for (int j = 0; j < times.size(); ++j)
+            times[j] = T * j / (times.size() - 1);
+        SimTK::Matrix batch;
+        functions.calcValuesAndDerivatives(times, 2, batch);
+        ASSERT(batch.nrow() == 3*functions.getSize());
+        ASSERT(batch.ncol() == times.size());
+        for (int j = 0; j < times.size(); ++j) {
+            t[0] = times[j];
+            for (int i = 0; i < functions.getSize(); ++i) {
+                const Function& f = functions.get(i);
+                ASSERT_EQUAL(f.calcValue(t), batch(3*i, j), 1e-10,
+                    __FILE__, __LINE__,
+                    "FunctionSet batch value differs from calcValue().");
+                ASSERT_EQUAL(f.calcDerivative(derivComponents, t),
+                    batch(3*i + 1, j), 1e-8, __FILE__, __LINE__,
+                    "FunctionSet batch first derivative differs.");
+                ASSERT_EQUAL(f.calcDerivative(secondDerivComponents, t),
+                    batch(3*i + 2, j), 1e-6, __FILE__, __LINE__,
+                    "FunctionSet batch second derivative differs.");
+            }
+        }
+        cout << "FunctionSet batch evaluation matches calcValue()." << endl;
+
+        // Also on the knots (where the interval found for the previous time
+        // or function may be either neighbor of the knot) and outside the
+        // data range (extrapolation), visiting the times out of order.
+        std::vector<double> edgeTimes{-0.5, -dt/3};
+        for (int i = 0; i < size; ++i) edgeTimes.push_back(x[i]);
+        edgeTimes.push_back(T + dt/3);
+        edgeTimes.push_back(T + 0.5);
+        for (int i = size - 1; i >= 0; i -= 7) edgeTimes.push_back(x[i]);
+        edgeTimes.push_back(-dt/3);
+        edgeTimes.push_back(x[size/2]);
+        edgeTimes.push_back(T + 0.5);
+        std::vector<double> values(3*functions.getSize());
+        for (double edgeTime : edgeTimes) {
+            t[0] = edgeTime;
+            functions.calcValuesAndDerivatives(edgeTime, 2, values.data());
+            for (int i = 0; i < functions.getSize(); ++i) {
+                const Function& f = functions.get(i);
+                ASSERT_EQUAL(f.calcValue(t), values[3*i], 1e-10,
+                    __FILE__, __LINE__,
+                    "FunctionSet value differs from calcValue() on a knot "
+                    "or outside the data range.");
+                ASSERT_EQUAL(f.calcDerivative(derivComponents, t),
+                    values[3*i + 1], 1e-8, __FILE__, __LINE__,
+                    "FunctionSet first derivative differs on a knot or "
+                    "outside the data range.");
+                ASSERT_EQUAL(f.calcDerivative(secondDerivComponents, t),
+                    values[3*i + 2], 1e-6, __FILE__, __LINE__,
+                    "FunctionSet second derivative differs on a knot or "
+                    "outside the data range.");
+            }
+        }
+        SimTK::Vector edgeTimesVector((int)edgeTimes.size(), &edgeTimes[0]);
+        functions.calcValuesAndDerivatives(edgeTimesVector, 2, batch);
+        for (int j = 0; j < edgeTimesVector.size(); ++j) {
+            t[0] = edgeTimesVector[j];
+            for (int i = 0; i < functions.getSize(); ++i) {
+                const Function& f = functions.get(i);
+                ASSERT_EQUAL(f.calcValue(t), batch(3*i, j), 1e-10,
+                    __FILE__, __LINE__,
+                    "FunctionSet batch value differs from calcValue() on a "
+                    "knot or outside the data range.");
+                ASSERT_EQUAL(f.calcDerivative(derivComponents, t),
+                    batch(3*i + 1, j), 1e-8, __FILE__, __LINE__,
+                    "FunctionSet batch first derivative differs on a knot "
+                    "or outside the data range.");
+            }
+        }
+        cout << "FunctionSet evaluation matches calcValue() on the knots "
+                "and outside the data range." << endl;
     }
     catch(const Exception& e) {
         e.print(cerr);
@@ -0,0 +1,113 @@
+/* -------------------------------------------------------------------------- *
+ *                          OpenSim:  testLogger.cpp                           *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * See http://opensim.stanford.edu and the NOTICE file for more information.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2005-2020 Stanford University and the Authors                *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+
+#include <OpenSim/Common/Logger.h>
+#include <OpenSim/Common/LogSink.h>
+#include <OpenSim/Auxiliary/auxiliaryTestFunctions.h>
+#include <cstdio>
+#include <fstream>
+
+using namespace OpenSim;
+using namespace std;
+
+static int numEvaluations = 0;
+int countEvaluation() { return ++numEvaluations; }
+
+int countOccurrences(const string& str, const string& substr) {
+    int count = 0;
+    for (auto pos = str.find(substr); pos != string::npos;
+            pos = str.find(substr, pos + 1)) {
+        ++count;
+    }
+    return count;
+}
+
+void testLazyArguments() {
+    auto sink = make_shared<StringLogSink>();
+    Logger::addSink(sink);
+    Logger::setLevel(Logger::Level::Info);
+
+    // Arguments of messages that are not logged are not evaluated.
+    numEvaluations = 0;
+    OPENSIM_LOG_DEBUG("evaluation {}", countEvaluation());
+    SimTK_TEST(numEvaluations == 0);
+    OPENSIM_LOG_INFO("evaluation {}", countEvaluation());
+    SimTK_TEST(numEvaluations == 1);
+    SimTK_TEST(sink->getString().find("evaluation 1") != string::npos);
+
+    Logger::removeSink(sink);
+}
+
+void testRateLimitedWarnings() {
+    auto sink = make_shared<StringLogSink>();
+    Logger::addSink(sink);
+    Logger::setLevel(Logger::Level::Info);
+
+    for (int i = 0; i < 25; ++i) {
+        OPENSIM_LOG_WARN_EVERY_N(10, "failure {}", i);
+    }
+    SimTK_TEST(countOccurrences(sink->getString(), "failure") == 3);
+    SimTK_TEST(sink->getString().find("failure 10") != string::npos);
+    SimTK_TEST(sink->getString().find("occurred 21 times") != string::npos);
+
+    sink->clear();
+    for (int i = 0; i < 5; ++i) {
+        OPENSIM_LOG_WARN_ONCE("repeated {}", i);
+    }
+    SimTK_TEST(countOccurrences(sink->getString(), "repeated") == 1);
+
+    Logger::removeSink(sink);
+}
+
+void testAsyncFileSink() {
+    const string filename = "testLogger_async.log";
+    remove(filename.c_str());
+    Logger::setLevel(Logger::Level::Info);
+    Logger::removeFileSink();
+    // A small queue makes the logging thread wait on the background thread.
+    Logger::addAsyncFileSink(filename, 4);
+    const int numMessages = 1000;
+    for (int i = 0; i < numMessages; ++i) log_info("message {}", i);
+    // Removing the sink writes all buffered messages.
+    Logger::removeFileSink();
+
+    ifstream file(filename);
+    string line, lastLine;
+    int numLines = 0;
+    while (getline(file, line)) {
+        ++numLines;
+        lastLine = line;
+    }
+    SimTK_TEST(numLines == numMessages);
+    SimTK_TEST(lastLine.find("message 999") != string::npos);
+}
+
+int main() {
+    SimTK_START_TEST("testLogger");
+        SimTK_SUBTEST(testLazyArguments);
+        SimTK_SUBTEST(testRateLimitedWarnings);
+        SimTK_SUBTEST(testAsyncFileSink);
+    SimTK_END_TEST();
+
+    return 0;
+}
@@ -170,6 +170,55 @@ void testStorageGetStateIndexBackwardsCompatibility() {
     // TODO: Put XML document version in Storage header.
 }
 
+void testStorageFindIndexAndGetDataAtTime() {
+    // Nonuniform times so that the index cannot be guessed from the time.
+    Storage sto;
+    const int nrow = 50;
+    const int ncol = 4;
+    std::vector<double> times(nrow);
+    for (int i = 0; i < nrow; ++i) {
+        times[i] = 0.1 * i + 0.001 * i * i;
+        SimTK::Vector row(ncol);
+        for (int j = 0; j < ncol; ++j) row[j] = (j + 1) * times[i];
+        sto.append(times[i], row);
+    }
+
+    // Reference: the last index whose time is <= t (0 if before the start).
+    auto expectedIndex = [&](double t) {
+        int index = 0;
+        for (int i = 0; i < nrow; ++i) {
+            if (times[i] <= t) index = i;
+        }
+        return index;
+    };
+
+    std::vector<double> queries;
+    // Forward, backward, and jumping access, including the end points,
+    // times exactly on a row, and times outside the range.
+    for (int i = -2; i < 2 * nrow + 2; ++i) queries.push_back(0.05 * i);
+    for (int i = 2 * nrow + 2; i >= -2; --i) queries.push_back(0.05 * i);
+    for (int i = 0; i < nrow; i += 7) queries.push_back(times[nrow - 1 - i]);
+    for (int i = 0; i < nrow; ++i) queries.push_back(times[i]);
+
+    int guess = 0;
+    SimTK::Vector data(ncol);
+    for (const double& t : queries) {
+        const int expected = expectedIndex(t);
+        SimTK_TEST(sto.findIndex(t) == expected);
+        SimTK_TEST(sto.findIndex(guess, t) == expected);
+        guess = expected;
+
+        SimTK_TEST(sto.getDataAtTime(t, ncol, data) == ncol);
+        // Data are linear in time, so the interpolation is exact within the
+        // time range.
+        if (times[0] <= t && t <= times[nrow - 1]) {
+            for (int j = 0; j < ncol; ++j) {
+                SimTK_TEST_EQ(data[j], (j + 1) * t);
+            }
+        }
+    }
+}
+
 int main() {
     SimTK_START_TEST("testStorage");
 
@@ -194,6 +243,8 @@ int main() {
         SimTK_SUBTEST(testStorageLegacy);
 
         SimTK_SUBTEST(testStorageGetStateIndexBackwardsCompatibility);
+
+        SimTK_SUBTEST(testStorageFindIndexAndGetDataAtTime);
     SimTK_END_TEST();
 }
 
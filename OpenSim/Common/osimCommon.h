@@ -26,6 +26,7 @@
 #include "About.h"
 #include "Adapters.h"
 #include "CommonUtilities.h"
+#include "ComponentProfiler.h"
 #include "Constant.h"
 #include "DataTable.h"
 #include "FunctionSet.h"
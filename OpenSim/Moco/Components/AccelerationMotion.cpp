@@ -81,6 +81,8 @@ const SimTK::Vector& AccelerationMotion::getUDot(
 void AccelerationMotion::setEnabled(
         SimTK::State& state, bool enabled) const {
     for (auto& motion : m_motions) {
+        // Avoid invalidating the state if nothing changes.
+        if (motion.isDisabled(state) != enabled) continue;
         if (enabled) {
             motion.enable(state);
         } else {
@@ -52,7 +52,9 @@ public:
     const SimTK::Vector& getUDot(const SimTK::State& state,
             SimTK::MobilizedBodyIndex mobodIdx) const;
     /// Use this to set whether the prescribed acceleration motion is used or
-    /// not.
+    /// not. Enabling or disabling the motion invalidates
+    /// SimTK::Stage::Instance, unless the motion is already in the requested
+    /// state.
     void setEnabled(SimTK::State& state, bool enabled) const;
 protected:
 private:
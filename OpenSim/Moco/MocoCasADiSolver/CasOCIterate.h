@@ -62,6 +62,14 @@ struct Iterate {
     std::vector<std::string> derivative_names;
     std::vector<std::string> parameter_names;
     int iteration = -1;
+    /// Multipliers for the bounds on the NLP variables and for the NLP
+    /// constraints. In a guess, these are optional and are used to
+    /// warm-start the dual variables only if their sizes match the NLP and
+    /// the guess's times match the grid. These are not resampled. The
+    /// variable multipliers are in the "by-type" order, regardless of
+    /// Solver::setVariableOrdering().
+    casadi::DM nlp_variable_multipliers;
+    casadi::DM nlp_constraint_multipliers;
     /// Return a new iterate in which the data is resampled at the times in
     /// newTimes.
     Iterate resample(const casadi::DM& newTimes) const;
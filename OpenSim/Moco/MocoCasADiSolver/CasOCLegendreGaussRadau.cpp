@@ -0,0 +1,102 @@
+/* -------------------------------------------------------------------------- *
+ * OpenSim: CasOCLegendreGaussRadau.cpp                                       *
+ * -------------------------------------------------------------------------- *
+ * Copyright (c) 2020 Stanford University and the Authors                     *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0          *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+#include "CasOCLegendreGaussRadau.h"
+
+using casadi::DM;
+using casadi::MX;
+using casadi::Slice;
+
+namespace CasOC {
+
+void LegendreGaussRadau::createCollocationCoefficients(
+        const std::vector<double>& points) {
+    // The start of the mesh interval followed by the collocation points.
+    std::vector<double> tau(1, 0.0);
+    tau.insert(tau.end(), points.begin(), points.end());
+
+    m_differentiationMatrix = DM::zeros(m_degree + 1, m_degree);
+    m_quadratureWeights = DM::zeros(m_degree, 1);
+    for (int j = 0; j < m_degree + 1; ++j) {
+        // Lagrange polynomial that is 1 at tau[j] and 0 at the other points.
+        casadi::Polynomial p = 1;
+        for (int r = 0; r < m_degree + 1; ++r) {
+            if (r != j) {
+                p *= casadi::Polynomial(-tau[r], 1) / (tau[j] - tau[r]);
+            }
+        }
+        const casadi::Polynomial dp = p.derivative();
+        for (int k = 0; k < m_degree; ++k) {
+            m_differentiationMatrix(j, k) = dp(tau[k + 1]);
+        }
+    }
+    // The Gauss-Radau weights are the integrals of the Lagrange polynomials
+    // on the collocation points only (the start of the interval is not a
+    // quadrature point). For degree 1, this gives a weight of 1 (backward
+    // Euler).
+    for (int j = 0; j < m_degree; ++j) {
+        casadi::Polynomial p = 1;
+        for (int r = 0; r < m_degree; ++r) {
+            if (r != j) {
+                p *= casadi::Polynomial(-points[r], 1) /
+                     (points[j] - points[r]);
+            }
+        }
+        m_quadratureWeights(j) = p.anti_derivative()(1.0);
+    }
+}
+
+DM LegendreGaussRadau::createQuadratureCoefficientsImpl() const {
+    const DM mesh(m_solver.getMesh());
+    const DM meshIntervals = mesh(Slice(1, m_numMeshPoints)) -
+                             mesh(Slice(0, m_numMeshPoints - 1));
+    // The start of each mesh interval is not a quadrature point, so the
+    // coefficient of the initial grid point is zero.
+    DM quadCoeffs(m_numGridPoints, 1);
+    for (int imesh = 0; imesh < m_numMeshIntervals; ++imesh) {
+        for (int k = 0; k < m_degree; ++k) {
+            quadCoeffs(imesh * m_degree + k + 1) +=
+                    m_quadratureWeights(k) * meshIntervals(imesh);
+        }
+    }
+    return quadCoeffs;
+}
+
+DM LegendreGaussRadau::createMeshIndicesImpl() const {
+    DM indices = DM::zeros(1, m_numGridPoints);
+    for (int i = 0; i < m_numGridPoints; i += m_degree) { indices(i) = 1; }
+    return indices;
+}
+
+void LegendreGaussRadau::calcDefectsImpl(const casadi::MX& x,
+        const casadi::MX& xdot, casadi::MX& defects) const {
+    // For more information, see doxygen documentation for the class.
+    for (int imesh = 0; imesh < m_numMeshIntervals; ++imesh) {
+        const int igrid = imesh * m_degree;
+        const auto h = m_times(igrid + m_degree) - m_times(igrid);
+        // States at the start of the mesh interval and the collocation
+        // points.
+        const auto x_i = x(Slice(), Slice(igrid, igrid + m_degree + 1));
+        // State derivatives at the collocation points.
+        const auto xdot_i =
+                xdot(Slice(), Slice(igrid + 1, igrid + m_degree + 1));
+        // The defects for the first collocation point are first, followed
+        // by the defects for the second collocation point, etc.
+        defects(Slice(), imesh) = MX::vec(
+                MX::mtimes(x_i, m_differentiationMatrix) - h * xdot_i);
+    }
+}
+
+} // namespace CasOC
@@ -0,0 +1,96 @@
+#ifndef OPENSIM_CASOCLEGENDREGAUSSRADAU_H
+#define OPENSIM_CASOCLEGENDREGAUSSRADAU_H
+/* -------------------------------------------------------------------------- *
+ * OpenSim: CasOCLegendreGaussRadau.h                                         *
+ * -------------------------------------------------------------------------- *
+ * Copyright (c) 2020 Stanford University and the Authors                     *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0          *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#include "CasOCTranscription.h"
+
+namespace CasOC {
+
+/// Enforce the differential equations in the problem using a
+/// multiple-interval Legendre-Gauss-Radau (LGR) pseudospectral method. Within
+/// each mesh interval, the states are approximated by a polynomial of the
+/// given degree, and the integral in the objective function is approximated
+/// by Gauss-Radau quadrature.
+///
+/// Defect constraints.
+/// -------------------
+/// Each mesh interval contains `degree` collocation points: the roots of the
+/// flipped Legendre-Gauss-Radau polynomial, which include the end of the mesh
+/// interval but not the start. The state polynomial interpolates the states
+/// at the start of the mesh interval and at the collocation points. For each
+/// state variable, there is one defect constraint per collocation point,
+/// requiring that the derivative of the state polynomial matches the state
+/// derivative at the collocation point. Since the end of each mesh interval
+/// is a collocation point, the states are continuous across mesh intervals.
+///
+/// Kinematic constraints and path constraints.
+/// -------------------------------------------
+/// Kinematic constraint and path constraint errors are enforced only at the
+/// mesh points. Errors at the collocation points in the interior of the mesh
+/// intervals are ignored.
+class LegendreGaussRadau : public Transcription {
+public:
+    LegendreGaussRadau(
+            const Solver& solver, const Problem& problem, int degree)
+            : Transcription(solver, problem), m_degree(degree) {
+        OPENSIM_THROW_IF(degree < 1 || degree > 9, OpenSim::Exception,
+                "Expected the degree of the Legendre-Gauss-Radau "
+                "transcription to be between 1 and 9, but got {}.",
+                degree);
+        OPENSIM_THROW_IF(problem.getEnforceConstraintDerivatives(),
+                OpenSim::Exception,
+                "Enforcing kinematic constraint derivatives "
+                "not supported with Legendre-Gauss-Radau transcription.");
+        const auto& mesh = m_solver.getMesh();
+        const int numMeshIntervals = (int)mesh.size() - 1;
+        const auto points = casadi::collocation_points(m_degree, "radau");
+        casadi::DM grid = casadi::DM::zeros(1, numMeshIntervals * m_degree + 1);
+        for (int imesh = 0; imesh < numMeshIntervals; ++imesh) {
+            const double h = mesh[imesh + 1] - mesh[imesh];
+            grid(imesh * m_degree) = mesh[imesh];
+            for (int d = 0; d < m_degree - 1; ++d) {
+                grid(imesh * m_degree + d + 1) = mesh[imesh] + h * points[d];
+            }
+        }
+        grid(grid.numel() - 1) = mesh.back();
+        createCollocationCoefficients(points);
+        createVariablesAndSetBounds(grid, m_degree * m_problem.getNumStates());
+    }
+
+private:
+    casadi::DM createQuadratureCoefficientsImpl() const override;
+    casadi::DM createMeshIndicesImpl() const override;
+    void calcDefectsImpl(const casadi::MX& x, const casadi::MX& xdot,
+            casadi::MX& defects) const override;
+
+    /// Compute the differentiation matrix and quadrature weights for the
+    /// Lagrange polynomials through the start of a mesh interval and the
+    /// collocation points (normalized to [0, 1]).
+    void createCollocationCoefficients(const std::vector<double>& points);
+
+    int m_degree;
+    /// The derivative of the j-th Lagrange polynomial at the k-th collocation
+    /// point, in element (j, k). Size: (degree + 1) x degree.
+    casadi::DM m_differentiationMatrix;
+    /// The integral over the mesh interval of the Lagrange polynomial of each
+    /// collocation point. Size: degree.
+    casadi::DM m_quadratureWeights;
+};
+
+} // namespace CasOC
+
+#endif // OPENSIM_CASOCLEGENDREGAUSSRADAU_H
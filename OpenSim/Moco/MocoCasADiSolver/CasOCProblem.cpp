@@ -47,4 +47,84 @@ Problem::createKinematicConstraintEquationNamesImpl() const {
     return names;
 }
 
+void Problem::validateMultibodySystemFunction() const {
+    const auto& func = m_multibodySystemFunction;
+    OPENSIM_THROW_IF(getNumKinematicConstraintEquations(), Exception,
+            "A multibody system function cannot be used with problems that "
+            "have kinematic constraints, but the problem has {} kinematic "
+            "constraint equations.",
+            getNumKinematicConstraintEquations());
+    OPENSIM_THROW_IF(func.n_in() != 6 || func.n_out() != 4, Exception,
+            "Expected the multibody system function '{}' to have 6 inputs "
+            "and 4 outputs, but it has {} inputs and {} outputs.",
+            func.name(), func.n_in(), func.n_out());
+    const std::vector<int> inputSizes{1, getNumStates(), getNumControls(),
+            getNumMultipliers(), getNumDerivatives(), getNumParameters()};
+    for (int i = 0; i < (int)inputSizes.size(); ++i) {
+        OPENSIM_THROW_IF(func.numel_in(i) != inputSizes[i] ||
+                                 (inputSizes[i] && func.size2_in(i) != 1),
+                Exception,
+                "Expected input {} ('{}') of the multibody system function "
+                "'{}' to be a column vector with {} elements, but it has "
+                "size {}x{}.",
+                i, func.name_in(i), func.name(), inputSizes[i],
+                func.size1_in(i), func.size2_in(i));
+    }
+    const std::vector<int> outputSizes{getNumMultibodyDynamicsEquations(),
+            getNumAuxiliaryStates(), getNumAuxiliaryResidualEquations(), 0};
+    for (int i = 0; i < (int)outputSizes.size(); ++i) {
+        OPENSIM_THROW_IF(func.numel_out(i) != outputSizes[i] ||
+                                 (outputSizes[i] && func.size2_out(i) != 1),
+                Exception,
+                "Expected output {} ('{}') of the multibody system function "
+                "'{}' to be a column vector with {} elements, but it has "
+                "size {}x{}.",
+                i, func.name_out(i), func.name(), outputSizes[i],
+                func.size1_out(i), func.size2_out(i));
+    }
+}
+
+void Problem::checkMultibodySystemFunction(const VariablesDM& point) const {
+    // The model's multibody system, without kinematic constraints (which
+    // the provided function does not support).
+    std::unique_ptr<Function> modelFunc;
+    if (isDynamicsModeImplicit()) {
+        modelFunc = OpenSim::make_unique<MultibodySystemImplicit<false>>();
+    } else {
+        modelFunc = OpenSim::make_unique<MultibodySystemExplicit<false>>();
+    }
+    modelFunc->constructFunction(this, "model_multibody_system", "central",
+            std::make_shared<const std::vector<VariablesDM>>());
+
+    using casadi::Slice;
+    auto getFirstColumn = [&](Var var) -> casadi::DM {
+        const auto& value = point.at(var);
+        if (value.size1() == 0 || value.size2() == 0) {
+            return casadi::DM(value.size1(), 1);
+        }
+        return value(Slice(), 0);
+    };
+    const VectorDM args{point.at(initial_time), getFirstColumn(states),
+            getFirstColumn(controls), getFirstColumn(multipliers),
+            getFirstColumn(derivatives), point.at(parameters)};
+    const VectorDM expected = (*modelFunc)(args);
+    const VectorDM actual = m_multibodySystemFunction(args);
+    // Skip the kinematic constraint errors, which are always empty.
+    for (int i = 0; i < 3; ++i) {
+        if (expected[i].is_empty()) continue;
+        const double error =
+                casadi::DM::norm_inf(actual[i] - expected[i]).scalar();
+        const double scale =
+                1.0 + casadi::DM::norm_inf(expected[i]).scalar();
+        OPENSIM_THROW_IF(error > 1e-6 * scale, Exception,
+                "The multibody system function '{}' does not match the "
+                "model: at time {}, output {} ('{}') differs from the model "
+                "by up to {} (model: {}, function: {}). Was the function "
+                "generated for a different model or dynamics mode?",
+                m_multibodySystemFunction.name(),
+                point.at(initial_time).scalar(), i, modelFunc->name_out(i),
+                error, expected[i].T().get_str(), actual[i].T().get_str());
+    }
+}
+
 } // namespace CasOC
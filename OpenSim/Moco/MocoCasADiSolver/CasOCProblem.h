@@ -299,6 +299,18 @@ protected:
         m_auxiliaryDerivativeNames = names;
         m_numAuxiliaryResiduals = (int)names.size();
     }
+    /// Use the provided function for the multibody system instead of a
+    /// callback to calcMultibodySystemExplicit() or
+    /// calcMultibodySystemImplicit() that is differentiated with finite
+    /// differences. This allows using a function with exact derivatives
+    /// (e.g., one created by tracing the model's dynamics with CasADi
+    /// symbols). The function must have the same inputs and outputs as
+    /// MultibodySystemExplicit (or MultibodySystemImplicit, in implicit
+    /// dynamics mode). The function is used at all grid points, so the
+    /// problem must not have kinematic constraints.
+    void setMultibodySystemFunction(casadi::Function function) {
+        m_multibodySystemFunction = std::move(function);
+    }
 
 public:
     /// Kinematic constraint errors should be ordered as so:
@@ -329,6 +341,11 @@ public:
             const ContinuousInput& /*input*/,
             casadi::DM& /*path_constraint*/) const {}
 
+    /// The transcription invokes this if the initial and final times are
+    /// fixed, with the times of the grid points (at which integrands are
+    /// evaluated).
+    virtual void initializeOnGrid(const std::vector<double>& /*times*/) const {}
+
     virtual std::vector<std::string>
     createKinematicConstraintEquationNamesImpl() const;
 
@@ -345,6 +362,15 @@ public:
     /// @}
 
 public:
+    bool hasMultibodySystemFunction() const {
+        return !m_multibodySystemFunction.is_null();
+    }
+    /// Evaluate the function provided with setMultibodySystemFunction() and
+    /// the model's multibody system at the initial time of the provided
+    /// point, and throw an exception if the outputs differ. This catches a
+    /// function that was generated for a different model before solving.
+    void checkMultibodySystemFunction(const VariablesDM& point) const;
+
     /// Create an iterate with the variable names populated according to the
     /// variables added to this problem.
     template <typename IterateType = Iterate>
@@ -425,7 +451,10 @@ public:
             }
         }
 
-        if (m_dynamicsMode == "implicit") {
+        if (hasMultibodySystemFunction()) {
+            // The provided function replaces the multibody system callbacks.
+            validateMultibodySystemFunction();
+        } else if (m_dynamicsMode == "implicit") {
             // Construct a full implicit multibody system (i.e. including
             // kinematic constraints).
             mutThis->m_implicitMultibodyFunc =
@@ -570,6 +599,7 @@ public:
     /// Get a function to the full multibody system (i.e. including kinematic
     /// constraints errors).
     const casadi::Function& getMultibodySystem() const {
+        if (hasMultibodySystemFunction()) return m_multibodySystemFunction;
         return *m_multibodyFunc;
     }
     /// Get a function to the multibody system that does *not* compute kinematic
@@ -577,6 +607,7 @@ public:
     /// state derivatives at grid points where we do not want to enforce
     /// kinematic constraint errors.
     const casadi::Function& getMultibodySystemIgnoringConstraints() const {
+        if (hasMultibodySystemFunction()) return m_multibodySystemFunction;
         return *m_multibodyFuncIgnoringConstraints;
     }
     /// Get a function to compute the velocity correction to qdot when enforcing
@@ -587,15 +618,20 @@ public:
         return *m_velocityCorrectionFunc;
     }
     const casadi::Function& getImplicitMultibodySystem() const {
+        if (hasMultibodySystemFunction()) return m_multibodySystemFunction;
         return *m_implicitMultibodyFunc;
     }
     const casadi::Function&
     getImplicitMultibodySystemIgnoringConstraints() const {
+        if (hasMultibodySystemFunction()) return m_multibodySystemFunction;
         return *m_implicitMultibodyFuncIgnoringConstraints;
     }
     /// @}
 
 private:
+    /// Check that the inputs and outputs of the function provided with
+    /// setMultibodySystemFunction() have the expected sizes.
+    void validateMultibodySystemFunction() const;
     /// Clip endpoint to be as strict as b.
     void clipEndpointBounds(const Bounds& b, Bounds& endpoint) {
         endpoint.lower = std::max(b.lower, endpoint.lower);
@@ -633,6 +669,7 @@ private:
     std::unique_ptr<MultibodySystemImplicit<false>>
             m_implicitMultibodyFuncIgnoringConstraints;
     std::unique_ptr<VelocityCorrection> m_velocityCorrectionFunc;
+    casadi::Function m_multibodySystemFunction;
 };
 
 } // namespace CasOC
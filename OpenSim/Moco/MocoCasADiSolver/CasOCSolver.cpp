@@ -16,6 +16,7 @@
  * -------------------------------------------------------------------------- */
 
 #include "CasOCHermiteSimpson.h"
+#include "CasOCLegendreGaussRadau.h"
 #include "CasOCProblem.h"
 #include "CasOCTranscription.h"
 #include "CasOCTrapezoidal.h"
@@ -26,12 +27,22 @@ using OpenSim::Exception;
 
 namespace CasOC {
 
+std::recursive_mutex& getCasADiMutex() {
+    static std::recursive_mutex mutex;
+    return mutex;
+}
+
 std::unique_ptr<Transcription> Solver::createTranscription() const {
     std::unique_ptr<Transcription> transcription;
     if (m_transcriptionScheme == "trapezoidal") {
         transcription = OpenSim::make_unique<Trapezoidal>(*this, m_problem);
     } else if (m_transcriptionScheme == "hermite-simpson") {
         transcription = OpenSim::make_unique<HermiteSimpson>(*this, m_problem);
+    } else if (m_transcriptionScheme.find("legendre-gauss-radau-") == 0) {
+        const int degree = std::stoi(m_transcriptionScheme.substr(
+                std::string("legendre-gauss-radau-").size()));
+        transcription = OpenSim::make_unique<LegendreGaussRadau>(
+                *this, m_problem, degree);
     } else {
         OPENSIM_THROW(Exception, "Unknown transcription scheme '{}'.",
                 m_transcriptionScheme);
@@ -40,11 +51,13 @@ std::unique_ptr<Transcription> Solver::createTranscription() const {
 }
 
 Iterate Solver::createInitialGuessFromBounds() const {
+    std::lock_guard<std::recursive_mutex> lock(getCasADiMutex());
     auto transcription = createTranscription();
     return transcription->createInitialGuessFromBounds();
 }
 
 Iterate Solver::createRandomIterateWithinBounds() const {
+    std::lock_guard<std::recursive_mutex> lock(getCasADiMutex());
     auto transcription = createTranscription();
     return transcription->createRandomIterateWithinBounds();
 }
@@ -69,6 +82,7 @@ void Solver::setParallelism(std::string parallelism, int numThreads) {
 }
 
 Solution Solver::solve(const Iterate& guess) const {
+    std::lock_guard<std::recursive_mutex> lock(getCasADiMutex());
     auto transcription = createTranscription();
     auto pointsForSparsityDetection =
             std::make_shared<std::vector<VariablesDM>>();
@@ -94,6 +108,17 @@ Solution Solver::solve(const Iterate& guess) const {
     m_problem.initialize(m_finite_difference_scheme,
             std::const_pointer_cast<const std::vector<VariablesDM>>(
                     pointsForSparsityDetection));
+    if (m_problem.hasMultibodySystemFunction()) {
+        // Compare the function to the model at the initial guess and at a
+        // random point, since the guess may be a special point (e.g., zero
+        // controls).
+        m_problem.checkMultibodySystemFunction(guess.variables);
+        SimTK::Random::Uniform randGen(-1, 1);
+        randGen.setSeed(0);
+        m_problem.checkMultibodySystemFunction(
+                transcription->createRandomIterateWithinBounds(&randGen)
+                        .variables);
+    }
     return transcription->solve(guess);
 }
 
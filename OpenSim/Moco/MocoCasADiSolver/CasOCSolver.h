@@ -20,6 +20,8 @@
 
 #include "CasOCProblem.h"
 
+#include <mutex>
+
 namespace OpenSim {
 class MocoCasADiSolver;
 } // namespace OpenSim
@@ -28,6 +30,18 @@ namespace CasOC {
 
 class Transcription;
 
+/// The version of CasADi that we use does not have thread-safe symbolics:
+/// reference counts of MX, DM, and Sparsity objects are not atomic, and some
+/// Sparsity patterns are cached globally. Lock this mutex while creating,
+/// copying, or destroying CasADi objects, so that several problems can be
+/// set up in different threads of one process. Solving the NLP (evaluating the
+/// nlpsol() function) also creates such objects: CasADi wraps the arguments
+/// of each callback (e.g., the multibody system functions) in DM objects, and
+/// our callbacks create DM objects for their results. Therefore, the mutex is
+/// held for the entire solve, and the NLP solves of different problems run
+/// one at a time.
+std::recursive_mutex& getCasADiMutex();
+
 /// Once you have built your CasOC::Problem, create a CasOC::Solver to configure
 /// how you want to solve the problem, then invoke solve() to solve your
 /// problem. This class assumes that the problem is solved using direct
@@ -109,6 +123,21 @@ public:
         return m_interpolateControlMidpoints;
     }
 
+    /// The order of the variables in the nonlinear program: "by-type" (all
+    /// states, then all controls, etc.; default) or "by-grid-point" (all
+    /// variables at the first grid point, then all variables at the second
+    /// grid point, etc., followed by the time and parameter variables).
+    /// Since the constraints are already grouped by grid point, ordering the
+    /// variables by grid point gives the KKT matrix a block-banded structure
+    /// with a dense border for the time and parameter variables. Iterates
+    /// and their NLP multipliers are always in the "by-type" order.
+    void setVariableOrdering(std::string ordering) {
+        m_variableOrdering = std::move(ordering);
+    }
+    const std::string& getVariableOrdering() const {
+        return m_variableOrdering;
+    }
+
     void setOptimSolver(std::string optimSolver) {
         m_optimSolver = std::move(optimSolver);
     }
@@ -196,6 +225,7 @@ private:
     casadi::Dict m_pluginOptions;
     casadi::Dict m_solverOptions;
     std::string m_optimSolver;
+    std::string m_variableOrdering = "by-type";
 };
 
 } // namespace CasOC
@@ -119,6 +119,23 @@ void Transcription::createVariablesAndSetBounds(const casadi::DM& grid,
     }
     m_grid = grid;
 
+    if (m_problem.getTimeInitialBounds().lower ==
+                    m_problem.getTimeInitialBounds().upper &&
+            m_problem.getTimeFinalBounds().lower ==
+                    m_problem.getTimeFinalBounds().upper) {
+        // The times of the grid points are known in advance, so the problem
+        // can precompute time-dependent quantities (e.g., reference data for
+        // tracking goals). This is the same formula as createTimes().
+        const double initialTime = m_problem.getTimeInitialBounds().lower;
+        const double finalTime = m_problem.getTimeFinalBounds().lower;
+        std::vector<double> times(m_numGridPoints);
+        for (int itime = 0; itime < m_numGridPoints; ++itime) {
+            times[itime] = (finalTime - initialTime) * m_grid(itime).scalar() +
+                           initialTime;
+        }
+        m_problem.initializeOnGrid(times);
+    }
+
     // Create variables.
     // -----------------
     m_vars[initial_time] = MX::sym("initial_time");
@@ -248,6 +265,61 @@ void Transcription::createVariablesAndSetBounds(const casadi::DM& grid,
             ++ip;
         }
     }
+
+    // Set the order of the NLP variables.
+    // -----------------------------------
+    OPENSIM_THROW_IF(m_solver.getVariableOrdering() != "by-type" &&
+                             m_solver.getVariableOrdering() != "by-grid-point",
+            OpenSim::Exception,
+            "Expected variable ordering to be 'by-type' or 'by-grid-point', "
+            "but got '{}'.",
+            m_solver.getVariableOrdering());
+    if (m_solver.getVariableOrdering() == "by-grid-point") {
+        createGridPointVariableOrder();
+    }
+}
+
+void Transcription::createGridPointVariableOrder() {
+    // Offsets of each type of variable in the vector from
+    // flattenVariablesByType().
+    std::unordered_map<Var, casadi_int, std::hash<int>> offsets;
+    casadi_int numVariables = 0;
+    for (const auto& key : getSortedVarKeys(m_vars)) {
+        offsets[key] = numVariables;
+        numVariables += m_vars.at(key).numel();
+    }
+
+    m_variableOrder.clear();
+    m_variableOrder.reserve(numVariables);
+    // Append column icol of the variable of the given type. The variables are
+    // stored column-major.
+    auto appendColumn = [&](Var var, int icol) {
+        const auto& value = m_vars.at(var);
+        const casadi_int begin = offsets.at(var) + icol * value.rows();
+        for (casadi_int irow = 0; irow < value.rows(); ++irow) {
+            m_variableOrder.push_back(begin + irow);
+        }
+    };
+    int islack = 0;
+    for (int igrid = 0; igrid < m_numGridPoints; ++igrid) {
+        appendColumn(states, igrid);
+        appendColumn(controls, igrid);
+        appendColumn(multipliers, igrid);
+        appendColumn(derivatives, igrid);
+        if (!m_meshIndicesMap(igrid).__nonzero__()) {
+            appendColumn(slacks, islack);
+            ++islack;
+        }
+    }
+    appendColumn(initial_time, 0);
+    appendColumn(final_time, 0);
+    appendColumn(parameters, 0);
+
+    OPENSIM_THROW_IF((casadi_int)m_variableOrder.size() != numVariables,
+            OpenSim::Exception,
+            "Internal error: the variable order should contain {} variables, "
+            "but it contains {}.",
+            numVariables, m_variableOrder.size());
 }
 
 void Transcription::transcribe() {
@@ -585,6 +657,7 @@ void Transcription::setObjectiveAndEndpointConstraints() {
 }
 
 Solution Transcription::solve(const Iterate& guessOrig) {
+    std::lock_guard<std::recursive_mutex> lock(getCasADiMutex());
 
     // Define the NLP.
     // ---------------
@@ -627,15 +700,7 @@ Solution Transcription::solve(const Iterate& guessOrig) {
                 m_numMeshInteriorPoints, slacks.size2());
     }
 
-    // Create the CasADi NLP function.
-    // -------------------------------
-    // Option handling is copied from casadi::OptiNode::solver().
-    casadi::Dict options = m_solver.getPluginOptions();
-    if (!options.empty()) {
-        options[m_solver.getOptimSolver()] = m_solver.getSolverOptions();
-    }
-
-    auto x = flattenVariables(m_vars);
+    auto x = flattenVariablesByType(m_vars);
     casadi_int numVariables = x.numel();
 
     // The m_constraints symbolic vector holds all of the expressions for
@@ -643,21 +708,73 @@ Solution Transcription::solve(const Iterate& guessOrig) {
     auto g = flattenConstraints(m_constraints);
     casadi_int numConstraints = g.numel();
 
+    // Use the multipliers from the guess to warm-start the dual variables
+    // only if the guess has the same NLP structure (e.g., the guess is the
+    // solution to a problem with the same grid).
+    const bool warmStartMultipliers =
+            guessOrig.nlp_variable_multipliers.numel() == numVariables &&
+            guessOrig.nlp_constraint_multipliers.numel() == numConstraints &&
+            guessOrig.times.numel() == guessTimes.numel() &&
+            casadi::DM::norm_inf(guessOrig.times - guessTimes).scalar() <
+                    1e-10;
+
+    // Create the CasADi NLP function.
+    // -------------------------------
+    // Option handling is copied from casadi::OptiNode::solver().
+    casadi::Dict options = m_solver.getPluginOptions();
+    if (!options.empty()) {
+        casadi::Dict solverOptions = m_solver.getSolverOptions();
+        // IPOPT ignores the initial multipliers unless this option is set.
+        if (warmStartMultipliers && m_solver.getOptimSolver() == "ipopt" &&
+                solverOptions.count("warm_start_init_point") == 0) {
+            solverOptions["warm_start_init_point"] = "yes";
+        }
+        options[m_solver.getOptimSolver()] = solverOptions;
+    }
+
     NlpsolCallback callback(*this, m_problem, numVariables, numConstraints,
             m_solver.getCallbackInterval());
     options["iteration_callback"] = callback;
 
     // The inputs to nlpsol() are symbolic (casadi::MX).
     casadi::MXDict nlp;
-    nlp.emplace(std::make_pair("x", x));
     // The objective symbolic variable holds an expression graph including
     // all the calculations performed on the variables x.
     casadi::MX objective = MX::sum1(m_objectiveTerms);
     if (m_objectiveTerms.numel() == 0) {
         objective = 0;
     }
-    nlp.emplace(std::make_pair("f", objective));
-    nlp.emplace(std::make_pair("g", g));
+    if (m_variableOrder.empty()) {
+        nlp.emplace(std::make_pair("x", x));
+        nlp.emplace(std::make_pair("f", objective));
+        nlp.emplace(std::make_pair("g", g));
+    } else {
+        // Create NLP variables in the requested order, and substitute them
+        // for the variables in the expressions for the objective and
+        // constraints.
+        std::vector<casadi_int> inverseOrder(numVariables);
+        for (casadi_int i = 0; i < numVariables; ++i) {
+            inverseOrder[m_variableOrder[i]] = i;
+        }
+        MX xOrdered = MX::sym("x", numVariables);
+        MX xByType = xOrdered(inverseOrder);
+        std::vector<MX> vars;
+        std::vector<MX> varsDef;
+        casadi_int offset = 0;
+        for (const auto& key : getSortedVarKeys(m_vars)) {
+            const auto& value = m_vars.at(key);
+            vars.push_back(value);
+            varsDef.push_back(MX::reshape(
+                    xByType(Slice(offset, offset + value.numel())),
+                    value.rows(), value.columns()));
+            offset += value.numel();
+        }
+        const auto nlpExprs = MX::substitute(
+                std::vector<MX>{objective, g}, vars, varsDef);
+        nlp.emplace(std::make_pair("x", xOrdered));
+        nlp.emplace(std::make_pair("f", nlpExprs[0]));
+        nlp.emplace(std::make_pair("g", nlpExprs[1]));
+    }
     if (!m_solver.getWriteSparsity().empty()) {
         const auto prefix = m_solver.getWriteSparsity();
         auto gradient = casadi::MX::gradient(nlp["f"], nlp["x"]);
@@ -665,7 +782,7 @@ Solution Transcription::solve(const Iterate& guessOrig) {
                 prefix + "_objective_gradient_sparsity.mtx");
         auto hessian = casadi::MX::hessian(nlp["f"], nlp["x"]);
         hessian.sparsity().to_file(prefix + "_objective_Hessian_sparsity.mtx");
-        auto lagrangian = objective +
+        auto lagrangian = nlp["f"] +
                           casadi::MX::dot(casadi::MX::ones(nlp["g"].sparsity()),
                                   nlp["g"]);
         auto hessian_lagr = casadi::MX::hessian(lagrangian, nlp["x"]);
@@ -681,12 +798,17 @@ Solution Transcription::solve(const Iterate& guessOrig) {
     // Run the optimization (evaluate the CasADi NLP function).
     // --------------------------------------------------------
     // The inputs and outputs of nlpFunc are numeric (casadi::DM).
-    const casadi::DMDict nlpResult =
-            nlpFunc(casadi::DMDict{{"x0", flattenVariables(guess.variables)},
-                    {"lbx", flattenVariables(m_lowerBounds)},
-                    {"ubx", flattenVariables(m_upperBounds)},
-                    {"lbg", flattenConstraints(m_constraintsLowerBounds)},
-                    {"ubg", flattenConstraints(m_constraintsUpperBounds)}});
+    casadi::DMDict nlpInput{{"x0", flattenVariables(guess.variables)},
+            {"lbx", flattenVariables(m_lowerBounds)},
+            {"ubx", flattenVariables(m_upperBounds)},
+            {"lbg", flattenConstraints(m_constraintsLowerBounds)},
+            {"ubg", flattenConstraints(m_constraintsUpperBounds)}};
+    if (warmStartMultipliers) {
+        nlpInput["lam_x0"] =
+                orderVariables(guessOrig.nlp_variable_multipliers);
+        nlpInput["lam_g0"] = guessOrig.nlp_constraint_multipliers;
+    }
+    const casadi::DMDict nlpResult = nlpFunc(nlpInput);
 
     // Create a CasOC::Solution.
     // -------------------------
@@ -694,8 +816,11 @@ Solution Transcription::solve(const Iterate& guessOrig) {
     const auto finalVariables = nlpResult.at("x");
     solution.variables = expandVariables(finalVariables);
     solution.objective = nlpResult.at("f").scalar();
+    solution.nlp_variable_multipliers =
+            orderVariablesByType(nlpResult.at("lam_x"));
+    solution.nlp_constraint_multipliers = nlpResult.at("lam_g");
 
-    casadi::DMVector finalVarsDMV{finalVariables};
+    casadi::DMVector finalVarsDMV{flattenVariablesByType(solution.variables)};
     casadi::Function objectiveFunc("objective", {x}, {m_objectiveTerms});
     casadi::DMVector objectiveOut;
     objectiveFunc.call(finalVarsDMV, objectiveOut);
@@ -136,6 +136,11 @@ private:
     VariablesDM m_lowerBounds;
     VariablesDM m_upperBounds;
 
+    // For each NLP variable, the index of the variable in the vector from
+    // flattenVariablesByType(). This is empty if the NLP variables are
+    // ordered by type.
+    std::vector<casadi_int> m_variableOrder;
+
     casadi::DM m_meshIndicesMap;
     casadi::Matrix<casadi_int> m_gridIndices;
     casadi::Matrix<casadi_int> m_meshIndices;
@@ -189,18 +194,38 @@ private:
         std::sort(keys.begin(), keys.end());
         return keys;
     }
-    /// Convert the map of variables into a column vector, for passing onto
-    /// nlpsol(), etc.
+    /// Convert the map of variables into a column vector in which the
+    /// variables are grouped by type (see getSortedVarKeys()).
     template <typename T>
-    static T flattenVariables(const CasOC::Variables<T>& vars) {
+    static T flattenVariablesByType(const CasOC::Variables<T>& vars) {
         std::vector<T> stdvec;
         for (const auto& key : getSortedVarKeys(vars)) {
             stdvec.push_back(vars.at(key));
         }
         return T::veccat(stdvec);
     }
+    /// Convert the map of variables into a column vector, for passing onto
+    /// nlpsol(), etc. The order of the variables is set by
+    /// Solver::setVariableOrdering().
+    casadi::DM flattenVariables(const CasOC::VariablesDM& vars) const {
+        return orderVariables(flattenVariablesByType(vars));
+    }
+    /// Permute a vector with one element per NLP variable (e.g., the
+    /// multipliers of the variable bounds) from the "by-type" order to the
+    /// order set by Solver::setVariableOrdering().
+    casadi::DM orderVariables(const casadi::DM& xByType) const {
+        if (m_variableOrder.empty()) return xByType;
+        return xByType(m_variableOrder);
+    }
+    /// The inverse of orderVariables().
+    casadi::DM orderVariablesByType(const casadi::DM& x) const {
+        casadi::DM xByType = x;
+        if (!m_variableOrder.empty()) xByType(m_variableOrder) = x;
+        return xByType;
+    }
     /// Convert the 'x' column vector into separate variables.
     CasOC::VariablesDM expandVariables(const casadi::DM& x) const {
+        const casadi::DM xByType = orderVariablesByType(x);
         CasOC::VariablesDM out;
         using casadi::Slice;
         casadi_int offset = 0;
@@ -208,12 +233,17 @@ private:
             const auto& value = m_vars.at(key);
             // Convert a portion of the column vector into a matrix.
             out[key] = casadi::DM::reshape(
-                    x(Slice(offset, offset + value.numel())), value.rows(),
-                    value.columns());
+                    xByType(Slice(offset, offset + value.numel())),
+                    value.rows(), value.columns());
             offset += value.numel();
         }
         return out;
     }
+    /// Set m_variableOrder so that the NLP variables are grouped by grid
+    /// point. Slack variables follow the variables at the mesh interior
+    /// point to which they apply, and the time and parameter variables are
+    /// last.
+    void createGridPointVariableOrder();
 
     /// Flatten the constraints into a row vector, keeping constraints
     /// grouped together by time. Organizing the sparsity of the Jacobian
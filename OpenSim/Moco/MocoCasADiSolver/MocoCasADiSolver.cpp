@@ -44,8 +44,11 @@ void MocoCasADiSolver::constructProperties() {
     constructProperty_optim_sparsity_detection("none");
     constructProperty_optim_write_sparsity("");
     constructProperty_optim_finite_difference_scheme("central");
+    constructProperty_optim_variable_ordering("by-type");
     constructProperty_parallel();
+    constructProperty_multibody_system_function_file("");
     constructProperty_output_interval(0);
+    constructProperty_output_file_format("sto");
 
     constructProperty_minimize_implicit_multibody_accelerations(false);
     constructProperty_implicit_multibody_accelerations_weight(1.0);
@@ -115,11 +118,18 @@ void MocoCasADiSolver::checkGuess(const MocoTrajectory& guess) const {
             getProblemRep(), get_multibody_dynamics_mode() == "implicit", true);
 }
 
+void MocoCasADiSolver::setWarmStart(const MocoSolution& solution) {
+    setGuess(solution);
+    m_warmStartVariableMultipliers = solution.getNLPVariableMultipliers();
+    m_warmStartConstraintMultipliers = solution.getNLPConstraintMultipliers();
+}
 void MocoCasADiSolver::clearGuess() {
     m_guessFromAPI = MocoTrajectory();
     m_guessFromFile = MocoTrajectory();
     set_guess_file("");
     m_guessToUse.reset();
+    m_warmStartVariableMultipliers.clear();
+    m_warmStartConstraintMultipliers.clear();
 }
 const MocoTrajectory& MocoCasADiSolver::getGuess() const {
     if (!m_guessToUse) {
@@ -188,8 +198,14 @@ std::unique_ptr<CasOC::Solver> MocoCasADiSolver::createCasOCSolver(
     // -------------------
     Dict solverOptions;
     checkPropertyValueIsInSet(getProperty_optim_solver(), {"ipopt", "snopt"});
-    checkPropertyValueIsInSet(getProperty_transcription_scheme(),
-            {"trapezoidal", "hermite-simpson"});
+    std::set<std::string> transcriptionSchemes{
+            "trapezoidal", "hermite-simpson"};
+    for (int degree = 1; degree <= 9; ++degree) {
+        transcriptionSchemes.insert(
+                fmt::format("legendre-gauss-radau-{}", degree));
+    }
+    checkPropertyValueIsInSet(
+            getProperty_transcription_scheme(), transcriptionSchemes);
     OPENSIM_THROW_IF(casProblem.getNumKinematicConstraintEquations() != 0 &&
                              get_transcription_scheme() == "trapezoidal",
             OpenSim::Exception,
@@ -278,7 +294,13 @@ std::unique_ptr<CasOC::Solver> MocoCasADiSolver::createCasOCSolver(
             {"central", "forward", "backward"});
     casSolver->setFiniteDifferenceScheme(get_optim_finite_difference_scheme());
 
+    checkPropertyValueIsInSet(getProperty_optim_variable_ordering(),
+            {"by-type", "by-grid-point"});
+    casSolver->setVariableOrdering(get_optim_variable_ordering());
+
     casSolver->setCallbackInterval(get_output_interval());
+    checkPropertyValueIsInSet(
+            getProperty_output_file_format(), {"sto", "binary"});
 
     Dict pluginOptions;
     pluginOptions["verbose_init"] = true;
@@ -345,6 +367,10 @@ MocoSolution MocoCasADiSolver::solveImpl() const {
         log_info(std::string(72, '-'));
         getProblemRep().printDescription();
     }
+    // Hold the CasADi mutex while using CasADi objects (including while
+    // solving the NLP), so that MocoStudyBatch can solve several problems in
+    // different threads.
+    std::lock_guard<std::recursive_mutex> lock(CasOC::getCasADiMutex());
     auto casProblem = createCasOCProblem();
     auto casSolver = createCasOCSolver(*casProblem);
     if (get_verbosity()) {
@@ -357,18 +383,24 @@ MocoSolution MocoCasADiSolver::solveImpl() const {
         casGuess = casSolver->createInitialGuessFromBounds();
     } else {
         casGuess = convertToCasOCIterate(guess);
+        casGuess.nlp_variable_multipliers =
+                convertToCasADiDM(m_warmStartVariableMultipliers);
+        casGuess.nlp_constraint_multipliers =
+                convertToCasADiDM(m_warmStartConstraintMultipliers);
     }
 
     // Temporarily disable printing of negative muscle force warnings so the
     // log isn't flooded while computing finite differences.
     Logger::Level origLoggerLevel = Logger::getLevel();
     Logger::setLevel(Logger::Level::Warn);
-    CasOC::Solution casSolution;
-    try {
-        casSolution = casSolver->solve(casGuess);
-    } catch (...) {
-        OpenSim::Logger::setLevel(origLoggerLevel);
-    }
+    CasOC::Solution casSolution = [&]() {
+        try {
+            return casSolver->solve(casGuess);
+        } catch (...) {
+            OpenSim::Logger::setLevel(origLoggerLevel);
+            throw;
+        }
+    }();
     OpenSim::Logger::setLevel(origLoggerLevel);
 
     MocoSolution mocoSolution =
@@ -424,6 +456,9 @@ MocoSolution MocoCasADiSolver::solveImpl() const {
             casSolution.objective, casSolution.stats.at("return_status"),
             casSolution.stats.at("iter_count"), SimTK::nsToSec(elapsed),
             casSolution.objective_breakdown);
+    setSolutionNLPMultipliers(mocoSolution,
+            convertToSimTKVector(casSolution.nlp_variable_multipliers),
+            convertToSimTKVector(casSolution.nlp_constraint_multipliers));
 
     if (get_verbosity()) {
         log_info(std::string(72, '-'));
@@ -71,6 +71,20 @@ The "central" finite difference is more accurate but can be 2 times
 slower than "forward" (tested on exampleSlidingMass). Sometimes, problems
 may struggle to converge with "forward".
 
+Variable ordering
+=================
+The constraints of the nonlinear program are grouped by grid point, but by
+default, the variables are grouped by type (all states, then all controls,
+etc.). With optim_variable_ordering set to "by-grid-point", the variables at
+each grid point are grouped together, and the time and parameter variables
+are placed last. The Jacobian and KKT matrix then have a block-banded
+structure with a dense border. Whether this speeds up the linear solver
+depends on the solver and its ordering of the KKT matrix, so compare both
+settings on your problem. The solution does not depend on this setting, and
+the NLP multipliers in a MocoSolution are stored in the "by-type" order, so
+a solution obtained with one setting can warm-start a solve with the
+other.
+
 Parallelization
 ===============
 By default, CasADi evaluate the integral cost integrand and the
@@ -89,7 +103,8 @@ use all 4 cores.
 Note that there is overhead in the parallelization; if you plan to solve
 many problems, it is better to turn off parallelization here and parallelize
 the solving of your multiple problems using your system (e.g., invoke Moco in
-multiple Terminals or Command Prompts).
+multiple Terminals or Command Prompts). MocoStudyBatch solves many problems in
+one process, but it cannot run their NLP solves concurrently.
 
 Note that the `parallel` property overrides the environment variable,
 allowing more granular control over parallelization. However, the
@@ -98,6 +113,48 @@ not affect the solution. We encourage you to use the environment variable
 instead, as this allows different users to solve the same problem with the
 parallelization they prefer.
 
+External multibody system plug-in
+=================================
+By default, the model is a black box to CasADi, and CasADi computes the
+derivatives of the multibody dynamics with finite differences, which
+requires evaluating the model many times. The multibody_system_function_file
+property lets you plug in an external CasADi function for the multibody
+system instead. Moco does not create this function from the model; you must
+build a CasADi expression graph for the dynamics of your model yourself
+(e.g., by writing the equations of motion of the joints, muscles, and
+contact forces with CasADi symbols), generate C code for it, compile the
+code into a shared library, and provide the library with this property.
+Alternatively, provide a file saved with casadi::Function::save() (with the
+extension ".casadi"); CasADi evaluates such a function without compiling
+it.
+CasADi then uses the exact (and sparse) derivatives of the compiled function,
+which can make solving much faster. The model is still used for goals, path
+constraints, and post-processing, so the function must match the model.
+
+The library must contain a function named "multibody_system" (a ".casadi"
+file may contain a function with any name) with 6 inputs
+(time, states, controls, multipliers, derivatives, and parameters; each a
+column vector) and 4 outputs:
+- explicit dynamics mode: the speed derivatives, the derivatives of the
+  auxiliary (e.g., muscle) states, and the auxiliary residuals;
+- implicit dynamics mode: the multibody residuals, the derivatives of the
+  auxiliary states, and the auxiliary residuals;
+- an empty vector for the kinematic constraint errors; problems with
+  kinematic constraints are not supported.
+
+The states are in the order Moco uses for the system, which is not the
+order of Model::getStateVariableNames(): all coordinate values, then all
+speeds (both in the order of the SimTK::State's Q and U), then the auxiliary
+states (in the order of the State's Z); see
+createStateVariableNamesInSystemOrder(). The controls are in the order given
+by createControlNamesFromModel(). Before solving, the function is evaluated
+at the initial time of the initial guess and of a random point within the
+bounds, and the solver throws an exception if its outputs differ from those
+of the model (relative to the size of the model's outputs, by more than
+1e-6). This catches a function generated for a different model or with a
+different ordering, but only at these two points; comparing against a
+solution obtained without the function is still recommended.
+
 Parameter variables
 ===================
 By default, MocoCasADiSolver is much slower than MocoTroperSolver at
@@ -137,6 +194,10 @@ public:
     OpenSim_DECLARE_PROPERTY(optim_finite_difference_scheme, std::string,
             "The finite difference scheme CasADi will use to calculate problem "
             "derivatives (default: 'central').");
+    OpenSim_DECLARE_PROPERTY(optim_variable_ordering, std::string,
+            "The order of the variables in the nonlinear program: 'by-type' "
+            "(default) or 'by-grid-point'. Ordering by grid point gives the "
+            "KKT matrix a block-banded structure.");
 
     OpenSim_DECLARE_OPTIONAL_PROPERTY(parallel, int,
             "Evaluate integral costs and the differential-algebraic "
@@ -144,11 +205,24 @@ public:
             "0: not parallel; 1: use all cores (default); greater than 1: use"
             "this number of parallel jobs. This overrides the OPENSIM_MOCO_PARALLEL "
             "environment variable.");
+    OpenSim_DECLARE_PROPERTY(multibody_system_function_file, std::string,
+            "Path to an external plug-in for the multibody system: a shared "
+            "library, compiled from code generated by CasADi, that contains "
+            "a function 'multibody_system' (or a function saved by CasADi, "
+            "with extension .casadi). It is used instead of the model's "
+            "dynamics and must match them; see the documentation of this "
+            "class. Empty (default) to use the model.");
     OpenSim_DECLARE_PROPERTY(output_interval, int,
             "Write intermediate trajectories to file. 0, the default, "
             "indicates no intermediate trajectories are saved, 1 indicates "
             "each iteration is saved, 5 indicates every fifth iteration is "
             "saved, etc.");
+    OpenSim_DECLARE_PROPERTY(output_file_format, std::string,
+            "The format of the intermediate trajectories written when "
+            "'output_interval' is positive: 'sto' (default) writes one STO "
+            "file per trajectory; 'binary' appends all trajectories to a "
+            "single binary trajectory file (see MocoTrajectoryBinaryReader), "
+            "which is much faster for large problems.");
 
     OpenSim_DECLARE_PROPERTY(minimize_implicit_multibody_accelerations, bool,
             "Minimize the integral of the squared acceleration continuous "
@@ -205,7 +279,18 @@ public:
     /// Set to an empty string to clear the guess file.
     void setGuessFile(const std::string& file);
 
+    /// Use a solution to a previous problem as the guess (see setGuess()),
+    /// including the multipliers of the nonlinear program (NLP) from the
+    /// solution (see MocoSolution::getNLPVariableMultipliers()). The
+    /// multipliers are used only if the NLP for this problem has the same
+    /// number of variables and constraints and the same time grid as the NLP
+    /// that produced the solution; otherwise, only the solution's trajectory
+    /// is used. When the multipliers are used with IPOPT, we set IPOPT's
+    /// `warm_start_init_point` option to "yes".
+    void setWarmStart(const MocoSolution& solution);
+
     /// Clear the stored guess and the `guess_file` if any.
+    /// This also clears any multipliers from setWarmStart().
     void clearGuess();
 
     /// Access the guess, loading it from the guess_file if necessary.
@@ -235,6 +320,9 @@ private:
     MocoTrajectory m_guessFromAPI;
     mutable SimTK::ResetOnCopy<MocoTrajectory> m_guessFromFile;
     mutable SimTK::ReferencePtr<const MocoTrajectory> m_guessToUse;
+    // Multipliers of the NLP from setWarmStart().
+    SimTK::Vector m_warmStartVariableMultipliers;
+    SimTK::Vector m_warmStartConstraintMultipliers;
 };
 
 } // namespace OpenSim
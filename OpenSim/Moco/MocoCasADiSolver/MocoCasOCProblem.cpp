@@ -36,7 +36,9 @@ MocoCasOCProblem::MocoCasOCProblem(const MocoCasADiSolver& mocoCasADiSolver,
         : m_jar(std::move(jar)),
           m_paramsRequireInitSystem(
                   mocoCasADiSolver.get_parameters_require_initsystem()),
-          m_formattedTimeString(getFormattedDateTime(true)) {
+          m_formattedTimeString(getFormattedDateTime(true)),
+          m_writeBinaryIterates(
+                  mocoCasADiSolver.get_output_file_format() == "binary") {
 
     setDynamicsMode(dynamicsMode);
     const auto& model = problemRep.getModelBase();
@@ -252,4 +254,20 @@ MocoCasOCProblem::MocoCasOCProblem(const MocoCasADiSolver& mocoCasADiSolver,
     m_fileDeletionThrower = OpenSim::make_unique<FileDeletionThrower>(
             fmt::format("delete_this_to_stop_optimization_{}_{}.txt",
                     problemRep.getName(), m_formattedTimeString));
+
+    const auto& functionFile =
+            mocoCasADiSolver.get_multibody_system_function_file();
+    if (!functionFile.empty()) {
+        OPENSIM_THROW_IF(!IO::FileExists(functionFile), Exception,
+                "Could not find multibody system function file '{}'.",
+                functionFile);
+        // A file saved with casadi::Function::save() holds the function
+        // itself, so its name does not matter.
+        if (IO::EndsWith(functionFile, ".casadi")) {
+            setMultibodySystemFunction(casadi::Function::load(functionFile));
+        } else {
+            setMultibodySystemFunction(
+                    casadi::external("multibody_system", functionFile));
+        }
+    }
 }
@@ -26,6 +26,7 @@
 #include <OpenSim/Moco/Components/DiscreteForces.h>
 #include <OpenSim/Moco/MocoBounds.h>
 #include <OpenSim/Moco/MocoProblemRep.h>
+#include <OpenSim/Moco/MocoTrajectoryBinary.h>
 
 namespace OpenSim {
 
@@ -491,11 +492,38 @@ private:
         m_jar->leave(std::move(mocoProblemRep));
         return names;
     }
+    void initializeOnGrid(const std::vector<double>& times) const override {
+        const SimTK::Vector simtkTimes((int)times.size(), times.data());
+        // Each MocoProblemRep in the jar has its own copy of the goals and
+        // its own model.
+        std::vector<std::unique_ptr<const MocoProblemRep>> reps;
+        for (int i = 0; i < getJarSize(); ++i) {
+            reps.push_back(m_jar->take());
+        }
+        for (auto& rep : reps) {
+            rep->initializeGoalsOnGrid(simtkTimes);
+            rep->initializePrescribedKinematicsOnGrid(simtkTimes);
+            m_jar->leave(std::move(rep));
+        }
+    }
     void intermediateCallbackImpl() const override {
         m_fileDeletionThrower->throwIfDeleted();
     }
     void intermediateCallbackWithIterateImpl(
             const CasOC::Iterate& iterate) const override {
+        if (m_writeBinaryIterates) {
+            // Append to a single file so that previous iterates are not
+            // rewritten.
+            if (!m_iterateWriter) {
+                m_iterateWriter =
+                        OpenSim::make_unique<MocoTrajectoryBinaryWriter>(
+                                fmt::format("MocoCasADiSolver_{}_"
+                                            "trajectories.mocobin",
+                                        m_formattedTimeString));
+            }
+            m_iterateWriter->append(convertToMocoTrajectory(iterate));
+            return;
+        }
         std::string filename =
                 fmt::format("MocoCasADiSolver_{}_trajectory{:06i}.sto",
                         m_formattedTimeString, iterate.iteration);
@@ -519,10 +547,42 @@ private:
     /// slots in Simbody's Y vector.
     /// It's fine for the size of `states` to be less than the size of Y; only
     /// the first states.size1() values are copied.
+    /// If `kinematicsRealized` is true, `simtkState` already has the correct
+    /// time, coordinates and speeds (see
+    /// MocoProblemRep::findPrescribedKinematicsStateOnGrid()), and only the
+    /// auxiliary states are copied. Position-level quantities are kept, but
+    /// quantities at Stage::Velocity and above are invalidated, since they
+    /// may depend on the auxiliary states.
+    /// If `simtkState` already has the given time and coordinates (e.g., when
+    /// CasADi perturbs only speeds, auxiliary states or controls to compute
+    /// finite differences), its position-level quantities are kept; see
+    /// isPositionStageReusable().
     void convertStatesToSimTKState(SimTK::Stage stageDep, const double& time,
             const casadi::DM& states, const Model& model,
-            SimTK::State& simtkState, bool copyAuxStates) const {
-        if (stageDep >= SimTK::Stage::Time) {
+            SimTK::State& simtkState, bool copyAuxStates,
+            bool kinematicsRealized = false) const {
+        if (stageDep >= SimTK::Stage::Time && kinematicsRealized) {
+            // As below, updZ() only invalidates Stage::Dynamics.
+            simtkState.invalidateAllCacheAtOrAbove(SimTK::Stage::Velocity);
+            if (copyAuxStates) {
+                std::copy_n(states.ptr() + getNumCoordinates() + getNumSpeeds(),
+                        getNumAuxiliaryStates(),
+                        simtkState.updZ().updContiguousScalarData());
+            }
+        } else if (stageDep >= SimTK::Stage::Time &&
+                   isPositionStageReusable(time, states, simtkState)) {
+            // Cache variables that depend on Stage::Velocity may also depend
+            // on auxiliary states (e.g., MuscleLengthInfo depends on fiber
+            // length), but updZ() only invalidates Stage::Dynamics.
+            simtkState.invalidateAllCacheAtOrAbove(SimTK::Stage::Velocity);
+            std::copy_n(states.ptr() + getNumCoordinates(), getNumSpeeds(),
+                    simtkState.updU().updContiguousScalarData());
+            if (copyAuxStates) {
+                std::copy_n(states.ptr() + getNumCoordinates() + getNumSpeeds(),
+                        getNumAuxiliaryStates(),
+                        simtkState.updZ().updContiguousScalarData());
+            }
+        } else if (stageDep >= SimTK::Stage::Time) {
             simtkState.setTime(time);
             // Assign the generalized coordinates. We know we have NU
             // generalized speeds because we do not yet support quaternions.
@@ -543,6 +603,25 @@ private:
         }
     }
 
+    /// Can we keep the position-level quantities (e.g., body transforms and
+    /// muscle path lengths, which may require costly wrapping calculations)
+    /// that are already realized in `simtkState`? This is the case if the
+    /// state has been realized to Stage::Position with the given time and
+    /// coordinate values. Parameters may affect these quantities without
+    /// changing the time or coordinates, so we do not reuse the state if
+    /// there are parameters.
+    bool isPositionStageReusable(const double& time,
+            const casadi::DM& states, const SimTK::State& simtkState) const {
+        if (getNumParameters()) return false;
+        if (simtkState.getSystemStage() < SimTK::Stage::Position) return false;
+        if (simtkState.getTime() != time) return false;
+        const auto& q = simtkState.getQ();
+        for (int isv = 0; isv < getNumCoordinates(); ++isv) {
+            if (q[m_yIndexMap.at(isv)] != *(states.ptr() + isv)) return false;
+        }
+        return true;
+    }
+
     /// Invoke convertStatesToSimTKState() and also
     /// copy values from `controls` into the discrete state variable managed
     /// by the `discreteController`. We assume that if we need the controls
@@ -553,10 +632,11 @@ private:
             const double& time,
             const casadi::DM& states, const casadi::DM& controls,
             const Model& model, SimTK::State& simtkState,
-            const DiscreteController& discreteController) const {
+            const DiscreteController& discreteController,
+            bool kinematicsRealized = false) const {
         if (stageDep >= SimTK::Stage::Model) {
-            convertStatesToSimTKState(
-                    stageDep, time, states, model, simtkState, true);
+            convertStatesToSimTKState(stageDep, time, states, model,
+                    simtkState, true, kinematicsRealized);
             SimTK::Vector& simtkControls =
                     discreteController.updDiscreteControls(simtkState);
             for (int ic = 0; ic < getNumControls(); ++ic) {
@@ -586,6 +666,22 @@ private:
         auto& simtkStateDisabledConstraints =
                 mocoProblemRep->updStateDisabledConstraints(stateDisConIndex);
 
+        // If the kinematics are prescribed, start from a copy of a state
+        // whose positions (including path lengths) were realized before
+        // solving, if one exists for this time. Velocity-level quantities,
+        // such as lengthening speeds, are recomputed (see
+        // convertStatesToSimTKState()). Copying the state is cheaper than
+        // realizing the positions, but only if we need the kinematics.
+        const SimTK::State* kinematicsState = nullptr;
+        if (stageDep >= SimTK::Stage::Position && isPrescribedKinematics()) {
+            kinematicsState =
+                    mocoProblemRep->findPrescribedKinematicsStateOnGrid(time);
+        }
+        const bool kinematicsRealized = kinematicsState != nullptr;
+        if (kinematicsRealized) {
+            simtkStateDisabledConstraints = *kinematicsState;
+        }
+
         // Update the model and state.
         if (stageDep >= SimTK::Stage::Instance) {
             applyParametersToModelProperties(parameters, *mocoProblemRep);
@@ -622,7 +718,8 @@ private:
 
         convertStatesControlsToSimTKState(stageDep, time, states, controls,
                 modelDisabledConstraints, simtkStateDisabledConstraints,
-                mocoProblemRep->getDiscreteControllerDisabledConstraints());
+                mocoProblemRep->getDiscreteControllerDisabledConstraints(),
+                kinematicsRealized);
 
         // If enabled constraints exist in the model, compute constraint forces
         // based on Lagrange multipliers. This also updates the associated
@@ -752,6 +849,8 @@ private:
     std::unordered_map<int, int> m_yIndexMap;
     std::vector<int> m_modelControlIndices;
     std::unique_ptr<FileDeletionThrower> m_fileDeletionThrower;
+    bool m_writeBinaryIterates = false;
+    mutable std::unique_ptr<MocoTrajectoryBinaryWriter> m_iterateWriter;
     // Local memory to hold constraint forces.
     static thread_local SimTK::Vector_<SimTK::SpatialVec>
             m_constraintBodyForces;
@@ -48,6 +48,17 @@ endpoint values (default and recommended setting). If solving problems
 including model kinematic constraints, the 'hermite-simpson' option is
 required (see Kinematic constraints section below).
 
+MocoCasADiSolver also supports multiple-interval Legendre-Gauss-Radau
+pseudospectral transcription with the option 'legendre-gauss-radau-<N>',
+where N (between 1 and 9) is the degree of the polynomials that approximate
+the states within each mesh interval. Each mesh interval contains N
+collocation points (including the end of the interval), so the grid has
+N * num_mesh_intervals + 1 points. For smooth problems, this transcription
+often reaches the same accuracy as Hermite-Simpson with far fewer mesh
+intervals, and thus a smaller nonlinear program. Path constraints are
+enforced only at the mesh points, and enforcing kinematic constraint
+derivatives is not supported.
+
 Path constraints on controls with Hermite-Simpson transcription
 ---------------------------------------------------------------
 For Hermite-Simpson transcription, the direct collocation solvers enforce
@@ -97,8 +108,11 @@ public:
             "0 for silent. 1 for only Moco's own output. "
             "2 for output from CasADi and the underlying solver (default: 2).");
     OpenSim_DECLARE_PROPERTY(transcription_scheme, std::string,
-            "'trapezoidal' for trapezoidal transcription, or 'hermite-simpson' "
-            "(default) for separated Hermite-Simpson transcription.");
+            "'trapezoidal' for trapezoidal transcription, 'hermite-simpson' "
+            "(default) for separated Hermite-Simpson transcription, or "
+            "'legendre-gauss-radau-<N>' (MocoCasADiSolver only) for "
+            "Legendre-Gauss-Radau transcription with polynomials of degree "
+            "N (1 to 9) in each mesh interval.");
     OpenSim_DECLARE_PROPERTY(interpolate_control_midpoints, bool,
             "If the transcription scheme is set to 'hermite-simpson', then "
             "enable this property to constrain the control values at mesh "
@@ -252,12 +252,15 @@ void MocoContactTrackingGoal::calcIntegrandImpl(
 
         // Model force.
         SimTK::Vec3 force_model(0);
+        SimTK::SpatialVec forceOnSphere;
+        SimTK::SpatialVec forceOnHalfSpace;
         for (const auto& entry : group.contacts) {
-            Array<double> recordValues = entry.first->getRecordValues(state);
+            entry.first->calcContactForces(state, m_contactForceWorkspace,
+                    forceOnSphere, forceOnHalfSpace);
+            // The record offset is 0 for the sphere and 6 for the half space.
             const auto& recordOffset = entry.second;
-            for (int im = 0; im < force_model.size(); ++im) {
-                force_model[im] += recordValues[recordOffset + im];
-            }
+            force_model += recordOffset == 0 ? forceOnSphere[1]
+                                             : forceOnHalfSpace[1];
         }
 
         // Reference force.
@@ -20,6 +20,7 @@
 
 #include "MocoGoal.h"
 #include <OpenSim/Simulation/Model/ExternalLoads.h>
+#include <OpenSim/Simulation/Model/SmoothSphereHalfSpaceForce.h>
 
 namespace OpenSim {
 
@@ -270,6 +271,9 @@ private:
         const PhysicalFrame* refExpressedInFrame = nullptr;
     };
     mutable std::vector<GroupInfo> m_groups;
+    /// Shared by all contact forces so that the system-sized force vectors
+    /// are allocated once rather than for every contact at every time.
+    mutable SmoothSphereHalfSpaceForce::ForceWorkspace m_contactForceWorkspace;
 };
 
 } // namespace OpenSim
@@ -139,22 +139,32 @@ void MocoControlTrackingGoal::initializeOnModelImpl(const Model& model) const {
         m_control_names.push_back(controlToTrack);
         m_ref_labels.push_back(refLabel);
     }
+    m_ref_values.clear();
 
     setRequirements(1, 1, SimTK::Stage::Model);
 }
 
+void MocoControlTrackingGoal::initializeOnGridImpl(
+        const SimTK::Vector& times) const {
+    m_ref_values.tabulate(m_ref_splines, times);
+}
+
 void MocoControlTrackingGoal::calcIntegrandImpl(
         const IntegrandInput& input, SimTK::Real& integrand) const {
 
     const auto& time = input.time;
     SimTK::Vector timeVec(1, time);
     const auto& controls = input.controls;
+    // Use the tabulated reference values if this is a grid time.
+    const int itime = m_ref_values.findTimeIndex(time);
 
     integrand = 0;
     for (int i = 0; i < (int)m_control_indices.size(); ++i) {
         const auto& modelValue = controls[m_control_indices[i]];
-        const auto& refValue =
-                m_ref_splines[m_ref_indices[i]].calcValue(timeVec);
+        const double refValue =
+                itime != -1
+                        ? m_ref_values.getValue(itime, m_ref_indices[i])
+                        : m_ref_splines[m_ref_indices[i]].calcValue(timeVec);
         integrand +=
                 m_control_weights[i] * SimTK::square(modelValue - refValue);
     }
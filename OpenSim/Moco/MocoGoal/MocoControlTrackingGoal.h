@@ -23,6 +23,7 @@
 
 #include <OpenSim/Common/GCVSplineSet.h>
 #include <OpenSim/Common/TimeSeriesTable.h>
+#include <OpenSim/Moco/MocoUtilities.h>
 #include <OpenSim/Moco/MocoWeightSet.h>
 #include <OpenSim/Simulation/TableProcessor.h>
 
@@ -206,6 +207,7 @@ public:
 protected:
     // TODO check that the reference covers the entire possible time range.
     void initializeOnModelImpl(const Model& model) const override;
+    void initializeOnGridImpl(const SimTK::Vector& times) const override;
     void calcIntegrandImpl(
             const IntegrandInput& input, SimTK::Real& integrand) const override;
     void calcGoalImpl(
@@ -241,6 +243,7 @@ private:
     mutable std::vector<int> m_control_indices;
     mutable std::vector<double> m_control_weights;
     mutable GCVSplineSet m_ref_splines;
+    mutable TabulatedFunctionSet m_ref_values;
     mutable std::vector<int> m_ref_indices;
     mutable std::vector<std::string> m_control_names;
     mutable std::vector<std::string> m_ref_labels;
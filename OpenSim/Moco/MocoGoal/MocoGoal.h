@@ -286,6 +286,17 @@ public:
                 "but it was not.");
     }
 
+    /// Solvers invoke this after initializeOnModel() if the initial and final
+    /// times of the problem are fixed, passing the (nondecreasing) times at
+    /// which they will evaluate calcIntegrand() (e.g., the times of the
+    /// collocation grid). Goals can use this to precompute quantities that
+    /// depend only on time, such as reference data. Solvers may still invoke
+    /// calcIntegrand() at other times.
+    void initializeOnGrid(const SimTK::Vector& times) const {
+        if (!get_enabled()) { return; }
+        initializeOnGridImpl(times);
+    }
+
     /// Print the name type and mode of this goal. In cost mode, this prints the
     /// weight.
     void printDescription() const;
@@ -329,6 +340,10 @@ protected:
         m_stageDependency = stageDependency;
     }
 
+    /// Precompute quantities that depend only on time at the given times.
+    /// See initializeOnGrid(). By default, this does nothing.
+    virtual void initializeOnGridImpl(const SimTK::Vector& /*times*/) const {}
+
     virtual Mode getDefaultModeImpl() const { return Mode::Cost; }
     virtual bool getSupportsEndpointConstraintImpl() const { return false; }
     /// You may need to realize the state to the stage required for your
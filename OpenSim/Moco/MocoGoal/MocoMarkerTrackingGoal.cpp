@@ -78,15 +78,23 @@ void MocoMarkerTrackingGoal::initializeOnModelImpl(const Model& model) const {
     // trajectories.
     m_refsplines =
             GCVSplineSet(get_markers_reference().getMarkerTable().flatten());
+    m_refvalues.clear();
 
     setRequirements(1, 1, SimTK::Stage::Position);
 }
 
+void MocoMarkerTrackingGoal::initializeOnGridImpl(
+        const SimTK::Vector& times) const {
+    m_refvalues.tabulate(m_refsplines, times);
+}
+
 void MocoMarkerTrackingGoal::calcIntegrandImpl(
         const IntegrandInput& input, SimTK::Real& integrand) const {
      const auto& time = input.state.getTime();
      getModel().realizePosition(input.state);
      SimTK::Vector timeVec(1, time);
+     // Use the tabulated reference values if this is a grid time.
+     const int itime = m_refvalues.findTimeIndex(time);
 
     for (int i = 0; i < (int)m_model_markers.size(); ++i) {
          const auto& modelValue =
@@ -96,9 +104,14 @@ void MocoMarkerTrackingGoal::calcIntegrandImpl(
         // Get the markers reference index corresponding to the current
         // model marker and get the reference value.
         int refidx = m_refindices[i];
-        refValue[0] = m_refsplines[3 * refidx].calcValue(timeVec);
-        refValue[1] = m_refsplines[3 * refidx + 1].calcValue(timeVec);
-        refValue[2] = m_refsplines[3 * refidx + 2].calcValue(timeVec);
+        if (itime != -1) {
+            refValue = SimTK::Vec3::getAs(m_refvalues.getValues(itime) +
+                                          3 * refidx);
+        } else {
+            refValue[0] = m_refsplines[3 * refidx].calcValue(timeVec);
+            refValue[1] = m_refsplines[3 * refidx + 1].calcValue(timeVec);
+            refValue[2] = m_refsplines[3 * refidx + 2].calcValue(timeVec);
+        }
 
         double distance = (modelValue - refValue).normSqr();
 
@@ -22,6 +22,7 @@
 
 #include <OpenSim/Common/GCVSplineSet.h>
 #include <OpenSim/Common/TimeSeriesTable.h>
+#include <OpenSim/Moco/MocoUtilities.h>
 #include <OpenSim/Simulation/MarkersReference.h>
 
 namespace OpenSim {
@@ -69,6 +70,7 @@ public:
 
 protected:
     void initializeOnModelImpl(const Model&) const override;
+    void initializeOnGridImpl(const SimTK::Vector& times) const override;
     void calcIntegrandImpl(
             const IntegrandInput& input, SimTK::Real& integrand) const override;
     void calcGoalImpl(
@@ -89,6 +91,7 @@ protected:
             "not in the model (such data would be ignored). Default: false.");
 
     mutable GCVSplineSet m_refsplines;
+    mutable TabulatedFunctionSet m_refvalues;
     mutable std::vector<SimTK::ReferencePtr<const Marker>> m_model_markers;
     mutable std::vector<int> m_refindices;
     mutable SimTK::Array_<double> m_marker_weights;
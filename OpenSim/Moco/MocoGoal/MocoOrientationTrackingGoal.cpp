@@ -163,15 +163,23 @@ void MocoOrientationTrackingGoal::initializeOnModelImpl(const Model& model)
     flatTable.setColumnLabels(colLabels);
 
     m_ref_splines = GCVSplineSet(flatTable);
+    m_ref_values.clear();
 
     setRequirements(1, 1, SimTK::Stage::Position);
 }
 
+void MocoOrientationTrackingGoal::initializeOnGridImpl(
+        const SimTK::Vector& times) const {
+    m_ref_values.tabulate(m_ref_splines, times);
+}
+
 void MocoOrientationTrackingGoal::calcIntegrandImpl(
         const IntegrandInput& input, SimTK::Real& integrand) const {
     const auto& time = input.state.getTime();
     getModel().realizePosition(input.state);
     SimTK::Vector timeVec(1, time);
+    // Use the tabulated reference values if this is a grid time.
+    const int itime = m_ref_values.findTimeIndex(time);
 
     // Rotation frame symbols: 
     //  G - ground
@@ -189,11 +197,14 @@ void MocoOrientationTrackingGoal::calcIntegrandImpl(
         // valid. However, ensuring that the normalization step is included
         // seems to be sufficient for the purposes of this cost. 
         // https://keithmaggio.wordpress.com/2011/02/15/math-magician-lerp-slerp-and-nlerp/
-        const SimTK::Quaternion e(
-            m_ref_splines[4*iframe].calcValue(timeVec),
-            m_ref_splines[4*iframe + 1].calcValue(timeVec),
-            m_ref_splines[4*iframe + 2].calcValue(timeVec),
-            m_ref_splines[4*iframe + 3].calcValue(timeVec));
+        const SimTK::Quaternion e = itime != -1
+            ? SimTK::Quaternion(
+                SimTK::Vec4::getAs(m_ref_values.getValues(itime) + 4*iframe))
+            : SimTK::Quaternion(
+                m_ref_splines[4*iframe].calcValue(timeVec),
+                m_ref_splines[4*iframe + 1].calcValue(timeVec),
+                m_ref_splines[4*iframe + 2].calcValue(timeVec),
+                m_ref_splines[4*iframe + 3].calcValue(timeVec));
         // Construct a Rotation object from which we'll calcuation an angle-axis 
         // representation of the current orientation error.
         const Rotation R_GD(e);
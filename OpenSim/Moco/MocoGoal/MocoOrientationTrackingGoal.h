@@ -22,6 +22,7 @@
 
 #include <OpenSim/Common/GCVSplineSet.h>
 #include <OpenSim/Common/TimeSeriesTable.h>
+#include <OpenSim/Moco/MocoUtilities.h>
 #include <OpenSim/Moco/MocoWeightSet.h>
 #include <OpenSim/Simulation/Model/Frame.h>
 #include <OpenSim/Simulation/TableProcessor.h>
@@ -137,6 +138,7 @@ public:
 
 protected:
     void initializeOnModelImpl(const Model& model) const override;
+    void initializeOnGridImpl(const SimTK::Vector& times) const override;
     void calcIntegrandImpl(
             const IntegrandInput& input, SimTK::Real& integrand) const override;
     void calcGoalImpl(
@@ -173,6 +175,7 @@ private:
 
     TimeSeriesTable_<Rotation> m_rotation_table;
     mutable GCVSplineSet m_ref_splines;
+    mutable TabulatedFunctionSet m_ref_values;
     mutable std::vector<std::string> m_frame_paths;
     mutable std::vector<SimTK::ReferencePtr<const Frame>> m_model_frames;
     mutable std::vector<double> m_rotation_weights;
@@ -97,22 +97,30 @@ void MocoStateTrackingGoal::initializeOnModelImpl(const Model& model) const {
         m_refsplines.cloneAndAppend(allSplines[iref]);
         m_state_names.push_back(refName);
     }
+    m_refvalues.clear();
 
     setRequirements(1, 1, SimTK::Stage::Time);
 }
 
+void MocoStateTrackingGoal::initializeOnGridImpl(
+        const SimTK::Vector& times) const {
+    m_refvalues.tabulate(m_refsplines, times);
+}
+
 void MocoStateTrackingGoal::calcIntegrandImpl(
         const IntegrandInput& input, SimTK::Real& integrand) const {
     const auto& time = input.time;
 
     SimTK::Vector timeVec(1, time);
+    // Use the tabulated reference values if this is a grid time.
+    const int itime = m_refvalues.findTimeIndex(time);
 
-    // TODO cache the reference coordinate values at the mesh points, rather
-    // than evaluating the spline.
     integrand = 0;
     for (int iref = 0; iref < m_refsplines.getSize(); ++iref) {
         const auto& modelValue = input.state.getY()[m_sysYIndices[iref]];
-        const auto& refValue = m_refsplines[iref].calcValue(timeVec);
+        const double refValue = itime != -1
+                                        ? m_refvalues.getValue(itime, iref)
+                                        : m_refsplines[iref].calcValue(timeVec);
         integrand +=
                 m_state_weights[iref] * SimTK::square(modelValue - refValue);
     }
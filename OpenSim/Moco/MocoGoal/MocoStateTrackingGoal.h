@@ -22,6 +22,7 @@
 
 #include <OpenSim/Common/GCVSplineSet.h>
 #include <OpenSim/Common/TimeSeriesTable.h>
+#include <OpenSim/Moco/MocoUtilities.h>
 #include <OpenSim/Moco/MocoWeightSet.h>
 #include <OpenSim/Simulation/TableProcessor.h>
 
@@ -115,6 +116,7 @@ public:
 protected:
     // TODO check that the reference covers the entire possible time range.
     void initializeOnModelImpl(const Model&) const override;
+    void initializeOnGridImpl(const SimTK::Vector& times) const override;
     void calcIntegrandImpl(
             const IntegrandInput& input, SimTK::Real& integrand) const override;
     void calcGoalImpl(
@@ -157,6 +159,8 @@ private:
     }
 
     mutable GCVSplineSet m_refsplines;
+    /// The values of m_refsplines at the grid times, if available.
+    mutable TabulatedFunctionSet m_refvalues;
     /// The indices in Y corresponding to the provided reference coordinates.
     mutable std::vector<int> m_sysYIndices;
     mutable std::vector<double> m_state_weights;
@@ -130,15 +130,23 @@ void MocoTranslationTrackingGoal::initializeOnModelImpl(const Model& model)
 
     m_ref_splines = GCVSplineSet(translationTable.flatten(
         {"/position_x", "/position_y", "/position_z"}));
+    m_ref_values.clear();
 
     setRequirements(1, 1, SimTK::Stage::Position);
 }
 
+void MocoTranslationTrackingGoal::initializeOnGridImpl(
+        const SimTK::Vector& times) const {
+    m_ref_values.tabulate(m_ref_splines, times);
+}
+
 void MocoTranslationTrackingGoal::calcIntegrandImpl(
         const IntegrandInput& input, SimTK::Real& integrand) const {
     const auto& time = input.state.getTime();
     getModel().realizePosition(input.state);
     SimTK::Vector timeVec(1, time);
+    // Use the tabulated reference values if this is a grid time.
+    const int itime = m_ref_values.findTimeIndex(time);
 
     integrand = 0;
     Vec3 position_ref;
@@ -149,8 +157,9 @@ void MocoTranslationTrackingGoal::calcIntegrandImpl(
         // Compute position error.
 
         for (int ip = 0; ip < position_ref.size(); ++ip) {
-            position_ref[ip] =
-                    m_ref_splines[3*iframe + ip].calcValue(timeVec);
+            position_ref[ip] = itime != -1
+                    ? m_ref_values.getValue(itime, 3*iframe + ip)
+                    : m_ref_splines[3*iframe + ip].calcValue(timeVec);
         }
         Vec3 error = position_model - position_ref;
 
@@ -22,6 +22,7 @@
 
 #include <OpenSim/Common/GCVSplineSet.h>
 #include <OpenSim/Common/TimeSeriesTable.h>
+#include <OpenSim/Moco/MocoUtilities.h>
 #include <OpenSim/Moco/MocoWeightSet.h>
 #include <OpenSim/Simulation/Model/Frame.h>
 #include <OpenSim/Simulation/TableProcessor.h>
@@ -135,6 +136,7 @@ public:
 
 protected:
     void initializeOnModelImpl(const Model& model) const override;
+    void initializeOnGridImpl(const SimTK::Vector& times) const override;
     void calcIntegrandImpl(
             const IntegrandInput& input, SimTK::Real& integrand) const override;
     void calcGoalImpl(
@@ -169,6 +171,7 @@ private:
 
     TimeSeriesTableVec3 m_translation_table;
     mutable GCVSplineSet m_ref_splines;
+    mutable TabulatedFunctionSet m_ref_values;
     mutable std::vector<std::string> m_frame_paths;
     mutable std::vector<SimTK::ReferencePtr<const Frame>> m_model_frames;
     mutable std::vector<double> m_translation_weights;
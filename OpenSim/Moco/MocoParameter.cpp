@@ -125,7 +125,7 @@ void MocoParameter::initializeOnModel(Model& model) const {
             }
         }
 
-        m_property_refs.emplace_back(ap);
+        m_component_refs.emplace_back(&component);
     }
 }
 
@@ -147,18 +147,22 @@ void MocoParameter::printDescription() const {
 }
 
 void MocoParameter::applyParameterToModelProperties(const double& value) const {
-    for (auto& propRef : m_property_refs) {
+    for (auto& componentRef : m_component_refs) {
+        // updPropertyByName() marks the component as out of date with its
+        // properties.
+        AbstractProperty* ap =
+                &componentRef->updPropertyByName(get_property_name());
 
         if (m_data_type == Type_double) {
-            static_cast<Property<double>*>(propRef.get())->setValue(value);
+            static_cast<Property<double>*>(ap)->setValue(value);
         } else {
             int elt = get_property_element();
             if (m_data_type == Type_Vec3) {
-                static_cast<Property<SimTK::Vec3>*>(
-                    propRef.get())->updValue()[elt] = value;
+                static_cast<Property<SimTK::Vec3>*>(ap)->updValue()[elt] =
+                        value;
             } else if (m_data_type == Type_Vec6) {
-                static_cast<Property<SimTK::Vec6>*>(
-                    propRef.get())->updValue()[elt] = value;
+                static_cast<Property<SimTK::Vec6>*>(ap)->updValue()[elt] =
+                        value;
             }
         }
     }
@@ -147,12 +147,16 @@ public:
     This method takes a non-const reference to the model because parameters
     need to be able to alter the model.
     If it is desired to apply this MocoParameter to multiple models, this
-    should be called on all models of interest. The property references from
-    each model will be appended to this MocoParameter's internal property
+    should be called on all models of interest. The component references from
+    each model will be appended to this MocoParameter's internal component
     reference list. */
     void initializeOnModel(Model& model) const;
     /** Set the value of the stored model properties, which may include
-    properties from multiple models. */
+    properties from multiple models. The components owning the properties are
+    marked as out of date with their properties (see
+    Object::isObjectUpToDateWithProperties()), so that components that cache
+    values derived from their properties (e.g., Thelen2003Muscle) refresh
+    them even if Model::initSystem() is not invoked. */
     void applyParameterToModelProperties(const double& value) const;
 
     /** Print the name, property name, component paths, property element (if it
@@ -170,7 +174,7 @@ private:
     OpenSim_DECLARE_OPTIONAL_PROPERTY(property_element, int, "For non-scalar "
         "model properties, the index of the element to be optimized.");
 
-    mutable std::vector<SimTK::ReferencePtr<AbstractProperty>> m_property_refs;
+    mutable std::vector<SimTK::ReferencePtr<Object>> m_component_refs;
     enum DataType {
         Type_double,
         Type_Vec3,
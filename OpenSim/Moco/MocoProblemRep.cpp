@@ -24,9 +24,11 @@
 #include "Components/PositionMotion.h"
 #include "MocoProblem.h"
 #include "MocoProblemInfo.h"
+#include "MocoUtilities.h"
 #include <regex>
 #include <unordered_set>
 
+#include <OpenSim/Simulation/Model/GeometryPath.h>
 #include <OpenSim/Simulation/SimulationUtilities.h>
 
 using namespace OpenSim;
@@ -694,6 +696,42 @@ const MocoGoal& MocoProblemRep::getEndpointConstraint(
 const MocoGoal& MocoProblemRep::getEndpointConstraintByIndex(int index) const {
     return *m_endpoint_constraints[index];
 }
+void MocoProblemRep::initializeGoalsOnGrid(const SimTK::Vector& times) const {
+    for (const auto& goal : m_costs) { goal->initializeOnGrid(times); }
+    for (const auto& goal : m_endpoint_constraints) {
+        goal->initializeOnGrid(times);
+    }
+}
+void MocoProblemRep::initializePrescribedKinematicsOnGrid(
+        const SimTK::Vector& times) const {
+    m_prescribed_kinematics_times.clear();
+    m_prescribed_kinematics_states.clear();
+    // Parameters may change the kinematics or the muscle paths.
+    if (!m_prescribedKinematics || !m_parameters.empty()) return;
+
+    const auto& model = m_model_disabled_constraints;
+    for (int itime = 0; itime < times.size(); ++itime) {
+        // Avoid storing a state more than once for repeated times.
+        if (itime > 0 && times[itime] == times[itime - 1]) continue;
+        SimTK::State state = m_state_disabled_constraints[0];
+        state.setTime(times[itime]);
+        model.getSystem().prescribe(state);
+        // Solvers invalidate Stage::Velocity when using the state, so we only
+        // compute position-level quantities.
+        model.realizePosition(state);
+        for (const auto& path : model.getComponentList<GeometryPath>()) {
+            path.getLength(state);
+        }
+        m_prescribed_kinematics_times.push_back(times[itime]);
+        m_prescribed_kinematics_states.push_back(std::move(state));
+    }
+}
+const SimTK::State* MocoProblemRep::findPrescribedKinematicsStateOnGrid(
+        double time) const {
+    const int index = findTimeIndex(m_prescribed_kinematics_times, time);
+    if (index == -1) return nullptr;
+    return &m_prescribed_kinematics_states[index];
+}
 const MocoPathConstraint& MocoProblemRep::getPathConstraint(
         const std::string& name) const {
 
@@ -210,6 +210,31 @@ public:
     /// The order is the same as in getEndpointConstraintNames().
     /// Note: this does not perform a bounds check.
     const MocoGoal& getEndpointConstraintByIndex(int index) const;
+    /// Invoke MocoGoal::initializeOnGrid() on all goals (in both cost and
+    /// endpoint constraint mode). Solvers invoke this if the initial and final
+    /// times are fixed, with the times at which goal integrands are evaluated.
+    void initializeGoalsOnGrid(const SimTK::Vector& times) const;
+    /// If isPrescribedKinematics() is true and the problem has no parameters,
+    /// the kinematics at a given time do not depend on the solver's
+    /// variables. In that case, this function stores, for each of the given
+    /// times, a copy of updStateDisabledConstraints() that has the prescribed
+    /// coordinates and speeds, is realized to SimTK::Stage::Position, and
+    /// contains the length of every GeometryPath in ModelDisabledConstraints.
+    /// Otherwise, this function has no effect. Solvers invoke this if the
+    /// initial and final times are fixed, so that path lengths (which may
+    /// require expensive wrapping calculations) are computed only once for
+    /// each time. Velocity-level quantities (e.g., lengthening speeds) are not
+    /// stored, since they may depend on auxiliary states (e.g., through
+    /// MuscleLengthInfo) and are recomputed in every evaluation.
+    void initializePrescribedKinematicsOnGrid(
+            const SimTK::Vector& times) const;
+    /// Get the state stored by initializePrescribedKinematicsOnGrid() for the
+    /// given time, or nullptr if there is no such state. Solvers should copy
+    /// this state into updStateDisabledConstraints(), invalidate the cache at
+    /// SimTK::Stage::Velocity and above, and then set only the auxiliary
+    /// state variables (with SimTK::State::updZ()) and discrete variables, so
+    /// that the position-level quantities remain realized.
+    const SimTK::State* findPrescribedKinematicsStateOnGrid(double time) const;
     /// Get a MocoPathConstraint. Note: this does not
     /// include MocoKinematicConstraints, use getKinematicConstraint() instead.
     const MocoPathConstraint& getPathConstraint(const std::string& name) const;
@@ -392,6 +417,8 @@ private:
     SimTK::ReferencePtr<AccelerationMotion> m_acceleration_motion;
 
     bool m_prescribedKinematics = false;
+    mutable std::vector<double> m_prescribed_kinematics_times;
+    mutable std::vector<SimTK::State> m_prescribed_kinematics_states;
 
     std::unordered_map<std::string, MocoVariableInfo> m_state_infos;
     std::unordered_map<std::string, MocoVariableInfo> m_control_infos;
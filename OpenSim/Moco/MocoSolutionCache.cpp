@@ -0,0 +1,119 @@
+/* -------------------------------------------------------------------------- *
+ * OpenSim Moco: MocoSolutionCache.cpp                                        *
+ * -------------------------------------------------------------------------- *
+ * Copyright (c) 2020 Stanford University and the Authors                     *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0          *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#include "MocoSolutionCache.h"
+
+#include "MocoCasADiSolver/MocoCasADiSolver.h"
+#include "MocoProblemRep.h"
+#include "MocoStudy.h"
+#include "MocoTropterSolver.h"
+
+#include <OpenSim/Common/Logger.h>
+
+using namespace OpenSim;
+
+MocoSolution MocoSolutionCache::solve(
+        MocoStudy& study, const SimTK::Vector& parameters) {
+    const std::size_t key = createKey(study);
+    if (const MocoSolution* nearest = findNearest(key, parameters)) {
+        auto& solver = study.updSolver();
+        if (auto* casSolver = dynamic_cast<MocoCasADiSolver*>(&solver)) {
+            casSolver->setWarmStart(*nearest);
+        } else if (auto* tropSolver =
+                           dynamic_cast<MocoTropterSolver*>(&solver)) {
+            tropSolver->setGuess(*nearest);
+        } else {
+            log_warn("MocoSolutionCache: cannot set the guess for solver of "
+                     "type {}; solving without a warm start.",
+                    solver.getConcreteClassName());
+        }
+    }
+    MocoSolution solution = study.solve();
+    if (solution.success()) add(key, parameters, solution);
+    return solution;
+}
+
+void MocoSolutionCache::add(std::size_t key, const SimTK::Vector& parameters,
+        const MocoSolution& solution) {
+    OPENSIM_THROW_IF(!solution.success(), Exception,
+            "Expected a successful solution, but the solver status is '{}'.",
+            solution.getStatus());
+    m_solutions[key].push_back({parameters, solution});
+}
+
+const MocoSolution* MocoSolutionCache::findNearest(
+        std::size_t key, const SimTK::Vector& parameters) const {
+    auto it = m_solutions.find(key);
+    if (it == m_solutions.end()) return nullptr;
+    const MocoSolution* nearest = nullptr;
+    double minDistance = SimTK::Infinity;
+    for (const auto& entry : it->second) {
+        if (entry.parameters.size() != parameters.size()) continue;
+        const double distance = (entry.parameters - parameters).norm();
+        if (distance < minDistance) {
+            minDistance = distance;
+            nearest = &entry.solution;
+        }
+    }
+    return nearest;
+}
+
+int MocoSolutionCache::getNumSolutions() const {
+    int numSolutions = 0;
+    for (const auto& kv : m_solutions) {
+        numSolutions += (int)kv.second.size();
+    }
+    return numSolutions;
+}
+
+std::size_t MocoSolutionCache::createKey(const MocoStudy& study) {
+    std::stringstream ss;
+    auto append = [&ss](const std::string& label,
+                          const std::vector<std::string>& names) {
+        ss << label << ":";
+        for (const auto& name : names) ss << name << ",";
+        ss << "\n";
+    };
+
+    const MocoProblemRep rep = study.getProblem().createRep();
+    append("states", rep.createStateInfoNames());
+    append("controls", rep.createControlInfoNames());
+    append("multipliers", rep.createMultiplierInfoNames());
+    append("parameters", rep.createParameterNames());
+    append("costs", rep.createCostNames());
+    for (int i = 0; i < rep.getNumCosts(); ++i) {
+        ss << rep.getCostByIndex(i).getConcreteClassName() << ",";
+    }
+    ss << "\n";
+    append("endpoint_constraints", rep.createEndpointConstraintNames());
+    for (int i = 0; i < rep.getNumEndpointConstraints(); ++i) {
+        ss << rep.getEndpointConstraintByIndex(i).getConcreteClassName()
+           << ",";
+    }
+    ss << "\n";
+    append("path_constraints", rep.createPathConstraintNames());
+
+    // Setting a guess clears the guess file, so the guess file must not
+    // affect the key.
+    std::unique_ptr<MocoSolver> solver(study.getSolver().clone());
+    if (auto* dircol = dynamic_cast<MocoDirectCollocationSolver*>(
+                solver.get())) {
+        dircol->set_guess_file("");
+    }
+    ss << solver->dump();
+
+    return std::hash<std::string>()(ss.str());
+}
@@ -0,0 +1,96 @@
+#ifndef OPENSIM_MOCOSOLUTIONCACHE_H
+#define OPENSIM_MOCOSOLUTIONCACHE_H
+/* -------------------------------------------------------------------------- *
+ * OpenSim Moco: MocoSolutionCache.h                                          *
+ * -------------------------------------------------------------------------- *
+ * Copyright (c) 2020 Stanford University and the Authors                     *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0          *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#include "MocoTrajectory.h"
+
+#include <unordered_map>
+
+namespace OpenSim {
+
+class MocoStudy;
+
+/// This class stores solutions to MocoStudies so that repeated solves of
+/// similar problems (e.g., a parameter sweep over model properties or goal
+/// weights) can be warm-started from the most similar previous solution.
+///
+/// Solutions are grouped by a key that describes the structure of the study
+/// (see createKey()); a solution can only be used to warm-start a study with
+/// the same key. Within a key, each solution is stored along with a vector of
+/// parameters that you provide to describe the problem (e.g., the values of
+/// the swept quantities), and the solution whose parameters are nearest
+/// (Euclidean distance) to the parameters of the new problem is used.
+///
+/// With MocoCasADiSolver, the warm start includes the multipliers of the
+/// nonlinear program (see MocoCasADiSolver::setWarmStart()); with
+/// MocoTropterSolver, only the trajectory is used as the guess.
+///
+/// @code
+/// MocoSolutionCache cache;
+/// for (double mass : {1.0, 1.1, 1.2}) {
+///     MocoStudy study = createStudy(mass);
+///     MocoSolution solution = cache.solve(study, SimTK::Vector(1, mass));
+/// }
+/// @endcode
+///
+/// The cache is held in memory and is not thread-safe.
+class OSIMMOCO_API MocoSolutionCache {
+public:
+    /// Set the guess for the study's solver using the cached solution
+    /// nearest to the provided parameters (if the cache has a solution for
+    /// this study's key), solve the study, and add the solution to the cache
+    /// if the solver succeeded. If there is no cached solution for this key,
+    /// the solver's existing guess is used.
+    MocoSolution solve(MocoStudy& study, const SimTK::Vector& parameters);
+
+    /// Add a solution to the cache. The solution must be successful.
+    void add(std::size_t key, const SimTK::Vector& parameters,
+            const MocoSolution& solution);
+
+    /// Get the cached solution, among those with the given key, whose
+    /// parameters are nearest to the provided parameters. This returns
+    /// nullptr if there are no solutions for this key. Solutions whose
+    /// parameters have a different size than the provided parameters are
+    /// ignored.
+    const MocoSolution* findNearest(
+            std::size_t key, const SimTK::Vector& parameters) const;
+
+    /// The total number of solutions in the cache.
+    int getNumSolutions() const;
+
+    /// Remove all solutions from the cache.
+    void clear() { m_solutions.clear(); }
+
+    /// Create a key describing the structure of the study: the names of the
+    /// variables, goals, and constraints of the problem, the types of the
+    /// goals, and the solver's settings (excluding the guess file). Problems
+    /// with the same key transcribe to nonlinear programs with the same
+    /// variables and constraints. The numeric values in the problem (e.g.,
+    /// bounds, goal weights, model properties) do not affect the key.
+    static std::size_t createKey(const MocoStudy& study);
+
+private:
+    struct Entry {
+        SimTK::Vector parameters;
+        MocoSolution solution;
+    };
+    std::unordered_map<std::size_t, std::vector<Entry>> m_solutions;
+};
+
+} // namespace OpenSim
+
+#endif // OPENSIM_MOCOSOLUTIONCACHE_H
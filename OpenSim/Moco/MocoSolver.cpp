@@ -101,6 +101,13 @@ void MocoSolver::setSolutionStats(MocoSolution& sol, bool success,
     sol.setObjectiveBreakdown(std::move(objectiveBreakdown));
 }
 
+void MocoSolver::setSolutionNLPMultipliers(MocoSolution& sol,
+        SimTK::Vector variableMultipliers,
+        SimTK::Vector constraintMultipliers) {
+    sol.setNLPMultipliers(std::move(variableMultipliers),
+            std::move(constraintMultipliers));
+}
+
 std::unique_ptr<ThreadsafeJar<const MocoProblemRep>>
         MocoSolver::createProblemRepJar(int size) const {
     auto jar = OpenSim::make_unique<ThreadsafeJar<const MocoProblemRep>>();
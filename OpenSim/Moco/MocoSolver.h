@@ -88,6 +88,11 @@ protected:
             double duration,
             std::vector<std::pair<std::string, double>> objectiveBreakdown =
                     {});
+    /// This is a service for derived classes to set the multipliers of the
+    /// nonlinear program; see MocoSolution::getNLPVariableMultipliers().
+    static void setSolutionNLPMultipliers(MocoSolution&,
+            SimTK::Vector variableMultipliers,
+            SimTK::Vector constraintMultipliers);
 
     const MocoProblemRep& getProblemRep() const {
         return m_problemRep;
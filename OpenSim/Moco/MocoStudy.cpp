@@ -79,6 +79,8 @@ MocoCasADiSolver& MocoStudy::initCasADiSolver() {
 
 MocoSolver& MocoStudy::updSolver() { return updSolver<MocoSolver>(); }
 
+const MocoSolver& MocoStudy::getSolver() const { return get_solver(); }
+
 MocoSolution MocoStudy::solve() const {
     initSolverInternal();
 
@@ -134,6 +134,9 @@ public:
     /// will have no effect on this MocoStudy.
     MocoSolver& updSolver();
 
+    /// Access the solver. Make sure to call `initSolver()` beforehand.
+    const MocoSolver& getSolver() const;
+
     /// Solve the provided MocoProblem using the provided MocoSolver, and obtain
     /// the solution to the problem. If the write_solution property is true,
     /// then the solution is also written to disk in the directory specified in
@@ -0,0 +1,184 @@
+/* -------------------------------------------------------------------------- *
+ * OpenSim Moco: MocoStudyBatch.cpp                                           *
+ * -------------------------------------------------------------------------- *
+ * Copyright (c) 2020 Stanford University and the Authors                     *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0          *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#include "MocoStudyBatch.h"
+
+#include "MocoCasADiSolver/MocoCasADiSolver.h"
+#include "MocoTropterSolver.h"
+
+#include <atomic>
+#include <thread>
+
+#include <OpenSim/Common/Logger.h>
+#include <OpenSim/Common/Stopwatch.h>
+
+using namespace OpenSim;
+
+int MocoStudyBatch::addStudy(const MocoStudy& study) {
+    m_studies.push_back(study);
+    return getNumStudies() - 1;
+}
+
+void MocoStudyBatch::addStudies(const MocoStudy& study,
+        const std::vector<std::function<void(MocoStudy&)>>& overrides) {
+    for (const auto& modify : overrides) {
+        MocoStudy copy(study);
+        modify(copy);
+        m_studies.push_back(std::move(copy));
+    }
+}
+
+const MocoStudy& MocoStudyBatch::getStudy(int index) const {
+    OPENSIM_THROW_IF(index < 0 || index >= getNumStudies(), Exception,
+            "Index {} is invalid; there are {} studies.", index,
+            getNumStudies());
+    return m_studies[index];
+}
+
+MocoStudy& MocoStudyBatch::updStudy(int index) {
+    OPENSIM_THROW_IF(index < 0 || index >= getNumStudies(), Exception,
+            "Index {} is invalid; there are {} studies.", index,
+            getNumStudies());
+    return m_studies[index];
+}
+
+void MocoStudyBatch::setNumThreadsPerStudy(int numThreads) {
+    OPENSIM_THROW_IF(numThreads < 1, Exception,
+            "Expected the number of threads per study to be at least 1, but "
+            "got {}.",
+            numThreads);
+    m_numThreadsPerStudy = numThreads;
+}
+
+void MocoStudyBatch::setNumParallelStudies(int numStudies) {
+    OPENSIM_THROW_IF(numStudies < 1, Exception,
+            "Expected the number of parallel studies to be at least 1, but "
+            "got {}.",
+            numStudies);
+    m_numParallelStudies = numStudies;
+}
+
+int MocoStudyBatch::getNumThreadsPerStudy() const {
+    if (m_numThreadsPerStudy != -1) return m_numThreadsPerStudy;
+    return std::max(1, (int)std::thread::hardware_concurrency());
+}
+
+int MocoStudyBatch::getNumParallelStudies() const {
+    if (m_numParallelStudies != -1) return m_numParallelStudies;
+    const int numCores = (int)std::thread::hardware_concurrency();
+    return std::max(1, numCores / getNumThreadsPerStudy());
+}
+
+std::vector<MocoSolution> MocoStudyBatch::solve() {
+    const Stopwatch stopwatch;
+    const int numStudies = getNumStudies();
+
+    const int numThreadsPerStudy = getNumThreadsPerStudy();
+    // The `parallel` property of MocoCasADiSolver uses 0 to disable
+    // parallelization and 1 to use all cores.
+    bool hasTropterStudy = false;
+    for (auto& study : m_studies) {
+        auto& solver = study.updSolver();
+        if (auto* casSolver = dynamic_cast<MocoCasADiSolver*>(&solver)) {
+            casSolver->set_parallel(
+                    numThreadsPerStudy == 1 ? 0 : numThreadsPerStudy);
+        } else if (dynamic_cast<MocoTropterSolver*>(&solver)) {
+            hasTropterStudy = true;
+        }
+    }
+
+    m_solutions.assign(numStudies, MocoSolution());
+    m_exceptionMessages.assign(numStudies, "");
+    std::atomic<int> nextStudy(0);
+    auto solveStudies = [&]() {
+        int index;
+        while ((index = nextStudy++) < numStudies) {
+            try {
+                m_solutions[index] = m_studies[index].solve();
+            } catch (const std::exception& e) {
+                m_exceptionMessages[index] = e.what();
+            } catch (...) {
+                m_exceptionMessages[index] = "unknown exception";
+            }
+        }
+    };
+
+    // Solvers temporarily change the (global) logger level, and studies
+    // that finish in a different order than they started could leave the
+    // level changed.
+    const Logger::Level origLoggerLevel = Logger::getLevel();
+    int numThreads = std::min(getNumParallelStudies(), numStudies);
+    if (hasTropterStudy && numThreads > 1) {
+        log_warn("MocoStudyBatch: solving studies one at a time, since "
+                 "MocoTropterSolver is not thread-safe.");
+        numThreads = 1;
+    }
+    std::vector<std::thread> threads;
+    for (int ithread = 0; ithread < numThreads; ++ithread) {
+        threads.emplace_back(solveStudies);
+    }
+    for (auto& thread : threads) thread.join();
+    Logger::setLevel(origLoggerLevel);
+    m_duration = stopwatch.getElapsedTime();
+
+    std::string failures;
+    for (int index = 0; index < numStudies; ++index) {
+        if (!m_exceptionMessages[index].empty()) {
+            failures += fmt::format("\n  study {} ('{}'): {}", index,
+                    m_studies[index].getName(), m_exceptionMessages[index]);
+        }
+    }
+    OPENSIM_THROW_IF(!failures.empty(), Exception,
+            "The following studies threw an exception:{}", failures);
+    return m_solutions;
+}
+
+const MocoSolution& MocoStudyBatch::getSolution(int index) const {
+    OPENSIM_THROW_IF(index < 0 || index >= (int)m_solutions.size(),
+            Exception,
+            "Index {} is invalid; there are {} solutions. Did you call "
+            "solve()?",
+            index, m_solutions.size());
+    OPENSIM_THROW_IF(!m_exceptionMessages[index].empty(), Exception,
+            "Study {} threw an exception: {}", index,
+            m_exceptionMessages[index]);
+    return m_solutions[index];
+}
+
+void MocoStudyBatch::printSummary() const {
+    log_cout("Solved {} studies ({} at a time, {} thread(s) per study) in "
+             "{:.2f} s.",
+            m_solutions.size(), getNumParallelStudies(),
+            getNumThreadsPerStudy(), m_duration);
+    for (int index = 0; index < (int)m_solutions.size(); ++index) {
+        const auto& name = m_studies[index].getName();
+        if (!m_exceptionMessages[index].empty()) {
+            log_cout("  {:>3} {}: exception: {}", index, name,
+                    m_exceptionMessages[index]);
+            continue;
+        }
+        const auto& solution = m_solutions[index];
+        if (solution.success()) {
+            log_cout("  {:>3} {}: {}; objective: {}; iterations: {}; "
+                     "duration: {:.2f} s",
+                    index, name, solution.getStatus(),
+                    solution.getObjective(), solution.getNumIterations(),
+                    solution.getSolverDuration());
+        } else {
+            log_cout("  {:>3} {}: {}", index, name, solution.getStatus());
+        }
+    }
+}
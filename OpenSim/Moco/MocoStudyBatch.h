@@ -0,0 +1,114 @@
+#ifndef OPENSIM_MOCOSTUDYBATCH_H
+#define OPENSIM_MOCOSTUDYBATCH_H
+/* -------------------------------------------------------------------------- *
+ * OpenSim Moco: MocoStudyBatch.h                                             *
+ * -------------------------------------------------------------------------- *
+ * Copyright (c) 2020 Stanford University and the Authors                     *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0          *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#include "MocoStudy.h"
+
+#include <functional>
+
+namespace OpenSim {
+
+/// This class solves many MocoStudies in one process. Use
+/// setNumThreadsPerStudy() and setNumParallelStudies() to split the
+/// available cores between the studies.
+///
+/// The studies are copied when added to the batch, and solve() solves the
+/// copies in the order they were added, using a pool of
+/// getNumParallelStudies() threads.
+///
+/// CasADi's objects are not thread-safe, and CasADi creates such objects
+/// every time it evaluates the model during an NLP solve. Therefore,
+/// MocoCasADiSolver holds a process-wide mutex for its entire solve (from
+/// creating the MocoCasOCProblem to converting the NLP result to a
+/// MocoSolution), and the NLP solves of the studies run one at a time. Only
+/// the work outside the solver (e.g., initializing the models and writing
+/// the solutions) runs concurrently. Therefore, by default, each study uses
+/// all processor cores to evaluate its model in parallel (see the `parallel`
+/// property of MocoCasADiSolver). To solve the NLPs of many problems
+/// concurrently, solve them in separate processes instead. MocoTropterSolver
+/// uses ADOL-C, which is not thread-safe; if any study uses
+/// MocoTropterSolver, the studies are solved one at a time.
+///
+/// @code
+/// MocoStudyBatch batch;
+/// std::vector<std::function<void(MocoStudy&)>> overrides;
+/// for (double finalTime : {0.8, 0.9, 1.0, 1.1}) {
+///     overrides.push_back([finalTime](MocoStudy& s) {
+///         s.updProblem().setTimeBounds(0, finalTime);
+///     });
+/// }
+/// batch.addStudies(study, overrides);
+/// std::vector<MocoSolution> solutions = batch.solve();
+/// batch.printSummary();
+/// @endcode
+///
+/// The studies must not share resources that are not threadsafe. In
+/// particular, studies that write their solution (`write_solution`) must use
+/// different names or results directories. Set the solvers' verbosity to 0
+/// to avoid interleaved output from the studies.
+class OSIMMOCO_API MocoStudyBatch {
+public:
+    /// Add a copy of the study to the batch, and return its index.
+    int addStudy(const MocoStudy& study);
+    /// Add a copy of the study for each function in `overrides`. Each
+    /// function modifies its own copy of the study; for example, it may set a
+    /// model property, a goal weight, or a tracking reference.
+    void addStudies(const MocoStudy& study,
+            const std::vector<std::function<void(MocoStudy&)>>& overrides);
+    int getNumStudies() const { return (int)m_studies.size(); }
+    const MocoStudy& getStudy(int index) const;
+    /// Use this to edit a study after adding it to the batch.
+    MocoStudy& updStudy(int index);
+
+    /// Set the number of threads used to solve each study. This sets the
+    /// `parallel` property of each study that uses MocoCasADiSolver (a value
+    /// of 1 disables parallelization within the study). Studies using other
+    /// solvers are not affected. Default: the number of processor cores.
+    void setNumThreadsPerStudy(int numThreads);
+    int getNumThreadsPerStudy() const;
+    /// Set the number of studies to solve at the same time. By default, this
+    /// is the number of processor cores divided by getNumThreadsPerStudy()
+    /// (and at least 1).
+    void setNumParallelStudies(int numStudies);
+    int getNumParallelStudies() const;
+
+    /// Solve all studies, and return their solutions in the order the studies
+    /// were added. If any study throws an exception, we still solve the
+    /// remaining studies, and then throw an exception that lists the studies
+    /// that failed; you can obtain the solutions of the other studies with
+    /// getSolution().
+    std::vector<MocoSolution> solve();
+
+    /// Get the solution of a study from the last call to solve().
+    const MocoSolution& getSolution(int index) const;
+
+    /// Print the status, objective, number of iterations, and solver duration
+    /// of each study from the last call to solve().
+    void printSummary() const;
+
+private:
+    std::vector<MocoStudy> m_studies;
+    std::vector<MocoSolution> m_solutions;
+    std::vector<std::string> m_exceptionMessages;
+    int m_numThreadsPerStudy = -1;
+    int m_numParallelStudies = -1;
+    double m_duration = -1;
+};
+
+} // namespace OpenSim
+
+#endif // OPENSIM_MOCOSTUDYBATCH_H
@@ -18,6 +18,7 @@
 #include "MocoTrajectory.h"
 
 #include "MocoProblem.h"
+#include "MocoTrajectoryBinary.h"
 #include "MocoUtilities.h"
 
 #include <OpenSim/Common/STOFileAdapter.h>
@@ -660,6 +661,13 @@ void MocoTrajectory::resample(SimTK::Vector time) {
 }
 
 MocoTrajectory::MocoTrajectory(const std::string& filepath) {
+    if (MocoTrajectoryBinaryReader::isBinaryFile(filepath)) {
+        MocoTrajectoryBinaryReader reader(filepath);
+        OPENSIM_THROW_IF(reader.getNumTrajectories() == 0, Exception,
+                "File '{}' does not contain any trajectories.", filepath);
+        *this = reader.readTrajectory(reader.getNumTrajectories() - 1);
+        return;
+    }
     TimeSeriesTable table(filepath);
     const auto& metadata = table.getTableMetaData();
     // TODO: bug with file adapters.
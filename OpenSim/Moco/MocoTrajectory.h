@@ -154,7 +154,9 @@ public:
             const NamesAndData<SimTK::RowVector>& parameters = {});
 #endif
     /// Read a MocoTrajectory from an STO file (see STOFileAdapter). See output
-    /// of write() for the correct format.
+    /// of write() for the correct format. The file can also be a binary
+    /// trajectory file (see MocoTrajectoryBinaryWriter), in which case the
+    /// last trajectory in the file is read.
     explicit MocoTrajectory(const std::string& filepath);
 
     virtual ~MocoTrajectory() = default;
@@ -599,6 +601,8 @@ public:
     /// @{
 
     /// Save the trajectory to a STO file. Use the ."sto" file extension.
+    /// To write a binary file, which is faster to write and read, use
+    /// MocoTrajectoryBinaryWriter.
     void write(const std::string& filepath) const;
 
     /// This table can be saved as a Storage file that can be used in the
@@ -732,6 +736,8 @@ private:
     // with threading (e.g., std::unique_lock()).
     bool m_sealed = false;
     static const std::vector<std::string> m_allowedKeys;
+
+    friend class MocoTrajectoryBinaryReader;
 };
 
 /// Return type for MocoStudy::solve(). Use success() to check if the solver
@@ -815,6 +821,30 @@ public:
     void printObjectiveBreakdown() const;
     /// @}
 
+    /// @name Multipliers of the nonlinear program
+    /// Some solvers (currently, only MocoCasADiSolver) provide the Lagrange
+    /// multipliers of the nonlinear program (NLP) at the solution: one for
+    /// each NLP variable (for its bounds) and one for each NLP constraint.
+    /// These are used to warm-start the solver; see
+    /// MocoCasADiSolver::setWarmStart(). The multipliers are not written to
+    /// STO files (they are written to binary trajectory files; see
+    /// MocoTrajectoryBinaryWriter) and are not affected by resample().
+    /// @{
+
+    /// The multipliers of the bounds on the NLP variables. This is empty if
+    /// the solver did not provide multipliers.
+    const SimTK::Vector& getNLPVariableMultipliers() const {
+        ensureUnsealed();
+        return m_nlpVariableMultipliers;
+    }
+    /// The multipliers of the NLP constraints. This is empty if the solver
+    /// did not provide multipliers.
+    const SimTK::Vector& getNLPConstraintMultipliers() const {
+        ensureUnsealed();
+        return m_nlpConstraintMultipliers;
+    }
+    /// @}
+
     /// @name Access control
     /// @{
 
@@ -856,6 +886,11 @@ private:
         m_numIterations = numIterations;
     };
     void setSolverDuration(double duration) { m_solverDuration = duration; }
+    void setNLPMultipliers(SimTK::Vector variableMultipliers,
+            SimTK::Vector constraintMultipliers) {
+        m_nlpVariableMultipliers = std::move(variableMultipliers);
+        m_nlpConstraintMultipliers = std::move(constraintMultipliers);
+    }
     void convertToTableImpl(TimeSeriesTable&) const override;
     bool m_success = true;
     double m_objective = -1;
@@ -863,8 +898,11 @@ private:
     std::string m_status;
     int m_numIterations = -1;
     double m_solverDuration = -1;
+    SimTK::Vector m_nlpVariableMultipliers;
+    SimTK::Vector m_nlpConstraintMultipliers;
     // Allow solvers to set success, status, and construct a solution.
     friend class MocoSolver;
+    friend class MocoTrajectoryBinaryReader;
 };
 
 } // namespace OpenSim
@@ -0,0 +1,444 @@
+/* -------------------------------------------------------------------------- *
+ * OpenSim Moco: MocoTrajectoryBinary.cpp                                     *
+ * -------------------------------------------------------------------------- *
+ * Copyright (c) 2020 Stanford University and the Authors                     *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0          *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#include "MocoTrajectoryBinary.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <sstream>
+
+using namespace OpenSim;
+
+// File layout (all integers are fixed-width and all numbers use the byte
+// order of the machine that wrote the file):
+//
+// header:
+//   char[8]  "MOCOTRAJ"
+//   uint32   version
+//   uint32   byte order mark (0x01020304)
+//   6 x { uint32 number of names, number of names x string }
+//            for states, controls, multipliers, derivatives, slacks, and
+//            parameters.
+// records (until the end of the file):
+//   uint64   number of bytes in the record after this field
+//   int32    number of times (N)
+//   double   time[N]
+//   double   data[N] for each state, control, multiplier, derivative, and
+//            slack, in that order.
+//   double   parameters[number of parameters]
+//   uint8    1 if the record contains solver statistics, 0 otherwise.
+//   solver statistics:
+//     uint8  success, string status, double objective,
+//     int32 number of iterations, double solver duration,
+//     uint32 number of objective terms, { string name, double value } for
+//     each objective term,
+//     uint32 size, double[size] for the NLP variable multipliers, and
+//     uint32 size, double[size] for the NLP constraint multipliers.
+//
+// Strings are stored as a uint32 length followed by the characters.
+
+namespace {
+
+const char magic[8] = {'M', 'O', 'C', 'O', 'T', 'R', 'A', 'J'};
+const std::uint32_t version = 1;
+const std::uint32_t byteOrderMark = 0x01020304;
+const int numNameLists = 6;
+// The names of the continuous variables are the first 5 name lists.
+const int numContinuousNameLists = 5;
+
+template <typename T>
+void writeValue(std::ostream& stream, const T& value) {
+    stream.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+void writeString(std::ostream& stream, const std::string& value) {
+    writeValue(stream, (std::uint32_t)value.size());
+    stream.write(value.data(), value.size());
+}
+void writeVector(std::ostream& stream, const SimTK::Vector& value) {
+    writeValue(stream, (std::uint32_t)value.size());
+    for (int i = 0; i < value.size(); ++i) writeValue(stream, value[i]);
+}
+
+template <typename T>
+T readValue(std::istream& stream) {
+    T value;
+    stream.read(reinterpret_cast<char*>(&value), sizeof(T));
+    return value;
+}
+std::string readString(std::istream& stream) {
+    std::string value(readValue<std::uint32_t>(stream), '\0');
+    stream.read(&value[0], value.size());
+    return value;
+}
+SimTK::Vector readVector(std::istream& stream) {
+    SimTK::Vector value((int)readValue<std::uint32_t>(stream));
+    for (int i = 0; i < value.size(); ++i) {
+        value[i] = readValue<double>(stream);
+    }
+    return value;
+}
+
+std::vector<std::vector<std::string>> getNames(
+        const MocoTrajectory& trajectory) {
+    return {trajectory.getStateNames(), trajectory.getControlNames(),
+            trajectory.getMultiplierNames(), trajectory.getDerivativeNames(),
+            trajectory.getSlackNames(), trajectory.getParameterNames()};
+}
+
+} // anonymous namespace
+
+MocoTrajectoryBinaryWriter::MocoTrajectoryBinaryWriter(
+        const std::string& filepath)
+        : m_filepath(filepath),
+          m_stream(filepath, std::ios::binary | std::ios::trunc) {
+    OPENSIM_THROW_IF(!m_stream, Exception, "Could not open file '{}'.",
+            filepath);
+}
+
+void MocoTrajectoryBinaryWriter::writeHeader(
+        const MocoTrajectory& trajectory) {
+    m_names = getNames(trajectory);
+    m_stream.write(magic, sizeof(magic));
+    writeValue(m_stream, version);
+    writeValue(m_stream, byteOrderMark);
+    for (const auto& names : m_names) {
+        writeValue(m_stream, (std::uint32_t)names.size());
+        for (const auto& name : names) writeString(m_stream, name);
+    }
+}
+
+void MocoTrajectoryBinaryWriter::append(const MocoTrajectory& trajectory) {
+    if (m_numTrajectories == 0) {
+        writeHeader(trajectory);
+    } else {
+        OPENSIM_THROW_IF(getNames(trajectory) != m_names, Exception,
+                "Expected the trajectory to have the same variable names as "
+                "the trajectories already written to '{}'.",
+                m_filepath);
+    }
+
+    // The solver statistics have a variable size, so we serialize them
+    // first to compute the size of the record.
+    std::ostringstream stats;
+    const auto* solution = dynamic_cast<const MocoSolution*>(&trajectory);
+    writeValue(stats, (std::uint8_t)(solution ? 1 : 0));
+    if (solution) {
+        writeValue(stats, (std::uint8_t)(solution->success() ? 1 : 0));
+        writeString(stats, solution->getStatus());
+        writeValue(stats, solution->getObjective());
+        writeValue(stats, (std::int32_t)solution->getNumIterations());
+        writeValue(stats, solution->getSolverDuration());
+        const auto termNames = solution->getObjectiveTermNames();
+        writeValue(stats, (std::uint32_t)termNames.size());
+        for (int i = 0; i < (int)termNames.size(); ++i) {
+            writeString(stats, termNames[i]);
+            writeValue(stats, solution->getObjectiveTermByIndex(i));
+        }
+        writeVector(stats, solution->getNLPVariableMultipliers());
+        writeVector(stats, solution->getNLPConstraintMultipliers());
+    }
+    const std::string statsBytes = stats.str();
+
+    const SimTK::Matrix* continuous[] = {&trajectory.getStatesTrajectory(),
+            &trajectory.getControlsTrajectory(),
+            &trajectory.getMultipliersTrajectory(),
+            &trajectory.getDerivativesTrajectory(),
+            &trajectory.getSlacksTrajectory()};
+    int numContinuousVariables = 0;
+    for (const auto* matrix : continuous) {
+        numContinuousVariables += matrix->ncol();
+    }
+    const int numTimes = trajectory.getNumTimes();
+    const int numParameters = (int)m_names.back().size();
+    const std::uint64_t numDoubles =
+            (std::uint64_t)numTimes * (1 + numContinuousVariables) +
+            numParameters;
+    const std::uint64_t size = sizeof(std::int32_t) +
+                               sizeof(double) * numDoubles + statsBytes.size();
+
+    writeValue(m_stream, size);
+    writeValue(m_stream, (std::int32_t)numTimes);
+    std::vector<double> buffer(numTimes);
+    const auto& time = trajectory.getTime();
+    for (int itime = 0; itime < numTimes; ++itime) buffer[itime] = time[itime];
+    m_stream.write(reinterpret_cast<const char*>(buffer.data()),
+            sizeof(double) * numTimes);
+    for (const auto* matrix : continuous) {
+        for (int icol = 0; icol < matrix->ncol(); ++icol) {
+            for (int itime = 0; itime < numTimes; ++itime) {
+                buffer[itime] = (*matrix)(itime, icol);
+            }
+            m_stream.write(reinterpret_cast<const char*>(buffer.data()),
+                    sizeof(double) * numTimes);
+        }
+    }
+    const auto& parameters = trajectory.getParameters();
+    for (int iparam = 0; iparam < numParameters; ++iparam) {
+        writeValue(m_stream, parameters[iparam]);
+    }
+    m_stream.write(statsBytes.data(), statsBytes.size());
+
+    // Flush so that readers can access this trajectory right away.
+    m_stream.flush();
+    OPENSIM_THROW_IF(!m_stream, Exception, "Could not write to file '{}'.",
+            m_filepath);
+    ++m_numTrajectories;
+}
+
+void MocoTrajectoryBinaryWriter::write(
+        const MocoTrajectory& trajectory, const std::string& filepath) {
+    MocoTrajectoryBinaryWriter writer(filepath);
+    writer.append(trajectory);
+}
+
+MocoTrajectoryBinaryReader::MocoTrajectoryBinaryReader(
+        const std::string& filepath)
+        : m_filepath(filepath), m_stream(filepath, std::ios::binary) {
+    OPENSIM_THROW_IF(!m_stream, Exception, "Could not open file '{}'.",
+            filepath);
+    OPENSIM_THROW_IF(!isBinaryFile(filepath), Exception,
+            "File '{}' is not a binary trajectory file.", filepath);
+    m_stream.seekg(sizeof(magic));
+    const auto fileVersion = readValue<std::uint32_t>(m_stream);
+    OPENSIM_THROW_IF(fileVersion != version, Exception,
+            "File '{}' has version {}, but only version {} is supported.",
+            filepath, fileVersion, version);
+    OPENSIM_THROW_IF(readValue<std::uint32_t>(m_stream) != byteOrderMark,
+            Exception,
+            "File '{}' was written on a machine with a different byte order.",
+            filepath);
+
+    m_names.resize(numNameLists);
+    for (int ilist = 0; ilist < numNameLists; ++ilist) {
+        const auto numNames = readValue<std::uint32_t>(m_stream);
+        for (std::uint32_t iname = 0; iname < numNames; ++iname) {
+            m_names[ilist].push_back(readString(m_stream));
+        }
+    }
+    OPENSIM_THROW_IF(!m_stream, Exception,
+            "Could not read the header of file '{}'.", filepath);
+    for (int ilist = 0; ilist < numContinuousNameLists; ++ilist) {
+        for (const auto& name : m_names[ilist]) {
+            m_continuousIndices[name] = m_numContinuousVariables++;
+        }
+    }
+    for (int iparam = 0; iparam < (int)m_names.back().size(); ++iparam) {
+        m_parameterIndices[m_names.back()[iparam]] = iparam;
+    }
+    m_endOfRecords = m_stream.tellg();
+    refresh();
+}
+
+bool MocoTrajectoryBinaryReader::isBinaryFile(const std::string& filepath) {
+    std::ifstream stream(filepath, std::ios::binary);
+    char fileMagic[sizeof(magic)];
+    stream.read(fileMagic, sizeof(magic));
+    return stream && std::equal(magic, magic + sizeof(magic), fileMagic);
+}
+
+void MocoTrajectoryBinaryReader::refresh() {
+    m_stream.clear();
+    m_stream.seekg(0, std::ios::end);
+    const std::streamoff fileSize = m_stream.tellg();
+    const int numParameters = (int)m_names.back().size();
+    while (m_endOfRecords + (std::streamoff)sizeof(std::uint64_t) <=
+            fileSize) {
+        m_stream.seekg(m_endOfRecords);
+        const auto size = readValue<std::uint64_t>(m_stream);
+        Record record;
+        record.offset = m_endOfRecords + sizeof(std::uint64_t);
+        if (record.offset + (std::streamoff)size > fileSize) break;
+        record.numTimes = readValue<std::int32_t>(m_stream);
+        OPENSIM_THROW_IF(!m_stream || record.numTimes < 0, Exception,
+                "Could not read record {} of file '{}'.", m_records.size(),
+                m_filepath);
+        const std::streamoff numDoubles =
+                (std::streamoff)record.numTimes *
+                        (1 + m_numContinuousVariables) +
+                numParameters;
+        record.statsOffset = record.offset + sizeof(std::int32_t) +
+                             sizeof(double) * numDoubles;
+        m_records.push_back(record);
+        m_endOfRecords = record.offset + (std::streamoff)size;
+    }
+    m_stream.clear();
+}
+
+const std::vector<std::string>&
+MocoTrajectoryBinaryReader::getStateNames() const {
+    return m_names[0];
+}
+const std::vector<std::string>&
+MocoTrajectoryBinaryReader::getControlNames() const {
+    return m_names[1];
+}
+const std::vector<std::string>&
+MocoTrajectoryBinaryReader::getMultiplierNames() const {
+    return m_names[2];
+}
+const std::vector<std::string>&
+MocoTrajectoryBinaryReader::getDerivativeNames() const {
+    return m_names[3];
+}
+const std::vector<std::string>&
+MocoTrajectoryBinaryReader::getSlackNames() const {
+    return m_names[4];
+}
+const std::vector<std::string>&
+MocoTrajectoryBinaryReader::getParameterNames() const {
+    return m_names[5];
+}
+
+const MocoTrajectoryBinaryReader::Record& MocoTrajectoryBinaryReader::getRecord(
+        int index) const {
+    OPENSIM_THROW_IF(index < 0 || index >= getNumTrajectories(), Exception,
+            "Index {} is invalid; file '{}' contains {} trajectories.", index,
+            m_filepath, getNumTrajectories());
+    return m_records[index];
+}
+
+int MocoTrajectoryBinaryReader::getNumTimes(int index) const {
+    return getRecord(index).numTimes;
+}
+
+bool MocoTrajectoryBinaryReader::isSolution(int index) const {
+    const auto& record = getRecord(index);
+    m_stream.seekg(record.statsOffset);
+    const auto hasStats = readValue<std::uint8_t>(m_stream);
+    OPENSIM_THROW_IF(!m_stream, Exception, "Could not read from file '{}'.",
+            m_filepath);
+    return hasStats == 1;
+}
+
+void MocoTrajectoryBinaryReader::readData(
+        std::streamoff offset, double* data, int size) const {
+    if (!size) return;
+    m_stream.seekg(offset);
+    m_stream.read(reinterpret_cast<char*>(data), sizeof(double) * size);
+    OPENSIM_THROW_IF(!m_stream, Exception, "Could not read from file '{}'.",
+            m_filepath);
+}
+
+SimTK::Vector MocoTrajectoryBinaryReader::readTime(int index) const {
+    const auto& record = getRecord(index);
+    std::vector<double> buffer(record.numTimes);
+    readData(record.offset + sizeof(std::int32_t), buffer.data(),
+            record.numTimes);
+    return SimTK::Vector(record.numTimes, buffer.data());
+}
+
+SimTK::Vector MocoTrajectoryBinaryReader::readContinuousVariable(
+        const std::string& name, int index) const {
+    const auto it = m_continuousIndices.find(name);
+    OPENSIM_THROW_IF(it == m_continuousIndices.end(), Exception,
+            "File '{}' does not contain a continuous variable named '{}'.",
+            m_filepath, name);
+    const auto& record = getRecord(index);
+    std::vector<double> buffer(record.numTimes);
+    readData(record.offset + sizeof(std::int32_t) +
+                     sizeof(double) * (std::streamoff)record.numTimes *
+                             (1 + it->second),
+            buffer.data(), record.numTimes);
+    return SimTK::Vector(record.numTimes, buffer.data());
+}
+
+double MocoTrajectoryBinaryReader::readParameter(
+        const std::string& name, int index) const {
+    const auto it = m_parameterIndices.find(name);
+    OPENSIM_THROW_IF(it == m_parameterIndices.end(), Exception,
+            "File '{}' does not contain a parameter named '{}'.", m_filepath,
+            name);
+    const auto& record = getRecord(index);
+    // The parameters are stored just before the solver statistics.
+    const std::streamoff parametersOffset =
+            record.statsOffset -
+            (std::streamoff)(sizeof(double) * m_names.back().size());
+    double value;
+    readData(parametersOffset + sizeof(double) * it->second, &value, 1);
+    return value;
+}
+
+void MocoTrajectoryBinaryReader::readInto(
+        const Record& record, MocoTrajectory& trajectory) const {
+    const int numTimes = record.numTimes;
+    const int numParameters = (int)m_names.back().size();
+    // Read the time, continuous variables, and parameters at once.
+    std::vector<double> buffer(
+            numTimes * (1 + m_numContinuousVariables) + numParameters);
+    readData(record.offset + sizeof(std::int32_t), buffer.data(),
+            (int)buffer.size());
+
+    trajectory.m_state_names = getStateNames();
+    trajectory.m_control_names = getControlNames();
+    trajectory.m_multiplier_names = getMultiplierNames();
+    trajectory.m_derivative_names = getDerivativeNames();
+    trajectory.m_slack_names = getSlackNames();
+    trajectory.m_parameter_names = getParameterNames();
+    trajectory.m_time = SimTK::Vector(numTimes, buffer.data());
+    const double* data = buffer.data() + numTimes;
+    SimTK::Matrix* continuous[] = {&trajectory.m_states,
+            &trajectory.m_controls, &trajectory.m_multipliers,
+            &trajectory.m_derivatives, &trajectory.m_slacks};
+    for (int ilist = 0; ilist < numContinuousNameLists; ++ilist) {
+        auto& matrix = *continuous[ilist];
+        matrix.resize(numTimes, (int)m_names[ilist].size());
+        for (int icol = 0; icol < matrix.ncol(); ++icol) {
+            for (int itime = 0; itime < numTimes; ++itime) {
+                matrix(itime, icol) = *data++;
+            }
+        }
+    }
+    trajectory.m_parameters = SimTK::RowVector(numParameters, data);
+}
+
+MocoTrajectory MocoTrajectoryBinaryReader::readTrajectory(int index) const {
+    MocoTrajectory trajectory;
+    readInto(getRecord(index), trajectory);
+    return trajectory;
+}
+
+MocoSolution MocoTrajectoryBinaryReader::readSolution(int index) const {
+    OPENSIM_THROW_IF(!isSolution(index), Exception,
+            "Trajectory {} in file '{}' was not written from a MocoSolution.",
+            index, m_filepath);
+    const auto& record = getRecord(index);
+    MocoSolution solution;
+    readInto(record, solution);
+
+    m_stream.seekg(record.statsOffset + sizeof(std::uint8_t));
+    const bool success = readValue<std::uint8_t>(m_stream) == 1;
+    solution.setStatus(readString(m_stream));
+    solution.setObjective(readValue<double>(m_stream));
+    solution.setNumIterations(readValue<std::int32_t>(m_stream));
+    solution.setSolverDuration(readValue<double>(m_stream));
+    std::vector<std::pair<std::string, double>> breakdown(
+            readValue<std::uint32_t>(m_stream));
+    for (auto& term : breakdown) {
+        term.first = readString(m_stream);
+        term.second = readValue<double>(m_stream);
+    }
+    solution.setObjectiveBreakdown(std::move(breakdown));
+    SimTK::Vector variableMultipliers = readVector(m_stream);
+    SimTK::Vector constraintMultipliers = readVector(m_stream);
+    solution.setNLPMultipliers(
+            std::move(variableMultipliers), std::move(constraintMultipliers));
+    OPENSIM_THROW_IF(!m_stream, Exception,
+            "Could not read the solver statistics of trajectory {} in file "
+            "'{}'.",
+            index, m_filepath);
+    solution.setSuccess(success);
+    return solution;
+}
@@ -0,0 +1,154 @@
+#ifndef OPENSIM_MOCOTRAJECTORYBINARY_H
+#define OPENSIM_MOCOTRAJECTORYBINARY_H
+/* -------------------------------------------------------------------------- *
+ * OpenSim Moco: MocoTrajectoryBinary.h                                       *
+ * -------------------------------------------------------------------------- *
+ * Copyright (c) 2020 Stanford University and the Authors                     *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0          *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#include "MocoTrajectory.h"
+
+#include <fstream>
+#include <unordered_map>
+
+namespace OpenSim {
+
+/** @name Binary trajectory files
+A binary trajectory file (extension ".mocobin") holds a sequence of
+MocoTrajectory%s with the same variable names; for example, the intermediate
+iterates of a solver (see MocoCasADiSolver's `output_interval` and
+`output_file_format` properties). Writing and reading these files is much
+faster than writing and reading STO files, since the numbers are not
+converted to and from text.
+
+The file contains a header with the names of the variables, followed by one
+record per trajectory. Each record contains the times, the data for each
+continuous variable (stored contiguously, one variable after another), the
+parameters, and, for MocoSolution%s, the solver statistics (success, status,
+objective and its breakdown, number of iterations, solver duration, and the
+multipliers of the nonlinear program). Records are appended to the file
+without rewriting previous records, and a reader can load a single variable
+of a single record without reading the rest of the file.
+
+Numbers are stored in the byte order of the machine that wrote the file;
+reading a file written on a machine with a different byte order causes an
+exception. */
+/// @{
+
+/// Write trajectories to a binary trajectory file, one after another. The
+/// file is flushed after each trajectory, so that a MocoTrajectoryBinaryReader
+/// can read the trajectories written so far (e.g., to monitor a running
+/// optimization).
+class OSIMMOCO_API MocoTrajectoryBinaryWriter {
+public:
+    /// Create the file, overwriting an existing file with the same name.
+    explicit MocoTrajectoryBinaryWriter(const std::string& filepath);
+
+    /// Append a trajectory to the file. All trajectories in a file must have
+    /// the same variable names, but may have different numbers of times. If
+    /// the trajectory is a MocoSolution, the solver statistics are also
+    /// written; the solution must be unsealed.
+    void append(const MocoTrajectory& trajectory);
+
+    /// The number of trajectories appended so far.
+    int getNumTrajectories() const { return m_numTrajectories; }
+
+    /// Write a single trajectory to a new binary trajectory file.
+    static void write(
+            const MocoTrajectory& trajectory, const std::string& filepath);
+
+private:
+    void writeHeader(const MocoTrajectory& trajectory);
+    std::string m_filepath;
+    std::ofstream m_stream;
+    std::vector<std::vector<std::string>> m_names;
+    int m_numTrajectories = 0;
+};
+
+/// Read trajectories from a binary trajectory file. Upon construction, the
+/// reader reads only the header and the size of each record; data is read
+/// from the file when requested. Use readContinuousVariable() to read a
+/// single state, control, etc. without loading the entire trajectory.
+/// The reader keeps the file open, and is not thread-safe.
+class OSIMMOCO_API MocoTrajectoryBinaryReader {
+public:
+    explicit MocoTrajectoryBinaryReader(const std::string& filepath);
+
+    /// Does this file start with the header of a binary trajectory file?
+    /// This returns false if the file cannot be opened.
+    static bool isBinaryFile(const std::string& filepath);
+
+    /// Find records that were appended to the file after this reader was
+    /// created (or last refreshed). An incomplete record at the end of the
+    /// file (e.g., one that is still being written) is ignored.
+    void refresh();
+
+    /// The number of complete trajectories in the file.
+    int getNumTrajectories() const { return (int)m_records.size(); }
+
+    const std::vector<std::string>& getStateNames() const;
+    const std::vector<std::string>& getControlNames() const;
+    const std::vector<std::string>& getMultiplierNames() const;
+    const std::vector<std::string>& getDerivativeNames() const;
+    const std::vector<std::string>& getSlackNames() const;
+    const std::vector<std::string>& getParameterNames() const;
+
+    /// The number of times in the trajectory with the given index. The first
+    /// trajectory in the file has index 0.
+    int getNumTimes(int index) const;
+    /// Was the trajectory with the given index written from a MocoSolution?
+    bool isSolution(int index) const;
+
+    SimTK::Vector readTime(int index) const;
+    /// Read the data for a state, control, multiplier, derivative, or slack
+    /// from the trajectory with the given index.
+    SimTK::Vector readContinuousVariable(
+            const std::string& name, int index) const;
+    double readParameter(const std::string& name, int index) const;
+
+    /// Read the entire trajectory with the given index. If the trajectory
+    /// was written from a MocoSolution, the solver statistics are ignored.
+    MocoTrajectory readTrajectory(int index) const;
+    /// Read the entire trajectory with the given index, along with the
+    /// solver statistics. This throws an exception if the trajectory was not
+    /// written from a MocoSolution. As with solutions returned by
+    /// MocoStudy::solve(), the solution is sealed if the solver failed.
+    MocoSolution readSolution(int index) const;
+
+private:
+    struct Record {
+        // Offset of the number of times (just after the record's size).
+        std::streamoff offset;
+        int numTimes;
+        std::streamoff statsOffset;
+    };
+    const Record& getRecord(int index) const;
+    void readData(std::streamoff offset, double* data, int size) const;
+    void readInto(const Record& record, MocoTrajectory& trajectory) const;
+    std::string m_filepath;
+    mutable std::ifstream m_stream;
+    std::vector<std::vector<std::string>> m_names;
+    // The index of each state, control, multiplier, derivative, and slack
+    // among the continuous variables.
+    std::unordered_map<std::string, int> m_continuousIndices;
+    std::unordered_map<std::string, int> m_parameterIndices;
+    int m_numContinuousVariables = 0;
+    std::vector<Record> m_records;
+    std::streamoff m_endOfRecords = 0;
+};
+
+/// @}
+
+} // namespace OpenSim
+
+#endif // OPENSIM_MOCOTRAJECTORYBINARY_H
@@ -34,6 +34,7 @@ void MocoTropterSolver::constructProperties() {
     constructProperty_optim_jacobian_approximation("exact");
     constructProperty_optim_sparsity_detection("random");
     constructProperty_exact_hessian_block_sparsity_mode();
+    constructProperty_adolc_taping_mode("nlp");
 }
 
 bool MocoTropterSolver::isAvailable() {
@@ -124,6 +125,14 @@ MocoTropterSolver::createTropterSolver(
                 getProperty_exact_hessian_block_sparsity_mode(),
                 {"dense", "sparse"});
     }
+    checkPropertyValueIsInSet(
+            getProperty_adolc_taping_mode(), {"nlp", "mesh_point"});
+    OPENSIM_THROW_IF_FRMOBJ(get_adolc_taping_mode() == "mesh_point" &&
+                    get_transcription_scheme() != "trapezoidal",
+            Exception,
+            "The 'mesh_point' adolc_taping_mode requires the 'trapezoidal' "
+            "transcription_scheme, but it is set to '{}'.",
+            get_transcription_scheme());
     // Hessian information is not used in SNOPT.
     OPENSIM_THROW_IF(get_optim_hessian_approximation() == "exact" &&
                              get_optim_solver() == "snopt",
@@ -161,6 +170,7 @@ MocoTropterSolver::createTropterSolver(
         dircol->set_exact_hessian_block_sparsity_mode(
                 get_exact_hessian_block_sparsity_mode());
     }
+    dircol->set_adolc_taping_mode(get_adolc_taping_mode());
 
     // Get optimization solver to check the remaining property settings.
     auto& optsolver = dircol->get_opt_solver();
@@ -84,6 +84,14 @@ public:
             "property must be set. Note: this option only takes effect when "
             "using "
             "IPOPT.");
+    OpenSim_DECLARE_PROPERTY(adolc_taping_mode, std::string,
+            "How tropter records ADOL-C tapes when differentiating the "
+            "problem with automatic differentiation: 'nlp' to record the "
+            "entire NLP (default), or 'mesh_point' to record the dynamics and "
+            "path constraints at a single mesh point and evaluate that tape "
+            "at every mesh point. 'mesh_point' requires the 'trapezoidal' "
+            "transcription_scheme. OpenSim models are differentiated with "
+            "finite differences, which do not use tapes.");
 
     MocoTropterSolver();
 
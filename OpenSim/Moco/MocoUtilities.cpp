@@ -20,6 +20,7 @@
 
 #include "MocoProblem.h"
 #include "MocoTrajectory.h"
+#include <algorithm>
 #include <regex>
 
 #include <OpenSim/Actuators/CoordinateActuator.h>
@@ -274,6 +275,45 @@ int OpenSim::getMocoParallelEnvironmentVariable() {
     return -1;
 }
 
+void TabulatedFunctionSet::tabulate(
+        const FunctionSet& functions, const SimTK::Vector& times) {
+    for (int itime = 1; itime < times.size(); ++itime) {
+        OPENSIM_THROW_IF(times[itime] < times[itime - 1], Exception,
+                "Expected times to be nondecreasing, but time {} ({}) is "
+                "less than time {} ({}).",
+                itime, times[itime], itime - 1, times[itime - 1]);
+    }
+    m_numFunctions = functions.getSize();
+    m_times.resize(times.size());
+    m_values.resize(times.size() * m_numFunctions);
+    SimTK::Vector time(1);
+    for (int itime = 0; itime < times.size(); ++itime) {
+        m_times[itime] = times[itime];
+        time[0] = times[itime];
+        for (int ifunc = 0; ifunc < m_numFunctions; ++ifunc) {
+            m_values[itime * m_numFunctions + ifunc] =
+                    functions.get(ifunc).calcValue(time);
+        }
+    }
+}
+
+int OpenSim::findTimeIndex(const std::vector<double>& times, double time) {
+    if (times.empty()) return -1;
+    const auto tolerance = [](double t) {
+        return SimTK::SignificantReal * std::max(1.0, std::abs(t));
+    };
+    // Check the first time that is not less than `time` and the time just
+    // before it.
+    const auto it = std::lower_bound(times.begin(), times.end(), time);
+    if (it != times.end() && *it - time <= tolerance(*it)) {
+        return (int)(it - times.begin());
+    }
+    if (it != times.begin() && time - *(it - 1) <= tolerance(*(it - 1))) {
+        return (int)(it - times.begin()) - 1;
+    }
+    return -1;
+}
+
 TimeSeriesTable OpenSim::createExternalLoadsTableForGait(Model model,
         const StatesTrajectory& trajectory,
         const std::vector<std::string>& forcePathsRightFoot,
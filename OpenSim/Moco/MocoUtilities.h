@@ -218,6 +218,55 @@ private:
     const std::string m_filepath;
 };
 
+/// Get the index of the time in `times` (which must be sorted) that matches
+/// `time`, or -1 if there is no such time. Times match if they are equal
+/// within a tolerance of SimTK::SignificantReal (relative to the magnitude of
+/// the time), which allows for roundoff in how the caller computes times.
+/// @ingroup mocoutil
+OSIMMOCO_API int findTimeIndex(const std::vector<double>& times, double time);
+
+/// This class stores the values of the functions in a FunctionSet (e.g., the
+/// GCVSplineSet of reference data in a tracking goal) at a fixed set of times,
+/// such as the times of a collocation grid. The values for each time are
+/// stored contiguously. Use findTimeIndex() to determine if a time is one of
+/// the tabulated times; if it is not, evaluate the functions directly.
+/// @ingroup mocoutil
+class OSIMMOCO_API TabulatedFunctionSet {
+public:
+    /// Evaluate each function in the set at each of the given times, which
+    /// must be nondecreasing. This replaces any previously tabulated values.
+    void tabulate(const FunctionSet& functions, const SimTK::Vector& times);
+    /// Remove all tabulated values.
+    void clear() {
+        m_numFunctions = 0;
+        m_times.clear();
+        m_values.clear();
+    }
+    bool empty() const { return m_times.empty(); }
+    int getNumTimes() const { return (int)m_times.size(); }
+    int getNumFunctions() const { return m_numFunctions; }
+    /// Get the index of the tabulated time that matches the given time, or -1
+    /// if there is no such time. See OpenSim::findTimeIndex().
+    int findTimeIndex(double time) const {
+        return OpenSim::findTimeIndex(m_times, time);
+    }
+    /// Get the value of function `ifunc` at the tabulated time with index
+    /// `itime`.
+    double getValue(int itime, int ifunc) const {
+        return m_values[itime * m_numFunctions + ifunc];
+    }
+    /// Get the values of all functions at the tabulated time with index
+    /// `itime`. The returned pointer points to getNumFunctions() values.
+    const double* getValues(int itime) const {
+        return m_values.data() + itime * m_numFunctions;
+    }
+
+private:
+    int m_numFunctions = 0;
+    std::vector<double> m_times;
+    std::vector<double> m_values;
+};
+
 /// Obtain the ground reaction forces, centers of pressure, and torques
 /// resulting from Force elements (e.g., SmoothSphereHalfSpaceForce), using a
 /// model and states trajectory. Forces and torques are expressed in the ground
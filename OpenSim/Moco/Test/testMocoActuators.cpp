@@ -312,6 +312,55 @@ TEMPLATE_TEST_CASE(
     }
 }
 
+TEST_CASE("Hanging muscle with reused kinematics", "[casadi]") {
+    // When CasADi evaluates the dynamics at a point whose time and
+    // coordinates are unchanged (e.g., when finite differences perturb a
+    // speed, a fiber length, or a control), MocoCasADiSolver keeps the
+    // position-level quantities already realized in the State and realizes
+    // only the velocity and higher stages again. The solver never reuses
+    // the State in problems with parameters, so adding a parameter fixed at
+    // its current value must not change the solution. A compliant tendon
+    // makes the Velocity-stage muscle quantities depend on the fiber length
+    // (an auxiliary state), which the reused State must not keep.
+    auto isTendonDynamicsExplicit = GENERATE(true, false);
+    CAPTURE(isTendonDynamicsExplicit);
+
+    Model model = createHangingMuscleModel(
+            0.1, 0.05, false, false, isTendonDynamicsExplicit);
+    auto solve = [&](bool withParameter) {
+        MocoStudy study;
+        MocoProblem& problem = study.updProblem();
+        problem.setModelAsCopy(model);
+        problem.setTimeBounds(0, 0.5);
+        problem.setStateInfo("/joint/height/value", {0.14, 0.17}, 0.165, 0.155);
+        problem.setStateInfo("/joint/height/speed", {-10, 10}, 0, 0);
+        problem.setControlInfo("/forceset/muscle", {0.02, 1});
+        problem.addGoal<MocoInitialForceEquilibriumDGFGoal>();
+        problem.addGoal<MocoControlGoal>("effort");
+        if (withParameter) {
+            problem.addParameter("max_isometric_force", "/forceset/muscle",
+                    "max_isometric_force", MocoBounds(100.0));
+        }
+        auto& solver = study.initSolver<MocoCasADiSolver>();
+        solver.set_num_mesh_intervals(15);
+        solver.set_optim_convergence_tolerance(1e-6);
+        solver.set_optim_constraint_tolerance(1e-6);
+        solver.set_minimize_implicit_auxiliary_derivatives(true);
+        solver.set_parameters_require_initsystem(false);
+        // Evaluate every point with the same State, so that each evaluation
+        // follows the previous one at the same time and coordinates.
+        solver.set_parallel(0);
+        return study.solve();
+    };
+    const MocoSolution reused = solve(false);
+    const MocoSolution fresh = solve(true);
+    REQUIRE(reused.success());
+    REQUIRE(fresh.success());
+    CHECK(reused.getObjective() ==
+            Approx(fresh.getObjective()).epsilon(1e-6));
+    CHECK(reused.compareContinuousVariablesRMS(fresh) < 1e-5);
+}
+
 TEST_CASE("ActivationCoordinateActuator") {
     // Create a problem with ACA and ensure the activation bounds are
     // set as expected.
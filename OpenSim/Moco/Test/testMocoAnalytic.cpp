@@ -54,10 +54,8 @@ SimTK::Matrix expectedSolution(const SimTK::Vector& time) {
     return expectedStatesTrajectory;
 }
 
-TEMPLATE_TEST_CASE("Second order linear min effort", "",
-        MocoCasADiSolver, MocoTropterSolver) {
-    // Kirk 1998, Example 5.1-1, page 198.
-
+// Kirk 1998, Example 5.1-1, page 198.
+MocoStudy createSecondOrderLinearMinEffortStudy() {
     Model model;
     auto* body = new Body("b", 1, SimTK::Vec3(0), SimTK::Inertia(0));
     model.addBody(body);
@@ -84,7 +82,12 @@ TEMPLATE_TEST_CASE("Second order linear min effort", "",
     problem.setControlInfo("/forceset/coordinateactuator", {-50, 50});
 
     problem.addGoal<MocoControlGoal>("effort", 0.5);
+    return moco;
+}
 
+TEMPLATE_TEST_CASE("Second order linear min effort", "",
+        MocoCasADiSolver, MocoTropterSolver) {
+    MocoStudy moco = createSecondOrderLinearMinEffortStudy();
     auto& solver = moco.initSolver<TestType>();
     solver.set_num_mesh_intervals(50);
     MocoSolution solution = moco.solve();
@@ -94,6 +97,40 @@ TEMPLATE_TEST_CASE("Second order linear min effort", "",
     OpenSim_CHECK_MATRIX_ABSTOL(solution.getStatesTrajectory(), expected, 1e-5);
 }
 
+TEST_CASE("Second order linear min effort, Legendre-Gauss-Radau",
+        "[casadi]") {
+    // With Legendre-Gauss-Radau transcription of degree 3 or higher, far
+    // fewer mesh intervals are necessary to achieve the accuracy of the test
+    // above. Degree 1 is backward Euler, which is only first-order accurate.
+    auto degree = GENERATE(1, 3, 5);
+    const int numMeshIntervals = degree == 1 ? 100 : 10;
+    const double stateTol = degree == 1 ? 0.1 : 1e-5;
+    const double objectiveTol = degree == 1 ? 0.02 : 1e-4;
+
+    MocoStudy reference = createSecondOrderLinearMinEffortStudy();
+    auto& referenceSolver = reference.initCasADiSolver();
+    referenceSolver.set_transcription_scheme("hermite-simpson");
+    referenceSolver.set_num_mesh_intervals(50);
+    MocoSolution referenceSolution = reference.solve();
+
+    MocoStudy moco = createSecondOrderLinearMinEffortStudy();
+    auto& solver = moco.initCasADiSolver();
+    solver.set_transcription_scheme(
+            "legendre-gauss-radau-" + std::to_string(degree));
+    solver.set_num_mesh_intervals(numMeshIntervals);
+    MocoSolution solution = moco.solve();
+    CHECK(solution.getNumTimes() == numMeshIntervals * degree + 1);
+
+    const auto expected = expectedSolution(solution.getTime());
+
+    OpenSim_CHECK_MATRIX_ABSTOL(
+            solution.getStatesTrajectory(), expected, stateTol);
+
+    // The quadrature weights must integrate the goal correctly.
+    CHECK(solution.getObjective() ==
+            Approx(referenceSolution.getObjective()).epsilon(objectiveTol));
+}
+
 /// In the "linear tangent steering" problem, we control the direction to apply
 /// a constant thrust to a point mass to move the mass a given vertical distance
 /// and maximize its final horizontal speed. This problem is described in
@@ -361,6 +361,21 @@ SimTK::Real testSmoothSphereHalfSpaceForce_NormalForce()
         CHECK(contactForces[4] == Approx(0.0).margin(1e-4)); // no torque
         CHECK(contactForces[5] == Approx(0.0).margin(1e-4)); // no torque
 
+        // The allocation-free interface reports the same forces.
+        SmoothSphereHalfSpaceForce::ForceWorkspace workspace;
+        SimTK::SpatialVec forceOnSphere;
+        SimTK::SpatialVec forceOnHalfSpace;
+        for (int repeat = 0; repeat < 2; ++repeat) {
+            contactBallHalfSpace.calcContactForces(
+                    state, workspace, forceOnSphere, forceOnHalfSpace);
+            for (int i = 0; i < 3; ++i) {
+                CHECK(forceOnSphere[1][i] == contactForces[i]);
+                CHECK(forceOnSphere[0][i] == contactForces[3 + i]);
+                CHECK(forceOnHalfSpace[1][i] == contactForces[6 + i]);
+                CHECK(forceOnHalfSpace[0][i] == contactForces[9 + i]);
+            }
+        }
+
         finalHeightTimeStepping = model.getStateVariableValue(state,
             "groundBall/groundBall_coord_2/value");
     }
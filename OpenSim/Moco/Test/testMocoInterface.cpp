@@ -29,6 +29,9 @@
 #include <OpenSim/Simulation/SimbodyEngine/PinJoint.h>
 #include <OpenSim/Simulation/SimbodyEngine/SliderJoint.h>
 #include <OpenSim/Simulation/SimbodyEngine/ScapulothoracicJoint.h>
+#ifdef OPENSIM_WITH_CASADI
+#include <casadi/casadi.hpp>
+#endif
 
 using namespace OpenSim;
 
@@ -258,6 +261,23 @@ TEMPLATE_TEST_CASE("Solver options", "", MocoCasADiSolver,
     }
 }
 
+TEST_CASE("MocoTropterSolver adolc_taping_mode", "[tropter]") {
+    MocoStudy study = createSlidingMassMocoStudy<MocoTropterSolver>();
+    auto& ms = study.updSolver<MocoTropterSolver>();
+    CHECK(ms.get_adolc_taping_mode() == "nlp");
+    ms.set_adolc_taping_mode("nonexistent");
+    CHECK_THROWS_WITH(study.solve(), Catch::Contains("adolc_taping_mode"));
+
+    ms.set_adolc_taping_mode("mesh_point");
+    ms.set_transcription_scheme("hermite-simpson");
+    CHECK_THROWS_WITH(study.solve(),
+            Catch::Contains("requires the 'trapezoidal'"));
+
+    ms.set_transcription_scheme("trapezoidal");
+    MocoSolution solution = study.solve();
+    CHECK(solution.success());
+}
+
 TEMPLATE_TEST_CASE("Ordering of calls", "", MocoCasADiSolver, 
         MocoTropterSolver) {
 
@@ -1606,6 +1626,121 @@ TEST_CASE("MocoTrajectory randomize") {
     }
 }
 
+TEST_CASE("MocoTrajectoryBinary") {
+    const std::string fname = "testMocoInterface_MocoTrajectoryBinary.mocobin";
+    SimTK::Vector time(3);
+    time[0] = 0;
+    time[1] = 0.1;
+    time[2] = 0.25;
+    MocoTrajectory first(time, {"a", "b"}, {"g", "h", "i", "j"}, {"m"}, {"d"},
+            {"o", "p"}, SimTK::Test::randMatrix(3, 2),
+            SimTK::Test::randMatrix(3, 4), SimTK::Test::randMatrix(3, 1),
+            SimTK::Test::randMatrix(3, 1),
+            SimTK::Test::randVector(2).transpose());
+    first.appendSlack("s", SimTK::Test::randVector(3));
+    // Trajectories in the same file can have different numbers of times.
+    MocoTrajectory second = first;
+    second.randomizeReplace(SimTK::Random::Uniform(-1, 1));
+    second.resampleWithNumTimes(5);
+
+    {
+        MocoTrajectoryBinaryWriter writer(fname);
+        writer.append(first);
+        writer.append(second);
+        CHECK(writer.getNumTrajectories() == 2);
+        // All trajectories must have the same variables.
+        MocoTrajectory other(time, {"a"}, {}, {}, {},
+                SimTK::Test::randMatrix(3, 1), SimTK::Matrix(3, 0),
+                SimTK::Matrix(3, 0), SimTK::RowVector());
+        CHECK_THROWS(writer.append(other));
+    }
+
+    CHECK(MocoTrajectoryBinaryReader::isBinaryFile(fname));
+    MocoTrajectoryBinaryReader reader(fname);
+    REQUIRE(reader.getNumTrajectories() == 2);
+    CHECK(reader.getStateNames() == first.getStateNames());
+    CHECK(reader.getControlNames() == first.getControlNames());
+    CHECK(reader.getDerivativeNames() == first.getDerivativeNames());
+    CHECK(reader.getSlackNames() == first.getSlackNames());
+    CHECK(reader.getParameterNames() == first.getParameterNames());
+    CHECK(reader.getNumTimes(0) == 3);
+    CHECK(reader.getNumTimes(1) == 5);
+    CHECK_FALSE(reader.isSolution(0));
+    CHECK(reader.readTrajectory(0).isNumericallyEqual(first));
+    CHECK(reader.readTrajectory(1).isNumericallyEqual(second));
+    CHECK_THROWS(reader.readTrajectory(2));
+    CHECK_THROWS(reader.readSolution(0));
+
+    // Read individual variables.
+    SimTK_TEST_EQ(reader.readTime(1), second.getTime());
+    SimTK_TEST_EQ(reader.readContinuousVariable("h", 1),
+            SimTK::Vector(second.getControl("h")));
+    SimTK_TEST_EQ(reader.readContinuousVariable("s", 0),
+            SimTK::Vector(first.getSlack("s")));
+    CHECK(reader.readParameter("p", 1) == second.getParameter("p"));
+    CHECK_THROWS(reader.readContinuousVariable("x", 0));
+    CHECK_THROWS(reader.readParameter("a", 0));
+
+    // The MocoTrajectory constructor reads the last trajectory in the file.
+    MocoTrajectory deserialized(fname);
+    CHECK(deserialized.isNumericallyEqual(second));
+
+    // A reader finds trajectories appended after it was created.
+    {
+        MocoTrajectoryBinaryWriter writer(fname);
+        writer.append(first);
+        MocoTrajectoryBinaryReader streamReader(fname);
+        CHECK(streamReader.getNumTrajectories() == 1);
+        writer.append(second);
+        streamReader.refresh();
+        REQUIRE(streamReader.getNumTrajectories() == 2);
+        CHECK(streamReader.readTrajectory(1).isNumericallyEqual(second));
+    }
+
+    CHECK_FALSE(MocoTrajectoryBinaryReader::isBinaryFile("nonexistent.sto"));
+}
+
+TEST_CASE("MocoTrajectoryBinary with MocoSolution", "[casadi]") {
+    const std::string fname =
+            "testMocoInterface_MocoTrajectoryBinarySolution.mocobin";
+    MocoStudy study = createSlidingMassMocoStudy<MocoCasADiSolver>();
+    auto& solver = study.updSolver<MocoCasADiSolver>();
+    solver.set_output_interval(5);
+    solver.set_output_file_format("binary");
+    MocoSolution solution = study.solve();
+
+    MocoTrajectoryBinaryWriter::write(solution, fname);
+    MocoTrajectoryBinaryReader reader(fname);
+    REQUIRE(reader.isSolution(0));
+    MocoSolution deserialized = reader.readSolution(0);
+    CHECK(deserialized.success());
+    CHECK(deserialized.isNumericallyEqual(solution));
+    CHECK(deserialized.getStatus() == solution.getStatus());
+    CHECK(deserialized.getObjective() == solution.getObjective());
+    CHECK(deserialized.getNumIterations() == solution.getNumIterations());
+    CHECK(deserialized.getSolverDuration() == solution.getSolverDuration());
+    CHECK(deserialized.getObjectiveTermNames() ==
+            solution.getObjectiveTermNames());
+    SimTK_TEST_EQ(deserialized.getNLPVariableMultipliers(),
+            solution.getNLPVariableMultipliers());
+    SimTK_TEST_EQ(deserialized.getNLPConstraintMultipliers(),
+            solution.getNLPConstraintMultipliers());
+
+    // A failed solution is sealed when read.
+    solver.set_output_interval(0);
+    solver.set_optim_max_iterations(1);
+    MocoSolution failed = study.solve();
+    failed.unseal();
+    MocoTrajectoryBinaryWriter::write(failed, fname);
+    MocoSolution failedDeserialized =
+            MocoTrajectoryBinaryReader(fname).readSolution(0);
+    CHECK_FALSE(failedDeserialized.success());
+    CHECK(failedDeserialized.isSealed());
+
+    solver.set_output_file_format("csv");
+    CHECK_THROWS(study.solve());
+}
+
 TEST_CASE("createPeriodicTrajectory") {
     const std::string hip_r = "hip_r/hip_flexion_r/value";
     const std::string hip_l = "hip_l/hip_flexion_l/value";
@@ -1990,6 +2125,47 @@ TEST_CASE("solveBisection()") {
     }
 }
 
+TEST_CASE("TabulatedFunctionSet") {
+    TimeSeriesTable table;
+    table.setColumnLabels({"a", "b"});
+    for (int i = 0; i < 10; ++i) {
+        const double t = 0.1 * i;
+        table.appendRow(t, {std::sin(t), std::cos(t)});
+    }
+    GCVSplineSet splines(table);
+
+    const SimTK::Vector times = createVectorLinspace(7, 0.05, 0.85);
+    TabulatedFunctionSet tabulated;
+    CHECK(tabulated.empty());
+    tabulated.tabulate(splines, times);
+    CHECK(tabulated.getNumTimes() == 7);
+    CHECK(tabulated.getNumFunctions() == 2);
+    for (int itime = 0; itime < times.size(); ++itime) {
+        // Allow for roundoff in the requested time.
+        const int index = tabulated.findTimeIndex(times[itime] + 1e-15);
+        REQUIRE(index == itime);
+        for (int ifunc = 0; ifunc < 2; ++ifunc) {
+            CHECK(tabulated.getValue(index, ifunc) ==
+                    splines[ifunc].calcValue(
+                            SimTK::Vector(1, times[itime])));
+            CHECK(tabulated.getValues(index)[ifunc] ==
+                    tabulated.getValue(index, ifunc));
+        }
+    }
+    CHECK(tabulated.findTimeIndex(0.0) == -1);
+    CHECK(tabulated.findTimeIndex(0.1) == -1);
+    CHECK(tabulated.findTimeIndex(1.0) == -1);
+
+    SimTK::Vector decreasing(2);
+    decreasing[0] = 0.5;
+    decreasing[1] = 0.4;
+    CHECK_THROWS_AS(tabulated.tabulate(splines, decreasing), Exception);
+
+    tabulated.clear();
+    CHECK(tabulated.empty());
+    CHECK(tabulated.findTimeIndex(0.05) == -1);
+}
+
 TEST_CASE("Objective breakdown", "[casadi]") {
     class MocoConstantGoal : public MocoGoal {
         OpenSim_DECLARE_CONCRETE_OBJECT(MocoConstantGoal, MocoGoal);
@@ -2023,6 +2199,258 @@ TEST_CASE("Objective breakdown", "[casadi]") {
     CHECK(solution.getObjectiveTerm("goal_b") == Approx(0.01 * 7.3));
 }
 
+TEST_CASE("MocoSolutionCache", "[casadi]") {
+    auto createStudy = [](double finalPosition) {
+        MocoStudy study = createSlidingMassMocoStudy<MocoCasADiSolver>();
+        study.updProblem().setStateInfo("/slider/position/value",
+                MocoBounds(0, 1), MocoInitialBounds(0),
+                MocoFinalBounds(finalPosition));
+        return study;
+    };
+
+    MocoStudy coldStudy = createStudy(0.9);
+    MocoSolution cold = coldStudy.solve();
+    CHECK(cold.getNLPVariableMultipliers().size() > 0);
+    CHECK(cold.getNLPConstraintMultipliers().size() > 0);
+
+    MocoSolutionCache cache;
+    MocoStudy study = createStudy(1.0);
+    const auto key = MocoSolutionCache::createKey(study);
+    CHECK(MocoSolutionCache::createKey(coldStudy) == key);
+    CHECK(cache.findNearest(key, SimTK::Vector(1, 1.0)) == nullptr);
+    MocoSolution solution = cache.solve(study, SimTK::Vector(1, 1.0));
+    MocoStudy farStudy = createStudy(0.5);
+    cache.solve(farStudy, SimTK::Vector(1, 0.5));
+    CHECK(cache.getNumSolutions() == 2);
+    const MocoSolution* nearest =
+            cache.findNearest(key, SimTK::Vector(1, 0.9));
+    REQUIRE(nearest);
+    CHECK(nearest->getFinalTime() == Approx(solution.getFinalTime()));
+
+    // Warm-starting from the nearest solution converges to the same solution
+    // as a cold start.
+    MocoStudy warmStudy = createStudy(0.9);
+    MocoSolution warm = cache.solve(warmStudy, SimTK::Vector(1, 0.9));
+    CHECK(cache.getNumSolutions() == 3);
+    CHECK(warm.getFinalTime() == Approx(cold.getFinalTime()).epsilon(1e-4));
+
+    // A problem with a different structure does not use the cached
+    // solutions.
+    MocoStudy otherStudy = createStudy(0.9);
+    otherStudy.updSolver<MocoCasADiSolver>().set_num_mesh_intervals(10);
+    CHECK(MocoSolutionCache::createKey(otherStudy) != key);
+
+    cache.clear();
+    CHECK(cache.getNumSolutions() == 0);
+}
+
+TEST_CASE("MocoStudyBatch", "[casadi]") {
+    MocoStudy study = createSlidingMassMocoStudy<MocoCasADiSolver>();
+    std::vector<std::function<void(MocoStudy&)>> overrides;
+    // Use more studies than threads so that threads wait for the CasADi mutex
+    // while other studies are solved.
+    const std::vector<double> finalPositions{
+            0.5, 0.6, 0.7, 0.75, 0.8, 0.9, 0.95, 1.0};
+    for (const auto& finalPosition : finalPositions) {
+        overrides.push_back([finalPosition](MocoStudy& s) {
+            s.updProblem().setStateInfo("/slider/position/value",
+                    MocoBounds(0, 1), MocoInitialBounds(0),
+                    MocoFinalBounds(finalPosition));
+        });
+    }
+
+    MocoStudyBatch batch;
+    batch.addStudies(study, overrides);
+    CHECK(batch.getNumStudies() == 8);
+    CHECK(batch.getNumThreadsPerStudy() >= 1);
+    CHECK(batch.getNumParallelStudies() == 1);
+    CHECK_THROWS(batch.setNumThreadsPerStudy(0));
+    batch.setNumThreadsPerStudy(1);
+    batch.setNumParallelStudies(4);
+    const Logger::Level origLoggerLevel = Logger::getLevel();
+    std::vector<MocoSolution> solutions = batch.solve();
+    REQUIRE(solutions.size() == 8);
+    CHECK(Logger::getLevel() == origLoggerLevel);
+    batch.printSummary();
+
+    // The studies are solved in several threads, but the solutions are the
+    // same as solving each study on its own.
+    for (int i = 0; i < batch.getNumStudies(); ++i) {
+        MocoSolution expected = batch.getStudy(i).solve();
+        CHECK(solutions[i].success());
+        CHECK(solutions[i].getFinalTime() ==
+                Approx(expected.getFinalTime()).epsilon(1e-6));
+        CHECK(batch.getSolution(i).getFinalTime() ==
+                Approx(solutions[i].getFinalTime()));
+    }
+    // The minimum time to travel a distance d with bounded force is
+    // proportional to sqrt(d).
+    CHECK(solutions[0].getFinalTime() < solutions[7].getFinalTime());
+    for (int i = 0; i < batch.getNumStudies(); ++i) {
+        CHECK(solutions[i].getFinalTime() ==
+                Approx(solutions[7].getFinalTime() *
+                        std::sqrt(finalPositions[i])).epsilon(1e-3));
+    }
+
+    // Exceptions from one study do not prevent solving the others.
+    const int index = batch.addStudy(study);
+    batch.updStudy(index).updProblem().setStateInfo("/nonexistent", {0, 1});
+    CHECK_THROWS(batch.solve());
+    CHECK(batch.getSolution(0).success());
+    CHECK_THROWS(batch.getSolution(index));
+}
+
+/// Read the sparsity pattern written by optim_write_sparsity (in Matrix Market
+/// coordinate format) and return the largest distance between the first and
+/// last nonzero column of a row. Columns with nonzeros in more than half of
+/// the rows (e.g., the time variables) are ignored, since a banded solver
+/// would treat them as a dense border.
+int calcMaxRowSpanOfSparsity(const std::string& filename) {
+    std::ifstream file(filename);
+    REQUIRE(file.good());
+    std::string line;
+    do { std::getline(file, line); } while (line[0] == '%');
+    int numRows, numCols, numNonzeros;
+    std::istringstream(line) >> numRows >> numCols >> numNonzeros;
+    std::vector<std::pair<int, int>> nonzeros(numNonzeros);
+    std::vector<int> numNonzerosInCol(numCols + 1, 0);
+    for (auto& nonzero : nonzeros) {
+        file >> nonzero.first >> nonzero.second;
+        ++numNonzerosInCol[nonzero.second];
+    }
+    std::vector<int> minCol(numRows + 1, numCols + 1);
+    std::vector<int> maxCol(numRows + 1, 0);
+    for (const auto& nonzero : nonzeros) {
+        if (2 * numNonzerosInCol[nonzero.second] > numRows) continue;
+        minCol[nonzero.first] = std::min(minCol[nonzero.first], nonzero.second);
+        maxCol[nonzero.first] = std::max(maxCol[nonzero.first], nonzero.second);
+    }
+    int maxSpan = 0;
+    for (int irow = 1; irow <= numRows; ++irow) {
+        maxSpan = std::max(maxSpan, maxCol[irow] - minCol[irow]);
+    }
+    return maxSpan;
+}
+
+TEST_CASE("optim_variable_ordering", "[casadi]") {
+    auto transcriptionScheme =
+            GENERATE(as<std::string>{}, "trapezoidal", "hermite-simpson");
+    auto dynamicsMode = GENERATE(as<std::string>{}, "explicit", "implicit");
+    MocoStudy study = createSlidingMassMocoStudy<MocoCasADiSolver>();
+    auto& solver = study.updSolver<MocoCasADiSolver>();
+    solver.set_transcription_scheme(transcriptionScheme);
+    solver.set_multibody_dynamics_mode(dynamicsMode);
+    MocoSolution byType = study.solve();
+
+    solver.set_optim_variable_ordering("by-grid-point");
+    MocoSolution byGridPoint = study.solve();
+    CHECK(byGridPoint.success());
+    CHECK(byGridPoint.getFinalTime() ==
+            Approx(byType.getFinalTime()).epsilon(1e-6));
+    CHECK(byGridPoint.compareContinuousVariablesRMS(byType) < 1e-4);
+
+    // The NLP multipliers are stored in the same ("by-type") order with
+    // either setting, so a solution can warm-start a solve with the other
+    // setting.
+    const SimTK::Vector& lamByType = byType.getNLPVariableMultipliers();
+    const SimTK::Vector& lamByGridPoint =
+            byGridPoint.getNLPVariableMultipliers();
+    REQUIRE(lamByGridPoint.size() == lamByType.size());
+    CHECK((lamByGridPoint - lamByType).normInf() <
+            1e-2 * std::max(1.0, lamByType.normInf()));
+    solver.setWarmStart(byType);
+    MocoSolution warm = study.solve();
+    CHECK(warm.success());
+    CHECK(warm.getNumIterations() <= byGridPoint.getNumIterations());
+    CHECK(warm.getFinalTime() == Approx(byType.getFinalTime()).epsilon(1e-6));
+    solver.clearGuess();
+
+    solver.set_optim_variable_ordering("by-time");
+    CHECK_THROWS(study.solve());
+
+    // Ordering the variables by grid point makes the constraint Jacobian
+    // banded: each constraint involves only variables at neighboring grid
+    // points, so its nonzeros span a few grid points' worth of columns
+    // instead of most of the variable vector.
+    const std::string prefix = "testMocoInterface_optim_variable_ordering";
+    const std::string jacobianFile =
+            prefix + "constraint_Jacobian_sparsity.mtx";
+    solver.set_optim_write_sparsity(prefix);
+    solver.set_optim_max_iterations(1);
+    solver.set_optim_variable_ordering("by-type");
+    study.solve();
+    const int spanByType = calcMaxRowSpanOfSparsity(jacobianFile);
+    solver.set_optim_variable_ordering("by-grid-point");
+    study.solve();
+    const int spanByGridPoint = calcMaxRowSpanOfSparsity(jacobianFile);
+    CAPTURE(spanByType, spanByGridPoint);
+    // There are at most 4 variables per grid point, and each constraint
+    // involves at most 3 neighboring grid points (with Hermite-Simpson).
+    // With "by-type", a defect constraint involves the position and speed
+    // at the same grid point, which are at least 20 columns apart.
+    CHECK(spanByGridPoint < 3 * 4);
+    CHECK(spanByType > 20);
+}
+
+TEST_CASE("multibody_system_function_file", "[casadi]") {
+    MocoStudy study = createSlidingMassMocoStudy<MocoCasADiSolver>();
+    auto& solver = study.updSolver<MocoCasADiSolver>();
+    solver.set_multibody_system_function_file(
+            "testMocoInterface_nonexistent_multibody_system.so");
+    CHECK_THROWS_WITH(study.solve(),
+            Catch::Contains("Could not find multibody system function file"));
+}
+
+#ifdef OPENSIM_WITH_CASADI
+TEST_CASE("multibody_system_function_file with a sliding mass", "[casadi]") {
+    // The acceleration of the sliding mass is the actuator's force (optimal
+    // force of 1 times the control) divided by the mass of 10 kg.
+    using casadi::MX;
+    const MX time = MX::sym("time");
+    const MX states = MX::sym("states", 2, 1);
+    const MX controls = MX::sym("controls", 1, 1);
+    const MX multipliers = MX::sym("multipliers", 0, 1);
+    const MX derivatives = MX::sym("derivatives", 0, 1);
+    const MX parameters = MX::sym("parameters", 0, 1);
+    casadi::Function func("multibody_system",
+            {time, states, controls, multipliers, derivatives, parameters},
+            {controls / 10.0, MX(0, 1), MX(0, 1), MX(0, 1)});
+    const std::string functionFile = "testMocoInterface_sliding_mass.casadi";
+    func.save(functionFile);
+
+    MocoStudy study = createSlidingMassMocoStudy<MocoCasADiSolver>();
+    auto& solver = study.updSolver<MocoCasADiSolver>();
+    const MocoSolution expected = study.solve();
+    REQUIRE(expected.success());
+
+    solver.set_multibody_system_function_file(functionFile);
+    const MocoSolution solution = study.solve();
+    REQUIRE(solution.success());
+    CHECK(solution.getFinalTime() ==
+            Approx(expected.getFinalTime()).epsilon(1e-4));
+    CHECK(solution.compareContinuousVariablesRMS(expected) < 1e-3);
+
+    // A function that does not match the model is rejected before solving.
+    // The acceleration is correct at zero control (the initial guess), so
+    // the random point detects the mismatch.
+    casadi::Function wrongMass("multibody_system",
+            {time, states, controls, multipliers, derivatives, parameters},
+            {controls / 5.0, MX(0, 1), MX(0, 1), MX(0, 1)});
+    wrongMass.save(functionFile);
+    CHECK_THROWS_WITH(study.solve(), Catch::Contains("does not match the "
+                                                     "model"));
+
+    // A function whose sizes do not match the problem is rejected.
+    casadi::Function wrongSize("multibody_system",
+            {time, MX::sym("states", 3, 1), controls, multipliers,
+                    derivatives, parameters},
+            {controls / 10.0, MX(0, 1), MX(0, 1), MX(0, 1)});
+    wrongSize.save(functionFile);
+    CHECK_THROWS_WITH(study.solve(),
+            Catch::Contains("to be a column vector with 2 elements"));
+}
+#endif
+
 TEST_CASE("Solver isAvailable()") {
 #ifdef OPENSIM_WITH_CASADI
     CHECK(MocoCasADiSolver::isAvailable());
@@ -19,6 +19,7 @@
 #include <OpenSim/Actuators/ModelFactory.h>
 #include <OpenSim/Actuators/ModelOperators.h>
 #include <OpenSim/Moco/osimMoco.h>
+#include <OpenSim/Simulation/Model/PathSpring.h>
 
 #define CATCH_CONFIG_MAIN
 #include "Testing.h"
@@ -118,6 +119,57 @@ TEST_CASE("PrescribedKinematics direct collocation auxiliary dynamics",
             0.2 * SimTK::exp(solution.getTime()), 1e-4);
 }
 
+TEST_CASE("PrescribedKinematics states on grid") {
+    Model model = ModelFactory::createPendulum();
+    auto* spring = new PathSpring("spring", 0.5, 10.0, 0.0);
+    spring->updGeometryPath().appendNewPathPoint(
+            "origin", model.getGround(), SimTK::Vec3(0, 1, 0));
+    spring->updGeometryPath().appendNewPathPoint(
+            "insertion", model.getBodySet().get("b0"), SimTK::Vec3(0));
+    model.addForce(spring);
+    auto* motion = new PositionMotion();
+    motion->setPositionForCoordinate(
+            model.getCoordinateSet().get(0), LinearFunction(1.3, 0.17));
+    model.addModelComponent(motion);
+    model.finalizeConnections();
+
+    MocoProblem problem;
+    problem.setModelAsCopy(model);
+    problem.setTimeBounds(0, 1);
+    MocoProblemRep rep = problem.createRep();
+    REQUIRE(rep.isPrescribedKinematics());
+
+    const SimTK::Vector times = createVectorLinspace(5, 0, 1);
+    rep.initializePrescribedKinematicsOnGrid(times);
+    CHECK(rep.findPrescribedKinematicsStateOnGrid(0.1) == nullptr);
+
+    const auto& modelDisCon = rep.getModelDisabledConstraints();
+    const auto& path = modelDisCon.getComponent<PathSpring>("/forceset/spring")
+                               .getGeometryPath();
+    for (int itime = 0; itime < times.size(); ++itime) {
+        const SimTK::State* state =
+                rep.findPrescribedKinematicsStateOnGrid(times[itime]);
+        REQUIRE(state);
+        CHECK(state->getTime() == times[itime]);
+        CHECK(state->getSystemStage() >= SimTK::Stage::Position);
+        CHECK(path.isCacheVariableValid(*state, "length"));
+
+        SimTK::State expected = rep.updStateDisabledConstraints();
+        expected.setTime(times[itime]);
+        modelDisCon.getSystem().prescribe(expected);
+        modelDisCon.realizePosition(expected);
+        CHECK(path.getLength(*state) == Approx(path.getLength(expected)));
+        CHECK(state->getU()[0] == Approx(expected.getU()[0]));
+    }
+
+    // The kinematics may depend on parameters, so nothing is stored.
+    problem.addParameter("spring_stiffness", "/forceset/spring", "stiffness",
+            MocoBounds(5, 15));
+    MocoProblemRep repWithParameters = problem.createRep();
+    repWithParameters.initializePrescribedKinematicsOnGrid(times);
+    CHECK(repWithParameters.findPrescribedKinematicsStateOnGrid(0) == nullptr);
+}
+
 TEST_CASE("MocoInverse Rajagopal2016, 18 muscles", "[casadi]") {
 
     MocoInverse inverse;
@@ -19,6 +19,7 @@
 #define CATCH_CONFIG_MAIN
 #include "Testing.h"
 
+#include <OpenSim/Actuators/Millard2012EquilibriumMuscle.h>
 #include <OpenSim/Actuators/SpringGeneralizedForce.h>
 #include <OpenSim/Moco/osimMoco.h>
 #include <OpenSim/Simulation/SimbodyEngine/PinJoint.h>
@@ -257,3 +258,58 @@ TEMPLATE_TEST_CASE("See-saw center of mass", "",
 
     CHECK(sol_xCOM == Approx(xCOM).epsilon(0.003));
 }
+
+/// Optimize the max isometric force of a muscle holding up a mass. With
+/// parameters_require_initsystem set to false, the muscle is not finalized
+/// after MocoParameter edits the property, so this tests that
+/// Millard2012EquilibriumMuscle refreshes the parameters it caches in
+/// extendFinalizeFromProperties().
+TEST_CASE("Muscle max isometric force", "[casadi]") {
+    auto paramsRequireInitSystem = GENERATE(true, false);
+    CAPTURE(paramsRequireInitSystem);
+
+    const double mass = 1.0;
+    const double gravity = 9.81;
+    const double excitation = 0.5;
+    auto model = make_unique<Model>();
+    model->setName("hanging_mass");
+    model->set_gravity(SimTK::Vec3(-gravity, 0, 0));
+    auto* body = new Body("body", mass, SimTK::Vec3(0), SimTK::Inertia(0));
+    model->addComponent(body);
+    auto* joint = new SliderJoint("slider", model->getGround(), *body);
+    auto& coord = joint->updCoordinate(SliderJoint::Coord::TranslationX);
+    coord.setName("position");
+    coord.setDefaultValue(-0.2);
+    model->addComponent(joint);
+
+    // With a rigid tendon, the fiber is at its optimal length, so the muscle
+    // holds the mass still only if its max isometric force is
+    // mass * gravity / excitation.
+    auto* muscle = new Millard2012EquilibriumMuscle("muscle", 1.0, 0.1, 0.1, 0);
+    muscle->set_ignore_tendon_compliance(true);
+    muscle->set_ignore_activation_dynamics(true);
+    muscle->addNewPathPoint("origin", model->updGround(), SimTK::Vec3(0));
+    muscle->addNewPathPoint("insertion", *body, SimTK::Vec3(0));
+    model->addForce(muscle);
+
+    MocoStudy study;
+    study.setName("muscle_max_isometric_force");
+    MocoProblem& mp = study.updProblem();
+    mp.setModel(std::move(model));
+    mp.setTimeBounds(0, 0.5);
+    mp.setStateInfo("/slider/position/value", {-0.2, -0.2});
+    mp.setStateInfo("/slider/position/speed", {0, 0});
+    mp.setControlInfo("/forceset/muscle", {excitation, excitation});
+    mp.addParameter("max_isometric_force", "/forceset/muscle",
+            "max_isometric_force", MocoBounds(0, 100));
+    mp.addGoal<MocoControlGoal>();
+
+    auto& ms = study.initSolver<MocoCasADiSolver>();
+    ms.set_num_mesh_intervals(5);
+    ms.set_parameters_require_initsystem(paramsRequireInitSystem);
+
+    MocoSolution sol = study.solve();
+    REQUIRE(sol.success());
+    CHECK(sol.getParameter("max_isometric_force") ==
+            Approx(mass * gravity / excitation).epsilon(1e-6));
+}
@@ -50,8 +50,11 @@
 #include "MocoSolver.h"
 #include "MocoStudy.h"
 #include "MocoStudyFactory.h"
+#include "MocoSolutionCache.h"
+#include "MocoStudyBatch.h"
 #include "MocoTrack.h"
 #include "MocoTrajectory.h"
+#include "MocoTrajectoryBinary.h"
 #include "MocoTropterSolver.h"
 #include "MocoUtilities.h"
 #include "MocoWeightSet.h"
@@ -196,11 +196,11 @@ void AssemblySolver::assemble(SimTK::State &state)
     _assembler->initialize(s);
     
     // Useful to include through debug message/log in the future
-    log_debug("UNASSEMBLED CONFIGURATION (normerr={}, maxerr={}, cost={})",
+    OPENSIM_LOG_DEBUG("UNASSEMBLED CONFIGURATION (normerr={}, maxerr={}, cost={})",
         _assembler->calcCurrentErrorNorm(),
         max(abs(_assembler->getInternalState().getQErr())),
         _assembler->calcCurrentGoal());
-    log_debug("Model numQs: {} Assembler num freeQs: {}",  
+    OPENSIM_LOG_DEBUG("Model numQs: {} Assembler num freeQs: {}",  
         _assembler->getInternalState().getNQ(),  _assembler->getNumFreeQs());
 
     try{
@@ -220,13 +220,13 @@ void AssemblySolver::assemble(SimTK::State &state)
                 modelCoordSet[i].setLocked(state, isLocked);
         }
         // TODO: Useful to include through debug message/log in the future
-        log_debug("ASSEMBLED CONFIGURATION (acc={} tol={} normerr={}, maxerr={}, cost={})",
+        OPENSIM_LOG_DEBUG("ASSEMBLED CONFIGURATION (acc={} tol={} normerr={}, maxerr={}, cost={})",
             _assembler->getAccuracyInUse(), _assembler->getErrorToleranceInUse(), 
             _assembler->calcCurrentErrorNorm(), max(abs(_assembler->getInternalState().getQErr())),
             _assembler->calcCurrentGoal());
-        log_debug("# initializations={}", _assembler->getNumInitializations());
-        log_debug("# assembly steps: {}", _assembler->getNumAssemblySteps());
-        log_debug(" evals: goal={} grad={} error={} jac={}",
+        OPENSIM_LOG_DEBUG("# initializations={}", _assembler->getNumInitializations());
+        OPENSIM_LOG_DEBUG("# assembly steps: {}", _assembler->getNumAssemblySteps());
+        OPENSIM_LOG_DEBUG(" evals: goal={} grad={} error={} jac={}",
             _assembler->getNumGoalEvals(), _assembler->getNumGoalGradientEvals(),
             _assembler->getNumErrorEvals(), _assembler->getNumErrorJacobianEvals());
     }
@@ -258,11 +258,11 @@ void AssemblySolver::track(SimTK::State &s)
     }
 
     // TODO: Useful to include through debug message/log in the future
-    log_debug("UNASSEMBLED(track) CONFIGURATION (normerr={}, maxerr={}, cost={})",
+    OPENSIM_LOG_DEBUG("UNASSEMBLED(track) CONFIGURATION (normerr={}, maxerr={}, cost={})",
         _assembler->calcCurrentErrorNorm(), 
         max(abs(_assembler->getInternalState().getQErr())), 
         _assembler->calcCurrentGoal() );
-    log_debug("Model numQs: {}  Assembler num freeQs: {}",
+    OPENSIM_LOG_DEBUG("Model numQs: {}  Assembler num freeQs: {}",
         _assembler->getInternalState().getNQ(), _assembler->getNumFreeQs());
 
     try{
@@ -273,7 +273,7 @@ void AssemblySolver::track(SimTK::State &s)
         _assembler->updateFromInternalState(s);
         
         // TODO: Useful to include through debug message/log in the future
-        log_debug("Tracking: t= {} (acc={} tol={} normerr={}, maxerr={}, cost={})", 
+        OPENSIM_LOG_DEBUG("Tracking: t= {} (acc={} tol={} normerr={}, maxerr={}, cost={})", 
             s.getTime(),
             _assembler->getAccuracyInUse(), _assembler->getErrorToleranceInUse(), 
             _assembler->calcCurrentErrorNorm(), max(abs(_assembler->getInternalState().getQErr())),
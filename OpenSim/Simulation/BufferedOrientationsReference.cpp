@@ -25,6 +25,9 @@
 #include <OpenSim/Common/Units.h>
 #include <OpenSim/Common/TRCFileAdapter.h>
 #include <SimTKcommon/internal/State.h>
+#include <algorithm>
+#include <chrono>
+#include <thread>
 
 using namespace std;
 using namespace SimTK;
@@ -41,34 +44,66 @@ void BufferedOrientationsReference::getValuesAtTime(
         double time, SimTK::Array_<Rotation> &values) const
 {
     auto& times = _orientationData.getIndependentColumn();
-    SimTK::RowVector_<SimTK::Rotation> nextRow;
 
     if (time >= times.front() && time <= times.back()) {
-        nextRow = _orientationData.getRow(time);
+        _nextRow = _orientationData.getRow(time);
     } else {
-        _orientationDataQueue.pop_front(time, nextRow);
+        _orientationDataQueue.pop_front(time, _nextRow);
     }
-    int n = nextRow.size();
+    int n = _nextRow.size();
     values.resize(n);
 
     for (int i = 0; i < n; ++i) { 
-        values[i] = nextRow[i];
+        values[i] = _nextRow[i];
     }
 }
 
 void BufferedOrientationsReference::getNextValuesAndTime(
         double& time, SimTK::Array_<SimTK::Rotation_<double>>& values) {
 
-    SimTK::RowVector_<SimTK::Rotation> nextRow;
-    _orientationDataQueue.pop_front(time, nextRow);
-    int n = nextRow.size();
+    _orientationDataQueue.pop_front(time, _nextRow);
+    int n = _nextRow.size();
     values.resize(n);
 
-    for (int i = 0; i < n; ++i) { values[i] = nextRow[i]; }
+    for (int i = 0; i < n; ++i) { values[i] = _nextRow[i]; }
+}
+
+bool BufferedOrientationsReference::tryGetNextValuesAndTime(double& time,
+        SimTK::Array_<SimTK::Rotation_<double>>& values, double timeout) {
+
+    const auto wait = std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::duration<double>(std::max(timeout, 0.0)));
+    if (!_orientationDataQueue.try_pop_front(time, _nextRow, wait)) {
+        return false;
+    }
+    int n = _nextRow.size();
+    values.resize(n);
+
+    for (int i = 0; i < n; ++i) { values[i] = _nextRow[i]; }
+    return true;
 }
 
 void BufferedOrientationsReference::putValues(
         double time, const SimTK::RowVector_<SimTK::Rotation>& dataRow) {
     _orientationDataQueue.push_back(time, dataRow);
 }
+
+void BufferedOrientationsReference::replayValues(
+        const TimeSeriesTable_<SimTK::Rotation>& table,
+        double playbackSpeed) {
+    const auto& times = table.getIndependentColumn();
+    if (times.empty()) return;
+
+    const auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < times.size(); ++i) {
+        if (playbackSpeed > 0) {
+            const std::chrono::duration<double> offset(
+                    (times[i] - times.front()) / playbackSpeed);
+            std::this_thread::sleep_until(start +
+                    std::chrono::duration_cast<
+                            std::chrono::steady_clock::duration>(offset));
+        }
+        _orientationDataQueue.push_back(times[i], table.getRowAtIndex(i));
+    }
+}
 } // end of namespace OpenSim
\ No newline at end of file
@@ -84,14 +84,46 @@ public:
     void getNextValuesAndTime(double& time,
             SimTK::Array_<SimTK::Rotation_<double>>& values) override;
 
+    /** Like getNextValuesAndTime() but waits at most timeout seconds for
+     * data to be queued. Returns false, leaving time and values untouched,
+     * if no data arrived in time. */
+    bool tryGetNextValuesAndTime(double& time,
+            SimTK::Array_<SimTK::Rotation_<double>>& values,
+            double timeout = 0);
+
+    /** Queue every row of the passed in table in order, as a local stand-in
+     * for a live sensor stream. If playbackSpeed is positive, rows are paced
+     * against the wall clock (1 is real time, 2 twice as fast); otherwise
+     * they are queued as fast as the queue accepts them. Typically run on a
+     * producer thread; call setFinished() once the consumer should stop.
+     * With the queue's default DropOldest policy, rows that the consumer
+     * has not taken before the queue fills up are dropped; set the Block
+     * policy via updDataQueue() to replay every row. */
+    void replayValues(const TimeSeriesTable_<SimTK::Rotation>& table,
+            double playbackSpeed = 0);
+
     virtual bool hasNext() const override { return !_finished; };
 
     void setFinished(bool finished) { 
         _finished = finished;
     };
+
+#ifndef SWIG
+    /** Access the queue of client provided data, e.g. to change its capacity
+     * and overflow policy or to read its latency statistics. */
+    const DataQueue_<SimTK::Rotation>& getDataQueue() const {
+        return _orientationDataQueue;
+    }
+    DataQueue_<SimTK::Rotation>& updDataQueue() {
+        return _orientationDataQueue;
+    }
+#endif
+
 private:
     // Use a specialized data structure for holding the orientation data
     mutable DataQueue_<SimTK::Rotation> _orientationDataQueue;
+    // Reused by the consumer so that popping a row does not allocate.
+    mutable SimTK::RowVector_<SimTK::Rotation> _nextRow;
     bool _finished{false};
     //=============================================================================
 };  // END of class BufferedOrientationsReference
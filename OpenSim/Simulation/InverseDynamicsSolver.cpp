@@ -113,10 +113,14 @@ Vector InverseDynamicsSolver::solve(SimTK::State &s, const FunctionSet &Qs, doub
     Vector &u = s.updU();
     Vector &udot = s.updUDot();
 
+    // evaluate all coordinate functions and their first two derivatives
+    // together so that splines sharing knots share the interval search
+    std::vector<double> values(3*nq);
+    Qs.calcValuesAndDerivatives(time, 2, values.data());
     for(int i=0; i<nq; i++){
-        q[i] = Qs.evaluate(i, 0, time);
-        u[i] = Qs.evaluate(i, 1, time);
-        udot[i] = Qs.evaluate(i, 2, time);
+        q[i] = values[3*i];
+        u[i] = values[3*i + 1];
+        udot[i] = values[3*i + 2];
     }
 
     // Perform general inverse dynamics
@@ -30,6 +30,11 @@
 #include <OpenSim/Simulation/Model/AnalysisSet.h>
 #include <OpenSim/Simulation/Model/ControllerSet.h>
 #include <OpenSim/Common/Array.h>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <set>
+#include <thread>
 
 
 using namespace OpenSim;
@@ -40,9 +45,175 @@ using namespace std;
 // STATICS
 //=============================================================================
 std::string Manager::_displayName = "Simulator";
+//=============================================================================
+// ASYNCHRONOUS RECORDING
+//=============================================================================
+/* Records clones of the analyses that opt in with
+ * Analysis::canRecordOnModelCopy() on one worker thread, using the worker's
+ * own copy of the Model, so that the worker never touches the Model or
+ * States being integrated. The integrator copies each State into a free slot
+ * of a bounded ring; the worker records the slot at the head of the ring and
+ * only then releases it, so the two threads never touch the same slot.
+ * finish() appends what the clones recorded to the original analyses. */
+class Manager::AsyncRecorder {
+public:
+    AsyncRecorder(Model& model, int capacity) : _slots(capacity) {
+        _model.reset(new Model(model));
+        _model->setUseVisualizer(false);
+        _model->updAnalysisSet().clearAndDestroy();
+        _state = _model->initSystem();
+        AnalysisSet& analysisSet = model.updAnalysisSet();
+        for (int i = 0; i < analysisSet.getSize(); ++i) {
+            Analysis& analysis = analysisSet.get(i);
+            if (!analysis.getOn() || !analysis.canRecordOnModelCopy())
+                continue;
+            std::unique_ptr<Analysis> copy(analysis.clone());
+            copy->setModel(*_model);
+            _analyses.push_back({&analysis, std::move(copy), {}});
+        }
+        _worker = std::thread(&AsyncRecorder::work, this);
+    }
+    ~AsyncRecorder() {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _done = true;
+        }
+        _notEmpty.notify_one();
+        if (_worker.joinable()) _worker.join();
+    }
+
+    // Is analysis recorded by this recorder (rather than by the Manager)?
+    bool records(const Analysis& analysis) const {
+        for (const auto& entry : _analyses)
+            if (entry.original == &analysis) return true;
+        return false;
+    }
+
+    void push(const SimTK::State& s, int step) {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _notFull.wait(lock,
+                [this] { return _size < _slots.size() || _error; });
+        if (_error) std::rethrow_exception(_error);
+        Snapshot& slot = _slots[(_head + _size) % _slots.size()];
+        slot.state = s;
+        slot.step = step;
+        ++_size;
+        lock.unlock();
+        _notEmpty.notify_one();
+    }
+
+    // Record all queued snapshots, stop the worker, rethrow its error, and
+    // append the rows each clone recorded after its begin() to the
+    // corresponding Storages of the original analysis.
+    void finish() {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _done = true;
+        }
+        _notEmpty.notify_one();
+        _worker.join();
+        if (_error) std::rethrow_exception(_error);
+
+        for (auto& entry : _analyses) {
+            ArrayPtrs<Storage>& originals = entry.original->getStorageList();
+            ArrayPtrs<Storage>& copies = entry.copy->getStorageList();
+            OPENSIM_THROW_IF(originals.getSize() != copies.getSize() ||
+                    (int)entry.numBeginRows.size() != copies.getSize(),
+                    Exception,
+                    "Analysis '{}' recorded {} Storages on the Model copy, "
+                    "but has {}.",
+                    entry.original->getName(), copies.getSize(),
+                    originals.getSize());
+            std::set<const Storage*> appended;
+            for (int i = 0; i < copies.getSize(); ++i) {
+                if (!appended.insert(originals[i]).second) continue;
+                for (int row = entry.numBeginRows[i];
+                        row < copies[i]->getSize(); ++row) {
+                    originals[i]->append(*copies[i]->getStateVector(row));
+                }
+            }
+        }
+    }
+
+private:
+    struct Snapshot {
+        SimTK::State state;
+        int step;
+    };
+    struct RecordedAnalysis {
+        Analysis* original;
+        std::unique_ptr<Analysis> copy;
+        // Rows in each of the copy's Storages after begin(); these are
+        // already in the original's Storages.
+        std::vector<int> numBeginRows;
+    };
+
+    void record(const Snapshot& slot) {
+        // Only the continuous state variables are transferred; the copy's
+        // controllers and components compute everything else again.
+        _state.setTime(slot.state.getTime());
+        _state.updY() = slot.state.getY();
+        _model->getMultibodySystem().realize(_state,
+                SimTK::Stage::Acceleration);
+        for (auto& entry : _analyses) {
+            Analysis& analysis = *entry.copy;
+            if (slot.step == 0) {
+                analysis.begin(_state);
+                const ArrayPtrs<Storage>& storages =
+                        analysis.getStorageList();
+                entry.numBeginRows.clear();
+                for (int i = 0; i < storages.getSize(); ++i)
+                    entry.numBeginRows.push_back(storages[i]->getSize());
+            } else if (slot.step < 0) {
+                analysis.end(_state);
+            } else {
+                analysis.step(_state, slot.step);
+            }
+        }
+    }
+
+    void work() {
+        try {
+            while (true) {
+                std::unique_lock<std::mutex> lock(_mutex);
+                _notEmpty.wait(lock, [this] { return _size > 0 || _done; });
+                if (_size == 0) return;
+                Snapshot& slot = _slots[_head];
+                lock.unlock();
+
+                record(slot);
+
+                lock.lock();
+                _head = (_head + 1) % _slots.size();
+                --_size;
+                lock.unlock();
+                _notFull.notify_one();
+            }
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _error = std::current_exception();
+            _notFull.notify_one();
+        }
+    }
+
+    std::unique_ptr<Model> _model;
+    SimTK::State _state;
+    std::vector<RecordedAnalysis> _analyses;
+    std::vector<Snapshot> _slots;
+    size_t _head{0};
+    size_t _size{0};
+    bool _done{false};
+    std::exception_ptr _error;
+    std::mutex _mutex;
+    std::condition_variable _notEmpty;
+    std::condition_variable _notFull;
+    std::thread _worker;
+};
+
 //=============================================================================
 // DESTRUCTOR
 //=============================================================================
+Manager::~Manager() = default;
 
 
 //=============================================================================
@@ -97,6 +268,8 @@ setNull()
     _dt = 1.0e-4;
     _performAnalyses=true;
     _writeToStorage=true;
+    _recordAsynchronously = false;
+    _recordQueueCapacity = 16;
     _tArray.setSize(0);
     _dtArray.setSize(0);
 }
@@ -494,6 +667,23 @@ setModel(Model& model)
     setSessionName(_model->getName());
 }
 
+//-----------------------------------------------------------------------------
+// RECORDING
+//-----------------------------------------------------------------------------
+//_____________________________________________________________________________
+/**
+ * Set whether analyses and state storage run on a separate thread.
+ */
+void Manager::setRecordAsynchronously(bool recordAsynchronously,
+        int queueCapacity)
+{
+    OPENSIM_THROW_IF(queueCapacity < 1, Exception,
+            fmt::format("Expected queueCapacity to be at least 1, but got {}.",
+                    queueCapacity));
+    _recordAsynchronously = recordAsynchronously;
+    _recordQueueCapacity = queueCapacity;
+}
+
 //-----------------------------------------------------------------------------
 // INTEGRATOR
 //-----------------------------------------------------------------------------
@@ -696,6 +886,24 @@ const SimTK::State& Manager::integrate(double finalTime)
         _integ->setReturnEveryInternalStep(true);
     }
 
+    // The recorder stops on any exit from integrate(); normal exits call
+    // finishRecording() first to wait for the queued snapshots.
+    struct AsyncRecorderReset {
+        std::unique_ptr<AsyncRecorder>& recorder;
+        ~AsyncRecorderReset() { recorder.reset(); }
+    } asyncRecorderReset{_asyncRecorder};
+    if (_recordAsynchronously && _performAnalyses) {
+        const AnalysisSet& analysisSet = _model->getAnalysisSet();
+        for (int i = 0; i < analysisSet.getSize(); ++i) {
+            const Analysis& analysis = analysisSet.get(i);
+            if (analysis.getOn() && analysis.canRecordOnModelCopy()) {
+                _asyncRecorder.reset(
+                        new AsyncRecorder(*_model, _recordQueueCapacity));
+                break;
+            }
+        }
+    }
+
     _model->realizeVelocity(s);
     initializeStorageAndAnalyses(s);
 
@@ -709,6 +917,7 @@ const SimTK::State& Manager::integrate(double finalTime)
 
     if (time >= stepToTime) {
         // No integration can be performed.
+        finishRecording();
         return getState();
     }
 
@@ -739,6 +948,7 @@ const SimTK::State& Manager::integrate(double finalTime)
                         SimTK::Integrator::ReachedFinalTime) {
             log_error("Integration failed due to the following reason: {}",
                 _integ->getTerminationReasonString(_integ->getTerminationReason()));
+            finishRecording();
             return getState();
         }
 
@@ -751,6 +961,7 @@ const SimTK::State& Manager::integrate(double finalTime)
     clearHalt();
 
     record(_integ->getState(), -1);
+    finishRecording();
 
     return getState();
 }
@@ -834,7 +1045,16 @@ void Manager::initialize(const SimTK::State& s)
 void Manager::record(const SimTK::State& s, const int& step)
 {
     // ANALYSES
-    if (_performAnalyses) {
+    // begin() of every analysis runs here, since it may modify the Model
+    // (e.g., ForceReporter names unnamed forces); the recorder's clones then
+    // begin() on the Model copy.
+    if (_asyncRecorder) {
+        if (step == 0)
+            _model->updAnalysisSet().begin(s);
+        else
+            recordAnalyses(s, step);
+        _asyncRecorder->push(s, step);
+    } else if (_performAnalyses) {
         AnalysisSet& analysisSet = _model->updAnalysisSet();
         if (step == 0)
             analysisSet.begin(s);
@@ -843,6 +1063,25 @@ void Manager::record(const SimTK::State& s, const int& step)
         else
             analysisSet.step(s, step);
     }
+    recordStates(s, step);
+}
+
+void Manager::recordAnalyses(const SimTK::State& s, int step)
+{
+    AnalysisSet& analysisSet = _model->updAnalysisSet();
+    for (int i = 0; i < analysisSet.getSize(); ++i) {
+        Analysis& analysis = analysisSet.get(i);
+        if (!analysis.getOn() || _asyncRecorder->records(analysis))
+            continue;
+        if (step < 0)
+            analysis.end(s);
+        else
+            analysis.step(s, step);
+    }
+}
+
+void Manager::recordStates(const SimTK::State& s, int step)
+{
     if (_writeToStorage) {
         SimTK::Vector stateValues = _model->getStateVariableValues(s);
         StateVector vec;
@@ -854,6 +1093,13 @@ void Manager::record(const SimTK::State& s, const int& step)
     }
 }
 
+void Manager::finishRecording()
+{
+    if (!_asyncRecorder) return;
+    std::unique_ptr<AsyncRecorder> recorder(std::move(_asyncRecorder));
+    recorder->finish();
+}
+
 //=============================================================================
 // INTERRUPT
 //=============================================================================
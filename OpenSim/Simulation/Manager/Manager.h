@@ -118,6 +118,18 @@ private:
     /** controllerSet used for the integration */
     SimTK::ReferencePtr<ControllerSet> _controllerSet;
 
+    /** flag indicating if analyses and state storage run on a separate
+    thread (see setRecordAsynchronously()) */
+    bool _recordAsynchronously;
+
+    /** number of state snapshots that may wait for the recording thread */
+    int _recordQueueCapacity;
+
+    /** Runs thread-safe analyses on a worker thread during integrate() when
+    _recordAsynchronously is set. */
+    class AsyncRecorder;
+    std::unique_ptr<AsyncRecorder> _asyncRecorder;
+
 
 //=============================================================================
 // METHODS
@@ -146,6 +158,8 @@ public:
     Manager(const Manager&) = delete;
     void operator=(const Manager&) = delete;
 
+    ~Manager();
+
 private:
     void setNull();
     bool constructStorage();
@@ -163,6 +177,27 @@ public:
     void setWriteToStorage(bool writeToStorage)
     { _writeToStorage =  writeToStorage; }
 
+    /** Record the analyses that support it (those whose
+    Analysis::canRecordOnModelCopy() returns true, e.g., ForceReporter,
+    Kinematics, MuscleAnalysis and JointReaction) on a separate thread, so
+    that they overlap with integration instead of stalling it. The thread
+    owns a copy of the Model, made when integrate() starts, and records
+    clones of those analyses on it. At each recorded step, the integrator
+    hands a copy of the State to a bounded queue of queueCapacity
+    snapshots; it waits when the queue is full. Snapshots are processed in
+    order, and integrate() returns only once all of them have been recorded
+    and the clones' results appended to the original analyses' Storages.
+    Only the time and continuous state variables of a snapshot reach the
+    copy, which evaluates its own controllers and components; results
+    therefore match synchronous recording unless they depend on discrete
+    state (e.g., actuator overrides) set on the integrated State.
+    The states and controls Storages, the begin() of every analysis, and
+    all other analyses are still recorded on the integrating thread. If no
+    such analysis is on, nothing runs asynchronously. Default: false. */
+    void setRecordAsynchronously(bool recordAsynchronously,
+            int queueCapacity = 16);
+    bool getRecordAsynchronously() const { return _recordAsynchronously; }
+
     /** @name Configure the Integrator
       * @note Call these functions before calling `Manager::initialize()`.
       * @{ */
@@ -362,6 +397,14 @@ private:
     // Helper to record state and analysis values at integration steps.
     // step = 0 is the beginning, step = -1 used to denote the end/final step
     void record(const SimTK::State& s, const int& step);
+    // Calls step() (or end(), if step < 0) on the analyses that the
+    // AsyncRecorder does not record.
+    void recordAnalyses(const SimTK::State& s, int step);
+    // Appends to the states and controls Storages.
+    void recordStates(const SimTK::State& s, int step);
+    // Wait for the AsyncRecorder (if any) to finish recording, rethrowing
+    // any exception raised on its thread.
+    void finishRecording();
 
 //=============================================================================
 };  // END of class Manager
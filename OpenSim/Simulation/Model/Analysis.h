@@ -188,6 +188,17 @@ public:
 
     virtual bool proceed(int aStep=0);
 
+    /**
+     * Can a clone of this analysis record on a copy of the Model, in place
+     * of this analysis (see Manager::setRecordAsynchronously())? The
+     * Manager appends the rows that the clone records after its begin() to
+     * the corresponding Storages of getStorageList(). Return true only if
+     * getStorageList() holds all of the results, in the same order for a
+     * clone as for this analysis, and the results depend only on the Model
+     * and the State. Default: false.
+     */
+    virtual bool canRecordOnModelCopy() const { return false; }
+
     //--------------------------------------------------------------------------
     // GET AND SET
     //--------------------------------------------------------------------------
@@ -98,6 +98,7 @@ void CMCActuatorSubsystemRep::setSpeedTrajectories(FunctionSet *aSet) {
        _uCorrections.setSize(_model->getNumSpeeds() );
        _qWork.setSize(_model->getNumCoordinates());
        _uWork.setSize(_model->getNumSpeeds());
+       _qAndDerivWork.setSize(2*_model->getNumCoordinates());
    }
    CMCActuatorSubsystemRep* CMCActuatorSubsystemRep::cloneImpl() const { return new CMCActuatorSubsystemRep(*this); }
 
@@ -134,11 +135,18 @@ void CMCActuatorSubsystemRep::setSpeedTrajectories(FunctionSet *aSet) {
          t = s.getTime();
     }
 
-    _qSet->evaluate(_qWork,0,t);
     if(_uSet!=NULL) {
-        _uSet->evaluate(_uWork,0,t);
+        _qSet->calcValuesAndDerivatives(t, 0, &_qWork[0]);
+        _uSet->calcValuesAndDerivatives(t, 0, &_uWork[0]);
     } else {
-        _qSet->evaluate(_uWork,1,t);
+        // Evaluate the coordinates and their first derivatives together so
+        // each spline's knot interval is searched only once.
+        _qSet->calcValuesAndDerivatives(t, 1, &_qAndDerivWork[0]);
+        _uWork.setSize(nq);
+        for (int i = 0; i < nq; ++i) {
+            _qWork[i] = _qAndDerivWork[2*i];
+            _uWork[i] = _qAndDerivWork[2*i + 1];
+        }
     }
 
     /* Hack to obtain a mutable state in a const method */
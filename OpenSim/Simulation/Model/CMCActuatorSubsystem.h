@@ -98,6 +98,8 @@ class CMCActuatorSubsystemRep : public SimTK::Subsystem::Guts {
 
   mutable Array<double> _qWork;
   mutable Array<double> _uWork;
+  // Interleaved coordinate values and first derivatives.
+  mutable Array<double> _qAndDerivWork;
 
   /** Prescribed trajectories of the generalized coordinates. */
   FunctionSet *_qSet;
@@ -22,6 +22,7 @@
  * -------------------------------------------------------------------------- */
 
 #include <fstream>
+#include <sys/stat.h>
 #include <OpenSim/Common/IO.h>
 #include "ContactMesh.h"
 #include "Model.h"
@@ -53,6 +54,9 @@ ContactMesh::ContactMesh(const std::string& filename,
         mesh.loadFile(filename);
         _geometry.reset(new SimTK::ContactGeometry::TriangleMesh(mesh));
         _decorativeGeometry.reset(new SimTK::DecorativeMesh(mesh));
+        _loadedFilename = filename;
+        _loadedModelFile = "";
+        recordLoadedFileStatus(filename);
     }
 }
 
@@ -77,8 +81,12 @@ void ContactMesh::constructProperties()
 }
 
 void ContactMesh::extendFinalizeFromProperties() {
-    _geometry.reset();
-    _decorativeGeometry.reset();
+    // Keep a previously loaded mesh; createSimTKContactGeometry() reloads it
+    // if the filename property changed.
+    if (_geometry && _loadedFilename != get_filename()) {
+        _geometry.reset();
+        _decorativeGeometry.reset();
+    }
 }
 
 const std::string& ContactMesh::getFilename() const
@@ -101,9 +109,9 @@ SimTK::ContactGeometry::TriangleMesh* ContactMesh::
     assert (_model);
 
     auto cwd = IO::CwdChanger::noop();
-    if ((_model->getInputFileName()!="")
-            && (_model->getInputFileName()!="Unassigned")) {
-        cwd = IO::CwdChanger::changeToParentOf(_model->getInputFileName());
+    const std::string modelFile = getModelFileForMesh();
+    if (!modelFile.empty()) {
+        cwd = IO::CwdChanger::changeToParentOf(modelFile);
     }
 
     file.open(filename.c_str());
@@ -114,14 +122,56 @@ SimTK::ContactGeometry::TriangleMesh* ContactMesh::
     }
     file.close();
     mesh.loadFile(filename);
+    recordLoadedFileStatus(filename);
     _decorativeGeometry.reset(new SimTK::DecorativeMesh(mesh));
     return new SimTK::ContactGeometry::TriangleMesh(mesh);
 }
 
+std::string ContactMesh::getModelFileForMesh() const
+{
+    assert (_model);
+    const std::string& modelFile = _model->getInputFileName();
+    if (modelFile == "Unassigned") return "";
+    return modelFile;
+}
+
+void ContactMesh::recordLoadedFileStatus(const std::string& filename) const
+{
+    struct stat status;
+    if (stat(filename.c_str(), &status) == 0) {
+        _loadedFileTime = status.st_mtime;
+        _loadedFileSize = status.st_size;
+    } else {
+        _loadedFileTime = 0;
+        _loadedFileSize = -1;
+    }
+}
+
+bool ContactMesh::hasMeshFileChanged(const std::string& modelFile) const
+{
+    auto cwd = IO::CwdChanger::noop();
+    if (!modelFile.empty()) {
+        cwd = IO::CwdChanger::changeToParentOf(modelFile);
+    }
+    struct stat status;
+    if (stat(get_filename().c_str(), &status) != 0) return false;
+    // The modification time has a resolution of a second, so also compare
+    // the size to detect a file rewritten right after it was loaded.
+    return status.st_mtime != _loadedFileTime ||
+           status.st_size != _loadedFileSize;
+}
+
 SimTK::ContactGeometry ContactMesh::createSimTKContactGeometry() const
 {
-    if (!_geometry)
+    // A relative filename may refer to a different file if the model was
+    // loaded from a different directory.
+    const std::string modelFile = getModelFileForMesh();
+    if (!_geometry || _loadedFilename != get_filename() ||
+            _loadedModelFile != modelFile || hasMeshFileChanged(modelFile)) {
         _geometry.reset(loadMesh(get_filename()));
+        _loadedFilename = get_filename();
+        _loadedModelFile = modelFile;
+    }
     return *_geometry;
 }
 
@@ -25,6 +25,8 @@
 // INCLUDE
 #include "ContactGeometry.h"
 
+#include <ctime>
+
 namespace OpenSim {
 
 // TODO update doxygen comments to mention socket.
@@ -108,13 +110,31 @@ private:
     @param filename   string containing the file to be loaded
     @return SimTK::ContactGeometry::TriangleMesh* heap allocated Contact mesh */
     SimTK::ContactGeometry::TriangleMesh* loadMesh(const std::string& filename) const;
+    /** The model file that relative mesh file names are resolved against
+    (empty if the model was not loaded from a file). */
+    std::string getModelFileForMesh() const;
+    /** Record the modification time and size of the file _geometry was
+    loaded from (relative to the current working directory). */
+    void recordLoadedFileStatus(const std::string& filename) const;
+    /** Whether the mesh file was modified since it was loaded. A file that
+    no longer exists is not considered modified. */
+    bool hasMeshFileChanged(const std::string& modelFile) const;
 //=============================================================================
 // DATA
 //=============================================================================
-    mutable SimTK::ResetOnCopy<std::unique_ptr<SimTK::ContactGeometry::TriangleMesh>>
+    // Building a TriangleMesh reads the file and constructs its OBB tree,
+    // which is expensive for large meshes. The (immutable) mesh is shared by
+    // copies of this ContactMesh and is only reloaded if the filename, the
+    // model file it is resolved against, or the file on disk changes.
+    mutable std::shared_ptr<const SimTK::ContactGeometry::TriangleMesh>
         _geometry;
-    mutable SimTK::ResetOnCopy<std::unique_ptr<SimTK::DecorativeMesh>>
-        _decorativeGeometry;
+    mutable std::shared_ptr<const SimTK::DecorativeMesh> _decorativeGeometry;
+    /** The filename and model file that _geometry was loaded for. */
+    mutable std::string _loadedFilename;
+    mutable std::string _loadedModelFile;
+    /** The modification time and size of the file when it was loaded. */
+    mutable std::time_t _loadedFileTime = 0;
+    mutable long long _loadedFileSize = -1;
 
 //=============================================================================
 };  // END of class ContactMesh
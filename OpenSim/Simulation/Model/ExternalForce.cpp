@@ -322,6 +322,15 @@ void ExternalForce::extendConnectToModel(Model& model)
 
 
 
+void ExternalForce::extendAddToSystem(SimTK::MultibodySystem& system) const
+{
+    Super::extendAddToSystem(system);
+
+    // The prescribed loads only depend on time.
+    this->_loadsCV = addCacheVariable("loads", SimTK::Vec<9>(0),
+            SimTK::Stage::Time);
+}
+
 //-----------------------------------------------------------------------------
 // FORCE METHODS
 //-----------------------------------------------------------------------------
@@ -331,16 +340,16 @@ void ExternalForce::computeForce(const SimTK::State& state,
                               SimTK::Vector_<SimTK::SpatialVec>& bodyForces, 
                               SimTK::Vector& generalizedForces) const
 {
-    double time = state.getTime();
-
     assert(_appliedToBody!=nullptr);
 
+    const SimTK::Vec<9>& loads = getLoadsAtTime(state);
+
     if (_appliesForce) {
-        Vec3 force = getForceAtTime(time);
+        Vec3 force = loads.getSubVec<3>(0);
         force = _forceExpressedInBody->expressVectorInGround(state, force);
         Vec3 point(0); // Default is body origin.
         if (_specifiesPoint) {
-            point = getPointAtTime(time);
+            point = loads.getSubVec<3>(3);
             point = _pointExpressedInBody->
                 findStationLocationInAnotherFrame(state, point, *_appliedToBody);
         }
@@ -348,12 +357,49 @@ void ExternalForce::computeForce(const SimTK::State& state,
     }
 
     if (_appliesTorque) {
-        Vec3 torque = getTorqueAtTime(time);
+        Vec3 torque = loads.getSubVec<3>(6);
         torque = _forceExpressedInBody->expressVectorInGround(state, torque);
         applyTorque(state, *_appliedToBody, torque, bodyForces);
     }
 }
 
+const SimTK::Vec<9>& ExternalForce::getLoadsAtTime(
+        const SimTK::State& state) const
+{
+    if (isCacheVariableValid(state, _loadsCV)) {
+        return getCacheVariableValue(state, _loadsCV);
+    }
+
+    SimTK::Vec<9>& loads = updCacheVariableValue(state, _loadsCV);
+    calcLoadsAtTime(state.getTime(), loads);
+    markCacheVariableValid(state, _loadsCV);
+    return loads;
+}
+
+void ExternalForce::calcLoadsAtTime(double aTime, SimTK::Vec<9>& loads) const
+{
+    const ArrayPtrs<Function>* functions[3] =
+            {&_forceFunctions, &_pointFunctions, &_torqueFunctions};
+    const SimTK::Vector timeAsVector(1, aTime);
+    // All splines are fit to the same time column; the interval found for
+    // the first one is reused by the others.
+    int interval = 0;
+    for (int i = 0; i < 3; ++i) {
+        for (int j = 0; j < 3; ++j) {
+            double& value = loads[3*i + j];
+            if (functions[i]->size() != 3) {
+                value = 0.0;
+                continue;
+            }
+            const Function* f = functions[i]->get(j);
+            if (const auto* spline = dynamic_cast<const GCVSpline*>(f))
+                spline->calcValueAndDerivatives(aTime, 0, &value, interval);
+            else
+                value = f->calcValue(timeAsVector);
+        }
+    }
+}
+
 /**
  * Convenience methods to access prescribed force functions
  */
@@ -437,16 +483,16 @@ OpenSim::Array<std::string> ExternalForce::getRecordLabels() const {
 OpenSim::Array<double> ExternalForce::getRecordValues(const SimTK::State& state) const
 {
     OpenSim::Array<double>  values(SimTK::NaN);
-    double time = state.getTime();
+    const SimTK::Vec<9>& loads = getLoadsAtTime(state);
 
     if (_appliesForce) {
-        Vec3 force = getForceAtTime(time);
+        Vec3 force = loads.getSubVec<3>(0);
         force = _forceExpressedInBody->expressVectorInGround(state, force);
         for(int i=0; i<3; ++i)
             values.append(force[i]);
     
         if (_specifiesPoint) {
-            Vec3 point = getPointAtTime(time);
+            Vec3 point = loads.getSubVec<3>(3);
             point = _pointExpressedInBody->
                 findStationLocationInAnotherFrame(state, point, *_appliedToBody);
             for(int i=0; i<3; ++i)
@@ -454,7 +500,7 @@ OpenSim::Array<double> ExternalForce::getRecordValues(const SimTK::State& state)
         }
     }
     if (_appliesTorque){
-        Vec3 torque = getTorqueAtTime(time);
+        Vec3 torque = loads.getSubVec<3>(6);
         torque = _forceExpressedInBody->expressVectorInGround(state, torque);
         for(int i=0; i<3; ++i)
             values.append(torque[i]);
@@ -219,6 +219,8 @@ protected:
     /**  ModelComponent interface */ 
     void extendConnectToModel(Model& model) override;
 
+    void extendAddToSystem(SimTK::MultibodySystem& system) const override;
+
     /**
      * Compute the force.
      */
@@ -230,6 +232,16 @@ private:
     void setNull();
     void constructProperties();
 
+    /** Force, point and torque (in that order, each expressed in its data
+        source frame) at the time of the given state. The values only depend
+        on time, so they are computed once per time and cached. */
+    const SimTK::Vec<9>& getLoadsAtTime(const SimTK::State& state) const;
+    /** Evaluate all force, point and torque functions at aTime. The splines
+        of one ExternalForce share the time column of the data source, so
+        they share a single knot interval search. Components that are not
+        specified are set to 0. */
+    void calcLoadsAtTime(double aTime, SimTK::Vec<9>& loads) const;
+
 
 //==============================================================================
 // DATA
@@ -259,6 +271,8 @@ private:
     ArrayPtrs<Function> _torqueFunctions;
     ArrayPtrs<Function> _pointFunctions;
 
+    mutable CacheVariable<SimTK::Vec<9>> _loadsCV;
+
     friend class ExternalLoads;
 //==============================================================================
 };  // END of class ExternalForce
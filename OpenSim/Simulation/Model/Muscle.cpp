@@ -659,10 +659,8 @@ void Muscle::computeForce(const SimTK::State& s,
     // optimizer is computing gradients, but in those cases the actuation will 
     // be overridden and will not be computed by the muscle.
     if (!isActuationOverridden(s) && (getActuation(s) < -SimTK::SqrtEps)) {
-        string msg = getConcreteClassName()
-            + "::computeForce, muscle "+ getName() + " force < 0";
-        log_debug("{}  at time = ", msg, s.getTime());
-        //throw Exception(msg);
+        OPENSIM_LOG_DEBUG("{}::computeForce, muscle {} force < 0 at time = {}",
+                getConcreteClassName(), getName(), s.getTime());
     }
 }
 
@@ -151,43 +151,52 @@ OpenSim::Array<double> SmoothSphereHalfSpaceForce::getRecordValues(
 
     OpenSim::Array<double> values(1);
 
-    const auto& sphere = getConnectee<ContactSphere>("sphere");
-    const auto sphereIdx = sphere.getFrame().getMobilizedBodyIndex();
-
-    const auto& halfSpace = getConnectee<ContactHalfSpace>("half_space");
-    const auto halfSpaceIdx = halfSpace.getFrame().getMobilizedBodyIndex();
-
-    const Model& model = getModel();
-    const auto& forceSubsys = model.getForceSubsystem();
-    const SimTK::Force& abstractForce = forceSubsys.getForce(_index);
-    const auto& simtkForce =
-            static_cast<const SimTK::SmoothSphereHalfSpaceForce&>(
-                    abstractForce);
-
-    SimTK::Vector_<SimTK::SpatialVec> bodyForces(0);
-    SimTK::Vector_<SimTK::Vec3> particleForces(0);
-    SimTK::Vector mobilityForces(0);
-
-    simtkForce.calcForceContribution(
-            state, bodyForces, particleForces, mobilityForces);
+    ForceWorkspace workspace;
+    SimTK::SpatialVec forceOnSphere;
+    SimTK::SpatialVec forceOnHalfSpace;
+    calcContactForces(state, workspace, forceOnSphere, forceOnHalfSpace);
 
     // On sphere
-    const auto& thisBodyForce1 = bodyForces(sphereIdx);
-    SimTK::Vec3 forces1 = thisBodyForce1[1];
-    SimTK::Vec3 torques1 = thisBodyForce1[0];
+    SimTK::Vec3 forces1 = forceOnSphere[1];
+    SimTK::Vec3 torques1 = forceOnSphere[0];
     values.append(3, &forces1[0]);
     values.append(3, &torques1[0]);
 
     // On plane
-    const auto& thisBodyForce2 = bodyForces(halfSpaceIdx);
-    SimTK::Vec3 forces2 = thisBodyForce2[1];
-    SimTK::Vec3 torques2 = thisBodyForce2[0];
+    SimTK::Vec3 forces2 = forceOnHalfSpace[1];
+    SimTK::Vec3 torques2 = forceOnHalfSpace[0];
     values.append(3, &forces2[0]);
     values.append(3, &torques2[0]);
 
     return values;
 }
 
+void SmoothSphereHalfSpaceForce::calcContactForces(const SimTK::State& state,
+        ForceWorkspace& workspace, SimTK::SpatialVec& forceOnSphere,
+        SimTK::SpatialVec& forceOnHalfSpace) const {
+
+    const auto& sphere = getConnectee<ContactSphere>("sphere");
+    const auto sphereIdx = sphere.getFrame().getMobilizedBodyIndex();
+
+    const auto& halfSpace = getConnectee<ContactHalfSpace>("half_space");
+    const auto halfSpaceIdx = halfSpace.getFrame().getMobilizedBodyIndex();
+
+    // The vectors keep their size (and memory) across calls.
+    getSimTKForce().calcForceContribution(state, workspace.bodyForces,
+            workspace.particleForces, workspace.mobilityForces);
+
+    forceOnSphere = workspace.bodyForces(sphereIdx);
+    forceOnHalfSpace = workspace.bodyForces(halfSpaceIdx);
+}
+
+const SimTK::SmoothSphereHalfSpaceForce&
+SmoothSphereHalfSpaceForce::getSimTKForce() const {
+    const auto& forceSubsys = getModel().getForceSubsystem();
+    const SimTK::Force& abstractForce = forceSubsys.getForce(_index);
+    return static_cast<const SimTK::SmoothSphereHalfSpaceForce&>(
+            abstractForce);
+}
+
 void SmoothSphereHalfSpaceForce::generateDecorations(bool fixed,
         const ModelDisplayHints& hints, const SimTK::State& state,
         SimTK::Array_<SimTK::DecorativeGeometry>& geometry) const {
@@ -195,28 +204,17 @@ void SmoothSphereHalfSpaceForce::generateDecorations(bool fixed,
 
     if (!fixed && (state.getSystemStage() >= SimTK::Stage::Dynamics) &&
             hints.get_show_forces()) {
-        // Get the underlying SimTK force element.
-        const Model& model = getModel();
-        const auto& forceSubsystem = model.getForceSubsystem();
-        const SimTK::Force& abstractForce = forceSubsystem.getForce(_index);
-        const auto& simtkForce =
-                static_cast<const SimTK::SmoothSphereHalfSpaceForce&>(
-                        abstractForce);
-
         // Compute the body forces.
-        SimTK::Vector_<SimTK::SpatialVec> bodyForces(0);
-        SimTK::Vector_<SimTK::Vec3> particleForces(0);
-        SimTK::Vector mobilityForces(0);
-        simtkForce.calcForceContribution(
-                state, bodyForces, particleForces, mobilityForces);
+        ForceWorkspace workspace;
+        SimTK::SpatialVec forceOnSphere;
+        SimTK::SpatialVec forceOnHalfSpace;
+        calcContactForces(state, workspace, forceOnSphere, forceOnHalfSpace);
 
-        // Get the index to the associated contact sphere.
         const auto& sphere = getConnectee<ContactSphere>("sphere");
-        const auto& sphereIdx = sphere.getFrame().getMobilizedBodyIndex();
 
         // Get the translational force for the contact sphere associated with
         // this force element.
-        const auto& sphereForce = bodyForces(sphereIdx)[1];
+        const SimTK::Vec3 sphereForce = forceOnSphere[1];
 
         // Scale the contact force vector and compute the cylinder length.
         const auto& scaledContactForce =
@@ -24,6 +24,10 @@
 #include "ContactSphere.h"
 #include <OpenSim/Common/Set.h>
 
+namespace SimTK {
+class SmoothSphereHalfSpaceForce;
+}
+
 namespace OpenSim {
 
 /** This compliant contact force model is similar to HuntCrossleyForce, except
@@ -140,6 +144,26 @@ public:
     OpenSim::Array<double> getRecordValues(
             const SimTK::State& state) const override;
 
+#ifndef SWIG
+    /// Scratch space for calcContactForces(). The force vectors are sized for
+    /// the whole system, so reuse one workspace across calls (and across the
+    /// contact forces of a model) to avoid reallocating them.
+    struct ForceWorkspace {
+        SimTK::Vector_<SimTK::SpatialVec> bodyForces;
+        SimTK::Vector_<SimTK::Vec3> particleForces;
+        SimTK::Vector mobilityForces;
+    };
+    /// Compute the spatial forces (torque, force) that this contact applies to
+    /// the base body of the sphere and to the base body of the half space,
+    /// expressed in ground. These are the values reported by
+    /// getRecordValues(), which allocates on every call; use this method when
+    /// evaluating many contact forces repeatedly (e.g., in a MocoGoal).
+    /// The state must be realized to SimTK::Stage::Velocity.
+    void calcContactForces(const SimTK::State& state,
+            ForceWorkspace& workspace, SimTK::SpatialVec& forceOnSphere,
+            SimTK::SpatialVec& forceOnHalfSpace) const;
+#endif
+
 protected:
     /// Create a SimTK::Force which implements this Force.
     void extendAddToSystem(SimTK::MultibodySystem& system) const override;
@@ -151,6 +175,7 @@ protected:
 private:
     // INITIALIZATION
     void constructProperties();
+    const SimTK::SmoothSphereHalfSpaceForce& getSimTKForce() const;
     mutable double m_forceVizScaleFactor;
 
 //=============================================================================
@@ -0,0 +1,242 @@
+/* -------------------------------------------------------------------------- *
+ *                OpenSim:  StreamingInverseKinematics.cpp                    *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * See http://opensim.stanford.edu and the NOTICE file for more information.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2005-2020 Stanford University and the Authors                *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+#include "StreamingInverseKinematics.h"
+#include "OpenSenseUtilities.h"
+#include <OpenSim/Common/Logger.h>
+#include <OpenSim/Simulation/BufferedOrientationsReference.h>
+#include <OpenSim/Simulation/InverseKinematicsSolver.h>
+#include <OpenSim/Simulation/Model/Model.h>
+#include <OpenSim/Simulation/SimbodyEngine/Coordinate.h>
+#include <algorithm>
+#include <thread>
+
+using namespace OpenSim;
+
+namespace {
+using Clock = std::chrono::steady_clock;
+
+std::chrono::microseconds toMicroseconds(double seconds) {
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::duration<double>(std::max(seconds, 0.0)));
+}
+} // anonymous namespace
+
+StreamingInverseKinematics::StreamingInverseKinematics(const Model& model,
+        const TimeSeriesTable_<SimTK::Rotation>& initialOrientations)
+        : _model(model.clone()),
+          _orientationsReference(
+                  std::make_shared<BufferedOrientationsReference>(
+                          initialOrientations)),
+          _output(DataQueue_<double>::DefaultCapacity,
+                  DataQueueOverflowPolicy::DropOldest) {
+    OPENSIM_THROW_IF(initialOrientations.getNumRows() == 0, Exception,
+            "Expected the initial orientations table to have at least one "
+            "row.");
+    _initialTime = initialOrientations.getIndependentColumn().front();
+
+    _state = _model->initSystem();
+    for (const auto& coord : _model->getComponentList<Coordinate>()) {
+        _coordinates.push_back(&coord);
+        _coordinateNames.push_back(coord.getName());
+    }
+    _values.resize(static_cast<int>(_coordinates.size()));
+    setLatencyHistogram(0.001, 100);
+}
+
+StreamingInverseKinematics::~StreamingInverseKinematics() = default;
+
+void StreamingInverseKinematics::setLatencyHistogram(
+        double binWidth, int numBins) {
+    OPENSIM_THROW_IF(binWidth <= 0 || numBins < 1, Exception,
+            fmt::format("Expected a positive latency bin width and number of "
+                        "bins, but got {} and {}.",
+                    binWidth, numBins));
+    std::lock_guard<std::mutex> lock(_statsMutex);
+    _stats.latencyHistogram.assign(numBins, 0);
+    _stats.latencyBinWidth = binWidth;
+}
+
+void StreamingInverseKinematics::pushFrame(double time,
+        const SimTK::RowVectorView_<SimTK::Rotation>& orientations) {
+    _input.push_back(time, orientations);
+}
+
+void StreamingInverseKinematics::initialize() {
+    if (_ikSolver) return;
+    _ikSolver.reset(new InverseKinematicsSolver(*_model, nullptr,
+            _orientationsReference, _coordinateReferences));
+    _ikSolver->setAccuracy(_accuracy);
+    _state.updTime() = _initialTime;
+    _ikSolver->assemble(_state);
+    // From here on, track() takes each frame (and its time) from the
+    // BufferedOrientationsReference queue.
+    _ikSolver->setAdvanceTimeFromReference(true);
+}
+
+bool StreamingInverseKinematics::step(double timeout) {
+    initialize();
+
+    double time;
+    if (!_input.try_pop_front(time, _frame, toMicroseconds(timeout))) {
+        return false;
+    }
+    std::size_t numSkipped = 0;
+    if (_skipStaleFrames) {
+        while (_input.try_pop_front(time, _frame)) ++numSkipped;
+    }
+    // Time the frame spent waiting in the input queue.
+    const double queueLatency = _input.getStatistics().lastLatency;
+    solveFrame(time, _frame, queueLatency);
+
+    if (numSkipped) {
+        std::lock_guard<std::mutex> lock(_statsMutex);
+        _stats.numFramesSkipped += numSkipped;
+    }
+    return true;
+}
+
+void StreamingInverseKinematics::solveFrame(double time,
+        const SimTK::RowVector_<SimTK::Rotation>& orientations,
+        double queueLatency) {
+    const auto start = Clock::now();
+
+    _orientationsReference->putValues(time, orientations);
+    _ikSolver->track(_state);
+    for (int i = 0; i < _values.size(); ++i) {
+        _values[i] = _coordinates[i]->getValue(_state);
+    }
+    _output.push_back(time, _values);
+    if (_frameCallback) _frameCallback(time, _values);
+
+    const auto end = Clock::now();
+    const double solveTime = std::chrono::duration<double>(end - start).count();
+    const double latency = queueLatency + solveTime;
+
+    std::lock_guard<std::mutex> lock(_statsMutex);
+    if (_stats.numFramesSolved == 0) _firstSolveTime = start;
+    _lastSolveTime = start;
+    ++_stats.numFramesSolved;
+    _totalLatency += latency;
+    _totalSolveTime += solveTime;
+    _stats.maxLatency = std::max(_stats.maxLatency, latency);
+    _stats.maxSolveTime = std::max(_stats.maxSolveTime, solveTime);
+    if (solveTime > _timeBudget) ++_stats.numDeadlineMisses;
+
+    auto& histogram = _stats.latencyHistogram;
+    const double bin = std::min(latency / _stats.latencyBinWidth,
+            static_cast<double>(histogram.size() - 1));
+    ++histogram[static_cast<std::size_t>(bin)];
+}
+
+void StreamingInverseKinematics::run() {
+    // Wait for frames in short slices so that finish() is noticed promptly.
+    const double pollInterval = 0.01;
+    while (true) {
+        if (step(pollInterval)) continue;
+        if (_finished && _input.isEmpty()) break;
+    }
+}
+
+StreamingInverseKinematics::Statistics StreamingInverseKinematics::replay(
+        const TimeSeriesTable_<SimTK::Rotation>& frames,
+        double playbackSpeed) {
+    OPENSIM_THROW_IF(static_cast<int>(frames.getNumColumns()) !=
+                             _orientationsReference->getNumRefs(),
+            Exception,
+            fmt::format("Expected {} orientation columns to replay, but got "
+                        "{}.",
+                    _orientationsReference->getNumRefs(),
+                    frames.getNumColumns()));
+    initialize();
+    _finished = false;
+
+    const auto& times = frames.getIndependentColumn();
+    std::thread producer([&] {
+        const auto start = Clock::now();
+        for (size_t i = 0; i < times.size(); ++i) {
+            if (playbackSpeed > 0) {
+                std::this_thread::sleep_until(start +
+                        std::chrono::duration_cast<Clock::duration>(
+                                std::chrono::duration<double>(
+                                        (times[i] - times.front()) /
+                                        playbackSpeed)));
+            }
+            pushFrame(times[i], frames.getRowAtIndex(i));
+        }
+        finish();
+    });
+
+    try {
+        run();
+    } catch (...) {
+        // Keep the producer from blocking on a full queue nobody drains.
+        _input.setOverflowPolicy(DataQueueOverflowPolicy::DropOldest);
+        producer.join();
+        throw;
+    }
+    producer.join();
+
+    const Statistics stats = getStatistics();
+    log_info("Replayed {} frames: solved {}, skipped {}, {:.1f} frames/s, "
+             "mean latency {:.2f} ms, max latency {:.2f} ms, {} deadline "
+             "misses.",
+            times.size(), stats.numFramesSolved, stats.numFramesSkipped,
+            stats.getFrameRate(), 1000 * stats.meanLatency,
+            1000 * stats.maxLatency, stats.numDeadlineMisses);
+    return stats;
+}
+
+StreamingInverseKinematics::Statistics StreamingInverseKinematics::replay(
+        const std::string& quaternionsFile, double playbackSpeed) {
+    log_info("Loading orientations as quaternions from '{}'...",
+            quaternionsFile);
+    TimeSeriesTable_<SimTK::Quaternion> quatTable(quaternionsFile);
+    return replay(OpenSenseUtilities::convertQuaternionsToRotations(quatTable),
+            playbackSpeed);
+}
+
+StreamingInverseKinematics::Statistics
+StreamingInverseKinematics::getStatistics() const {
+    std::lock_guard<std::mutex> lock(_statsMutex);
+    Statistics stats = _stats;
+    if (stats.numFramesSolved) {
+        stats.meanLatency = _totalLatency / stats.numFramesSolved;
+        stats.meanSolveTime = _totalSolveTime / stats.numFramesSolved;
+        stats.elapsedTime = std::chrono::duration<double>(
+                _lastSolveTime - _firstSolveTime).count();
+    }
+    return stats;
+}
+
+void StreamingInverseKinematics::resetStatistics() {
+    std::lock_guard<std::mutex> lock(_statsMutex);
+    std::fill(_stats.latencyHistogram.begin(), _stats.latencyHistogram.end(),
+            0);
+    _stats.numFramesSolved = 0;
+    _stats.numFramesSkipped = 0;
+    _stats.numDeadlineMisses = 0;
+    _stats.maxLatency = 0;
+    _stats.maxSolveTime = 0;
+    _totalLatency = 0;
+    _totalSolveTime = 0;
+    _input.resetStatistics();
+}
@@ -0,0 +1,216 @@
+#ifndef OPENSIM_STREAMING_INVERSE_KINEMATICS_H_
+#define OPENSIM_STREAMING_INVERSE_KINEMATICS_H_
+/* -------------------------------------------------------------------------- *
+ *                 OpenSim:  StreamingInverseKinematics.h                     *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * See http://opensim.stanford.edu and the NOTICE file for more information.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2005-2020 Stanford University and the Authors                *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+#include <OpenSim/Common/DataQueue.h>
+#include <OpenSim/Common/TimeSeriesTable.h>
+#include <OpenSim/Simulation/CoordinateReference.h>
+#include <OpenSim/Simulation/osimSimulationDLL.h>
+#include <Simbody.h>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace OpenSim {
+
+class BufferedOrientationsReference;
+class Coordinate;
+class InverseKinematicsSolver;
+class Model;
+
+//=============================================================================
+//=============================================================================
+/**
+ * Solve inverse kinematics on a live stream of IMU orientation frames.
+ *
+ * A producer (e.g., a sensor SDK callback, or replay() for offline
+ * benchmarking) calls pushFrame() for every frame it receives. A consumer
+ * thread calls run(), or step() from its own loop, to track each frame with
+ * an InverseKinematicsSolver and publish the solved coordinate values, in
+ * the order of the model's coordinates, to the frame callback and to the
+ * output queue.
+ *
+ * When the solver falls behind, frames that have been superseded by newer
+ * ones are skipped (see setSkipStaleFrames()), so the published pose tracks
+ * the most recent data rather than drifting further behind. Each solved
+ * frame's latency, from pushFrame() until it is published, is recorded in a
+ * histogram, and solves that exceed the per-frame time budget are counted as
+ * deadline misses.
+ *
+ * The model must contain frames named after the columns of the initial
+ * orientations table (as placed by IMUPlacer), and that table is used to
+ * assemble the model before the first streamed frame is tracked.
+ */
+class OSIMSIMULATION_API StreamingInverseKinematics {
+public:
+    /** Called with the time and coordinate values of every solved frame. */
+    using FrameCallback =
+            std::function<void(double time, const SimTK::RowVector& values)>;
+
+    /** Counters describing the frames processed so far. Times are wall-clock
+     * seconds. */
+    struct Statistics {
+        std::size_t numFramesSolved{0};
+        std::size_t numFramesSkipped{0};
+        std::size_t numDeadlineMisses{0};
+        double meanLatency{0};
+        double maxLatency{0};
+        double meanSolveTime{0};
+        double maxSolveTime{0};
+        /** Wall-clock time from the first to the last solved frame. */
+        double elapsedTime{0};
+        /** latencyHistogram[i] counts frames with a latency in
+         * [i, i + 1) * latencyBinWidth; the last bin also holds all
+         * larger latencies. */
+        std::vector<std::size_t> latencyHistogram;
+        double latencyBinWidth{0};
+
+        /** Sustained number of solved frames per wall-clock second. */
+        double getFrameRate() const {
+            return elapsedTime > 0 ? (numFramesSolved - 1) / elapsedTime : 0;
+        }
+    };
+
+    StreamingInverseKinematics(const Model& model,
+            const TimeSeriesTable_<SimTK::Rotation>& initialOrientations);
+    ~StreamingInverseKinematics();
+
+    StreamingInverseKinematics(const StreamingInverseKinematics&) = delete;
+    StreamingInverseKinematics& operator=(
+            const StreamingInverseKinematics&) = delete;
+
+    /// @name Settings
+    /// These must be set before the first frame is solved.
+    /// @{
+    /** Accuracy passed to InverseKinematicsSolver::setAccuracy(). Default
+     * 1e-4. */
+    void setAccuracy(double accuracy) { _accuracy = accuracy; }
+    /** Wall-clock seconds allotted to solving one frame. Solves that take
+     * longer are counted as deadline misses. Default is Infinity. */
+    void setTimeBudget(double seconds) { _timeBudget = seconds; }
+    /** If true (the default), frames queued behind a newer frame are skipped
+     * when the solver is behind and only the newest one is tracked. */
+    void setSkipStaleFrames(bool skip) { _skipStaleFrames = skip; }
+    /** Bin width (seconds) and number of bins of the latency histogram.
+     * Default: 100 bins of 1 ms. */
+    void setLatencyHistogram(double binWidth, int numBins);
+    /** Invoked from the consumer thread for every solved frame. */
+    void setFrameCallback(FrameCallback callback) {
+        _frameCallback = std::move(callback);
+    }
+    /// @}
+
+    /// @name Streaming
+    /// @{
+    /** Queue a frame of sensor orientations, with columns in the order of
+     * the initial orientations table. Safe to call from a producer thread
+     * while another thread runs the solver. If the input queue is full, its
+     * oldest frame is dropped. */
+    void pushFrame(double time,
+            const SimTK::RowVectorView_<SimTK::Rotation>& orientations);
+    /** Signal that no more frames will be pushed; run() returns once the
+     * queued frames have been processed. */
+    void finish() { _finished = true; }
+
+    /** Wait at most timeout seconds for a frame, then solve and publish the
+     * next frame (the newest queued one if stale frames are skipped).
+     * Returns false if no frame arrived in time. */
+    bool step(double timeout = 0);
+    /** Solve frames as they arrive until finish() is called and the input
+     * queue is drained. */
+    void run();
+
+    /** Push the rows of frames from a producer thread and solve them on the
+     * calling thread, to benchmark sustained frame rate offline. If
+     * playbackSpeed is positive, frames are paced against the wall clock
+     * (1 is real time); otherwise they are pushed as fast as the input queue
+     * accepts them. */
+    Statistics replay(const TimeSeriesTable_<SimTK::Rotation>& frames,
+            double playbackSpeed = 0);
+    /** Replay a .sto file of sensor orientations as quaternions, already
+     * expressed in the OpenSim ground frame. */
+    Statistics replay(const std::string& quaternionsFile,
+            double playbackSpeed = 0);
+    /// @}
+
+    /// @name Results
+    /// @{
+    const Model& getModel() const { return *_model; }
+    /** The model state after the most recently solved frame. */
+    const SimTK::State& getState() const { return _state; }
+    /** Names of the published coordinate values, in order. */
+    const std::vector<std::string>& getCoordinateNames() const {
+        return _coordinateNames;
+    }
+    /** Solved coordinate values of every frame, in addition to the frame
+     * callback. The queue drops its oldest rows when full so that a client
+     * that never reads it cannot stall the solver. */
+    DataQueue_<double>& updOutputQueue() { return _output; }
+    /** Safe to call while another thread is solving. */
+    Statistics getStatistics() const;
+    void resetStatistics();
+    /// @}
+
+private:
+    void initialize();
+    void solveFrame(double time,
+            const SimTK::RowVector_<SimTK::Rotation>& orientations,
+            double queueLatency);
+
+    std::unique_ptr<Model> _model;
+    SimTK::State _state;
+    std::shared_ptr<BufferedOrientationsReference> _orientationsReference;
+    SimTK::Array_<CoordinateReference> _coordinateReferences;
+    std::unique_ptr<InverseKinematicsSolver> _ikSolver;
+    std::vector<const Coordinate*> _coordinates;
+    std::vector<std::string> _coordinateNames;
+    double _initialTime;
+
+    double _accuracy{1e-4};
+    double _timeBudget{SimTK::Infinity};
+    bool _skipStaleFrames{true};
+    FrameCallback _frameCallback;
+
+    DataQueue_<SimTK::Rotation> _input;
+    DataQueue_<double> _output;
+    std::atomic<bool> _finished{false};
+
+    // Reused for every frame to avoid allocating while streaming.
+    SimTK::RowVector_<SimTK::Rotation> _frame;
+    SimTK::RowVector _values;
+
+    // Guards _stats so it can be read while another thread is solving.
+    mutable std::mutex _statsMutex;
+    Statistics _stats;
+    double _totalLatency{0};
+    double _totalSolveTime{0};
+    std::chrono::steady_clock::time_point _firstSolveTime;
+    std::chrono::steady_clock::time_point _lastSolveTime;
+};
+
+} // namespace OpenSim
+
+#endif // OPENSIM_STREAMING_INVERSE_KINEMATICS_H_
@@ -27,8 +27,11 @@
 //      1. Analytical contact sphere-plane geometry 
 //      2. Mesh-based sphere on analytical plane geometry
 //      3. Intermediate frames are handled correctly.
+//      4. Loaded meshes are reused by copies and reloaded when needed.
 //
 //==============================================================================
+#include <cstdio>
+#include <fstream>
 #include <iostream>
 #include <OpenSim/Common/IO.h>
 #include <OpenSim/Common/Exception.h>
@@ -77,6 +80,7 @@ int testBallToBallContact(bool useElasticFoundation, bool useMesh1, bool useMesh
 void compareHertzAndMeshContactResults();
 template <typename ContactType> // e.g., HuntCrossley.
 void testIntermediateFrames();
+void testContactMeshReuse();
 
 int main()
 {
@@ -97,6 +101,8 @@ int main()
 
         testIntermediateFrames<OpenSim::HuntCrossleyForce>();
         testIntermediateFrames<OpenSim::ElasticFoundationForce>();
+
+        testContactMeshReuse();
     }
     catch (const OpenSim::Exception& e) {
         e.print(cerr);
@@ -595,6 +601,133 @@ void testIntermediateFrames() {
     SimTK_TEST_EQ_TOL(stateWeld.getY(), stateIntermedFrameXY.getY(), 1e-10);
 }
 
+// Records the number of vertices of the DecorativeMeshes it is given.
+class DecorativeMeshVertexCounter
+        : public SimTK::DecorativeGeometryImplementation {
+public:
+    std::vector<int> numVertices;
+    void implementMeshGeometry(const DecorativeMesh& dm) override {
+        numVertices.push_back(dm.getMesh().getNumVertices());
+    }
+    void implementPointGeometry(const DecorativePoint&) override {}
+    void implementLineGeometry(const DecorativeLine&) override {}
+    void implementBrickGeometry(const DecorativeBrick&) override {}
+    void implementCylinderGeometry(const DecorativeCylinder&) override {}
+    void implementCircleGeometry(const DecorativeCircle&) override {}
+    void implementSphereGeometry(const DecorativeSphere&) override {}
+    void implementEllipsoidGeometry(const DecorativeEllipsoid&) override {}
+    void implementFrameGeometry(const DecorativeFrame&) override {}
+    void implementTextGeometry(const DecorativeText&) override {}
+    void implementMeshFileGeometry(const DecorativeMeshFile&) override {}
+    void implementArrowGeometry(const DecorativeArrow&) override {}
+    void implementTorusGeometry(const DecorativeTorus&) override {}
+    void implementConeGeometry(const DecorativeCone&) override {}
+};
+
+void testContactMeshReuse() {
+    cout << "Testing reuse and reloading of ContactMesh files" << endl;
+
+    auto copyFile = [](const string& from, const string& to) {
+        std::ifstream in(from, std::ios::binary);
+        std::ofstream out(to, std::ios::binary);
+        out << in.rdbuf();
+    };
+    // Initialize the model, and check the number of vertices of the contact
+    // geometry and of the decoration of its ContactMesh.
+    auto testNumVertices = [](Model& model, int expected) {
+        SimTK::State state = model.initSystem();
+        model.realizePosition(state);
+        const auto& mesh = model.getComponent<ContactMesh>("mesh");
+        const auto geometry = mesh.createSimTKContactGeometry();
+        SimTK_TEST(SimTK::ContactGeometry::TriangleMesh::getAs(geometry)
+                           .getNumVertices() == expected);
+        SimTK::Array_<SimTK::DecorativeGeometry> decorations;
+        mesh.generateDecorations(
+                false, model.getDisplayHints(), state, decorations);
+        DecorativeMeshVertexCounter counter;
+        for (const auto& decoration : decorations) {
+            decoration.implementGeometry(counter);
+        }
+        SimTK_TEST(counter.numVertices.size() == 1);
+        SimTK_TEST(counter.numVertices[0] == expected);
+    };
+    const int numCubeVertices = 8;
+    const int numSphereVertices = 362;
+
+    // A copy of a model uses the mesh already loaded by the original, even
+    // if the file no longer exists.
+    {
+        copyFile("cube.obj", "contact_mesh_reuse.obj");
+        Model model;
+        auto* mesh = new ContactMesh();
+        mesh->setName("mesh");
+        mesh->setFilename("contact_mesh_reuse.obj");
+        mesh->setFrame(model.getGround());
+        model.addContactGeometry(mesh);
+        testNumVertices(model, numCubeVertices);
+
+        std::remove("contact_mesh_reuse.obj");
+        Model copy = model;
+        testNumVertices(copy, numCubeVertices);
+        testNumVertices(model, numCubeVertices);
+
+        // Changing the filename property reloads the mesh and its
+        // decoration.
+        copyFile("sphere.obj", "contact_mesh_reuse_sphere.obj");
+        copy.updComponent<ContactMesh>("mesh").set_filename(
+                "contact_mesh_reuse_sphere.obj");
+        testNumVertices(copy, numSphereVertices);
+        // The original is unaffected.
+        testNumVertices(model, numCubeVertices);
+        std::remove("contact_mesh_reuse_sphere.obj");
+    }
+
+    // Modifying the mesh file on disk reloads the mesh in the next
+    // initSystem().
+    {
+        copyFile("cube.obj", "contact_mesh_reuse_modified.obj");
+        Model model;
+        auto* mesh = new ContactMesh();
+        mesh->setName("mesh");
+        mesh->setFilename("contact_mesh_reuse_modified.obj");
+        mesh->setFrame(model.getGround());
+        model.addContactGeometry(mesh);
+        testNumVertices(model, numCubeVertices);
+        Model copy = model;
+
+        copyFile("sphere.obj", "contact_mesh_reuse_modified.obj");
+        testNumVertices(model, numSphereVertices);
+        testNumVertices(copy, numSphereVertices);
+        std::remove("contact_mesh_reuse_modified.obj");
+    }
+
+    // A relative filename is reloaded if the model is assigned a model file
+    // in a different directory.
+    {
+        IO::makeDir("contact_mesh_reuse_a");
+        IO::makeDir("contact_mesh_reuse_b");
+        copyFile("cube.obj", "contact_mesh_reuse_a/mesh.obj");
+        copyFile("sphere.obj", "contact_mesh_reuse_b/mesh.obj");
+        {
+            Model model;
+            auto* mesh = new ContactMesh();
+            mesh->setName("mesh");
+            mesh->setFilename("mesh.obj");
+            mesh->setFrame(model.getGround());
+            model.addContactGeometry(mesh);
+            model.finalizeConnections();
+            model.print("contact_mesh_reuse_a/model.osim");
+        }
+        Model model("contact_mesh_reuse_a/model.osim");
+        testNumVertices(model, numCubeVertices);
+
+        Model copy = model;
+        copy.setInputFileName("contact_mesh_reuse_b/model.osim");
+        testNumVertices(copy, numSphereVertices);
+        testNumVertices(model, numCubeVertices);
+    }
+}
+
 
 
 
@@ -57,6 +57,7 @@ const static SimTK::Vec3 gravity_vec = SimTK::Vec3(0, -9.8065, 0);
 
 void testPathSpring();
 void testExternalForce();
+void testExternalForceLoadsCache();
 void testSpringMass();
 void testBushingForce();
 void testTwoFrameLinkerUpdateFromXMLNode();
@@ -88,6 +89,12 @@ int main() {
         cout << e.what() <<endl; failures.push_back("testExternalForce");
     }
 
+    try { testExternalForceLoadsCache(); }
+    catch (const std::exception& e){
+        cout << e.what() <<endl;
+        failures.push_back("testExternalForceLoadsCache");
+    }
+
     try { testSpringMass(); }
     catch (const std::exception& e){
         cout << e.what() <<endl; failures.push_back("testP2PSpringMass");
@@ -1912,6 +1919,89 @@ void testExternalForce() {
     }
 }
 
+// Force, point, and torque data that vary with time, so that loads evaluated
+// at the wrong time or from the wrong data source are detected.
+Storage createExternalForceData(const std::string& name, double scale) {
+    Storage data;
+    data.setName(name);
+    Array<std::string> labels;
+    labels.append("time");
+    for (std::string prefix : {"force", "point", "torque"}) {
+        for (std::string axis : {".X", ".Y", ".Z"}) {
+            labels.append(prefix + axis);
+        }
+    }
+    data.setColumnLabels(labels);
+    for (int i = 0; i <= 20; ++i) {
+        const double time = 0.1 * i;
+        SimTK::Vector row(9);
+        for (int j = 0; j < 9; ++j) {
+            row[j] = scale * (j + 1) * std::sin(3 * time + 0.3 * j);
+        }
+        data.append(time, row);
+    }
+    return data;
+}
+
+void testExternalForceLoadsCache() {
+    using namespace SimTK;
+
+    Model model;
+    auto* body = new OpenSim::Body("body", 1, Vec3(0), Inertia(1));
+    model.addBody(body);
+    model.addJoint(new FreeJoint("joint", model.getGround(), *body));
+
+    Storage data = createExternalForceData("data", 1);
+    auto* xf = new ExternalForce(
+            data, "force", "point", "torque", "body", "ground", "ground");
+    model.addForce(xf);
+
+    // The record values (force and torque in ground, point in the body, which
+    // coincides with ground in the default pose) come from the loads cached
+    // by computeForce(); get*AtTime() evaluate the splines without the cache.
+    auto checkLoads = [&](const SimTK::State& state) {
+        model.realizeDynamics(state);
+        const double time = state.getTime();
+        const Array<double> values = xf->getRecordValues(state);
+        ASSERT(values.getSize() == 9);
+        const Vec3 expected[3] = {xf->getForceAtTime(time),
+                xf->getPointAtTime(time), xf->getTorqueAtTime(time)};
+        for (int i = 0; i < 3; ++i) {
+            for (int j = 0; j < 3; ++j) {
+                ASSERT_EQUAL(expected[i][j], values[3 * i + j], 1e-12);
+            }
+        }
+    };
+
+    // Times on the knots, between the knots, outside the data range, and
+    // going back in time, which must not reuse the loads of a later time.
+    const std::vector<double> times{
+            0.0, 0.25, 0.5, 1.234, 2.0, 2.5, -0.1, 0.25, 0.25};
+    SimTK::State& state = model.initSystem();
+    for (double time : times) {
+        state.setTime(time);
+        checkLoads(state);
+    }
+    const Vec3 origForce = xf->getForceAtTime(0.25);
+
+    // Change the data source after the model was connected. Connecting the
+    // model again rebuilds the splines, and the loads must follow the new
+    // data source.
+    Storage scaledData = createExternalForceData("scaled_data", -2);
+    xf->setDataSource(scaledData);
+    SimTK::State& scaledState = model.initSystem();
+    for (double time : times) {
+        scaledState.setTime(time);
+        checkLoads(scaledState);
+    }
+    scaledState.setTime(0.25);
+    model.realizeDynamics(scaledState);
+    const Array<double> values = xf->getRecordValues(scaledState);
+    for (int j = 0; j < 3; ++j) {
+        ASSERT_EQUAL(-2 * origForce[j], values[j], 1e-9);
+    }
+}
+
 void testSerializeDeserialize() {
     std::cout << "Test serialize & deserialize." << std::endl;
 
@@ -37,6 +37,11 @@ Manager Tests:
 4. testConstructors: Ensure different constructors work as intended.
 5. testIntegratorInterface: Ensure setting integrator options works as intended.
 6. testExceptions: Test that misuse actually triggers exceptions.
+7. testAsynchronousRecording: Recording analyses on a separate thread, with a
+   copy of the Model, produces the same states, controls and analysis results
+   as recording on the integrator thread.
+8. testComponentProfiler: The profiler records the muscles' computeForce()
+   calls during integration, and nothing while disabled.
 
 //=============================================================================*/
 #include <OpenSim/Simulation/Model/Model.h>
@@ -47,6 +52,12 @@ Manager Tests:
 #include <OpenSim/Common/LoadOpenSimLibrary.h>
 #include <OpenSim/Simulation/Control/PrescribedController.h>
 #include <OpenSim/Common/Constant.h>
+#include <OpenSim/Common/ComponentProfiler.h>
+#include <OpenSim/Analyses/ForceReporter.h>
+#include <OpenSim/Analyses/JointReaction.h>
+#include <OpenSim/Analyses/Kinematics.h>
+#include <OpenSim/Analyses/MuscleAnalysis.h>
+#include <fstream>
 
 using namespace OpenSim;
 using namespace std;
@@ -56,6 +67,8 @@ void testExcitationUpdatesWithManager();
 void testConstructors();
 void testIntegratorInterface();
 void testExceptions();
+void testAsynchronousRecording();
+void testComponentProfiler();
 
 int main()
 {
@@ -97,6 +110,18 @@ int main()
         failures.push_back("testExceptions");
     }
 
+    try { testAsynchronousRecording(); }
+    catch (const std::exception& e) {
+        cout << e.what() << endl;
+        failures.push_back("testAsynchronousRecording");
+    }
+
+    try { testComponentProfiler(); }
+    catch (const std::exception& e) {
+        cout << e.what() << endl;
+        failures.push_back("testComponentProfiler");
+    }
+
     if (!failures.empty()) {
         cout << "Done, with failure(s): " << failures << endl;
         return 1;
@@ -478,3 +503,151 @@ void testExceptions()
     manager.setIntegratorAccuracy(1e-4);
     manager.setIntegratorMinimumStepSize(0.01);
 }
+
+void testAsynchronousRecording()
+{
+    cout << "Running testAsynchronousRecording" << endl;
+    LoadOpenSimLibrary("osimActuators");
+    Model arm("arm26.osim");
+
+    PrescribedController* controller = new PrescribedController();
+    controller->addActuator(arm.getMuscles().get(0));
+    controller->prescribeControlForActuator(0, new Constant(0.5));
+    arm.addController(controller);
+
+    // All of these analyses record on the worker's copy of the Model.
+    ForceReporter* forceReporter = new ForceReporter(&arm);
+    arm.addAnalysis(forceReporter);
+    Kinematics* kinematics = new Kinematics(&arm);
+    arm.addAnalysis(kinematics);
+    MuscleAnalysis* muscleAnalysis = new MuscleAnalysis(&arm);
+    arm.addAnalysis(muscleAnalysis);
+    JointReaction* jointReaction = new JointReaction(&arm);
+    arm.addAnalysis(jointReaction);
+    SimTK_TEST(forceReporter->canRecordOnModelCopy());
+    SimTK_TEST(kinematics->canRecordOnModelCopy());
+    SimTK_TEST(muscleAnalysis->canRecordOnModelCopy());
+    SimTK_TEST(jointReaction->canRecordOnModelCopy());
+
+    SimTK::State& state = arm.initSystem();
+    const double finalTime = 0.2;
+
+    Manager syncManager(arm);
+    syncManager.initialize(state);
+    syncManager.integrate(finalTime);
+    const TimeSeriesTable syncStates = syncManager.getStatesTable();
+    const TimeSeriesTable syncControls = arm.getControlsTable();
+    const TimeSeriesTable syncForces = forceReporter->getForcesTable();
+    const TimeSeriesTable syncAccelerations =
+            kinematics->getAccelerationStorage()->exportToTable();
+    const TimeSeriesTable syncFiberForces =
+            muscleAnalysis->getFiberForceStorage()->exportToTable();
+    const TimeSeriesTable syncMomentArms = muscleAnalysis->
+            getMomentArmStorageArray()[0]->momentArmStore->exportToTable();
+    const TimeSeriesTable syncReactionLoads =
+            jointReaction->getStorageList()[0]->exportToTable();
+
+    // A capacity of 2 forces the integrator to wait on the recorder.
+    Manager asyncManager(arm);
+    asyncManager.setRecordAsynchronously(true, 2);
+    SimTK_TEST(asyncManager.getRecordAsynchronously());
+    asyncManager.initialize(state);
+    asyncManager.integrate(finalTime);
+    const TimeSeriesTable asyncStates = asyncManager.getStatesTable();
+    const TimeSeriesTable asyncControls = arm.getControlsTable();
+    const TimeSeriesTable asyncForces = forceReporter->getForcesTable();
+    const TimeSeriesTable asyncAccelerations =
+            kinematics->getAccelerationStorage()->exportToTable();
+    const TimeSeriesTable asyncFiberForces =
+            muscleAnalysis->getFiberForceStorage()->exportToTable();
+    const TimeSeriesTable asyncMomentArms = muscleAnalysis->
+            getMomentArmStorageArray()[0]->momentArmStore->exportToTable();
+    const TimeSeriesTable asyncReactionLoads =
+            jointReaction->getStorageList()[0]->exportToTable();
+
+    SimTK_TEST(syncStates.getNumRows() > 2);
+    SimTK_TEST(asyncStates.getNumRows() == syncStates.getNumRows());
+    SimTK_TEST(asyncStates.getColumnLabels() == syncStates.getColumnLabels());
+    for (size_t i = 0; i < syncStates.getNumRows(); ++i) {
+        SimTK_TEST_EQ(asyncStates.getIndependentColumn()[i],
+                syncStates.getIndependentColumn()[i]);
+    }
+    SimTK_TEST_EQ(asyncStates.getMatrix(), syncStates.getMatrix());
+    SimTK_TEST(asyncControls.getNumRows() == syncControls.getNumRows());
+    SimTK_TEST_EQ(asyncControls.getMatrix(), syncControls.getMatrix());
+    SimTK_TEST(asyncForces.getNumRows() == syncForces.getNumRows());
+    SimTK_TEST_EQ(asyncForces.getMatrix(), syncForces.getMatrix());
+    SimTK_TEST(asyncAccelerations.getNumRows() ==
+            syncAccelerations.getNumRows());
+    SimTK_TEST_EQ(asyncAccelerations.getMatrix(),
+            syncAccelerations.getMatrix());
+    SimTK_TEST(asyncFiberForces.getNumRows() == syncFiberForces.getNumRows());
+    SimTK_TEST_EQ(asyncFiberForces.getMatrix(), syncFiberForces.getMatrix());
+    SimTK_TEST(asyncMomentArms.getNumRows() == syncMomentArms.getNumRows());
+    SimTK_TEST_EQ(asyncMomentArms.getMatrix(), syncMomentArms.getMatrix());
+    SimTK_TEST(syncReactionLoads.getNumRows() > 2);
+    SimTK_TEST(asyncReactionLoads.getNumRows() ==
+            syncReactionLoads.getNumRows());
+    SimTK_TEST_EQ(asyncReactionLoads.getMatrix(),
+            syncReactionLoads.getMatrix());
+
+    ASSERT_THROW(Exception, asyncManager.setRecordAsynchronously(true, 0));
+}
+
+void testComponentProfiler()
+{
+    cout << "Running testComponentProfiler" << endl;
+    LoadOpenSimLibrary("osimActuators");
+    Model arm("arm26.osim");
+    SimTK::State& state = arm.initSystem();
+    const std::string musclePath =
+            arm.getMuscles().get(0).getAbsolutePathString();
+
+    ComponentProfiler::reset();
+    {
+        Manager manager(arm);
+        manager.initialize(state);
+        manager.integrate(0.05);
+    }
+    // Nothing is recorded while the profiler is disabled.
+    SimTK_TEST(ComponentProfiler::getResults().empty());
+
+    ComponentProfiler::setEnabled(true);
+    ComponentProfiler::setTraceEnabled(true);
+    {
+        Manager manager(arm);
+        manager.initialize(state);
+        manager.integrate(0.1);
+    }
+    ComponentProfiler::setEnabled(false);
+    ComponentProfiler::setTraceEnabled(false);
+
+    const auto results = ComponentProfiler::getResults();
+    SimTK_TEST(!results.empty());
+    bool foundMuscleForce = false;
+    for (size_t i = 0; i < results.size(); ++i) {
+        const auto& result = results[i];
+        SimTK_TEST(result.count > 0);
+        SimTK_TEST(result.maxTimeInNs <= result.totalTimeInNs);
+        if (i > 0) {
+            SimTK_TEST(result.totalTimeInNs <= results[i - 1].totalTimeInNs);
+        }
+        if (result.componentPath == musclePath &&
+                result.category == ComponentProfiler::Category::ComputeForce) {
+            foundMuscleForce = true;
+        }
+    }
+    SimTK_TEST(foundMuscleForce);
+    ComponentProfiler::printReport(10);
+
+    const std::string traceFile = "testManager_componentProfiler.json";
+    ComponentProfiler::writeChromeTrace(traceFile);
+    std::ifstream trace(traceFile);
+    std::string contents((std::istreambuf_iterator<char>(trace)),
+            std::istreambuf_iterator<char>());
+    SimTK_TEST(contents.find("{\"traceEvents\":[") == 0);
+    SimTK_TEST(contents.find(musclePath) != std::string::npos);
+
+    ComponentProfiler::reset();
+    SimTK_TEST(ComponentProfiler::getResults().empty());
+}
@@ -125,6 +125,7 @@
 #include "StatesTrajectoryReporter.h"
 #include "TableProcessor.h"
 #include "OpenSense/OpenSenseUtilities.h"
+#include "OpenSense/StreamingInverseKinematics.h"
 
 #include "SimulationUtilities.h"
 
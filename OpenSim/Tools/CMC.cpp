@@ -154,6 +154,7 @@ void CMC::copyData( const CMC &aCmc )
    _taskSet               = aCmc._taskSet;
    _paramList             = aCmc._paramList;
    _verbose               = aCmc._verbose;
+   _reuseActuatorEvaluations = aCmc._reuseActuatorEvaluations;
    _predictor             = aCmc._predictor;
    _f                     = aCmc._f;
    _taskSet               = aCmc._taskSet;
@@ -202,6 +203,7 @@ setNull()
     _vErrStore.reset();
     _stressTermWeightStore.reset();
     _useCurvatureFilter = false;
+    _reuseActuatorEvaluations = true;
     _verbose = false;
     _paramList.setSize(0);
     _controlSet.setSize(0);
@@ -852,6 +854,9 @@ computeControls(SimTK::State& s, ControlSet &controlSet)
     _predictor->setInitialTime(tiReal);
     _predictor->setFinalTime(tfReal);
     _predictor->setTargetForces(&zero[0]);
+    // The root solve below starts from the same bounds, so let it reuse
+    // these integrations of the actuator system.
+    _predictor->setReuseEvaluations(_reuseActuatorEvaluations);
     _predictor->evaluate(s, &xmin[0], &fmin[0]);
     _predictor->evaluate(s, &xmax[0], &fmax[0]);
 
@@ -925,6 +930,7 @@ computeControls(SimTK::State& s, ControlSet &controlSet)
                    
             log_error(msg.str());
 
+         _predictor->setReuseEvaluations(false);
          throw(new OpenSim::Exception(msg.str(), __FILE__,__LINE__));
         }
     } else {
@@ -946,6 +952,7 @@ computeControls(SimTK::State& s, ControlSet &controlSet)
     Array<double> fErrors(0.0,N);
     Array<double> controls(0.0,N);
     controls = rootSolver.solve(s, xmin,xmax,tol);
+    _predictor->setReuseEvaluations(false);
     if(_verbose) {
         log_info("CMC::computeControls, root solve (tFinal = {}):", _tf);
         log_info(" -- controls = {}", _tf, controls);
@@ -985,6 +992,29 @@ getUseCurvatureFilter() const
 {
     return(_useCurvatureFilter);
 }
+//_____________________________________________________________________________
+/**
+ * Set whether the actuator force predictor may reuse integrations of the
+ * actuator system for controls it has already evaluated in the same time
+ * step. Reuse does not change the computed controls.
+ *
+ * @param aTrueFalse If true, reuse integrations (the default).
+ */
+void CMC::
+setReuseActuatorEvaluations(bool aTrueFalse)
+{
+    _reuseActuatorEvaluations = aTrueFalse;
+}
+//_____________________________________________________________________________
+/**
+ * Get whether the actuator force predictor may reuse integrations of the
+ * actuator system.
+ */
+bool CMC::
+getReuseActuatorEvaluations() const
+{
+    return(_reuseActuatorEvaluations);
+}
 
 const CMC_TaskSet& CMC::getTaskSet() const{
    return( *_taskSet );
@@ -127,6 +127,9 @@ protected:
     bool _verbose;
  
     bool _useCurvatureFilter;
+    /** Flag indicating whether the actuator force predictor may reuse its
+    integrations within a time step. */
+    bool _reuseActuatorEvaluations;
     CMC_TaskSet *_taskSet;
 
     /** Vector function for estimating actuator forces over a specified time
@@ -181,6 +184,8 @@ public:
     bool getUseVerbosePrinting() const;
     void setUseCurvatureFilter(bool aTrueFalse);
     bool getUseCurvatureFilter() const;
+    void setReuseActuatorEvaluations(bool aTrueFalse);
+    bool getReuseActuatorEvaluations() const;
     const CMC_TaskSet& getTaskSet() const;
     CMC_TaskSet& updTaskSet() const;
 
@@ -208,6 +208,7 @@ setNull()
     _maxIterations = 1000;
     _printLevel = 0;
     _verbose = false;
+    _reuseActuatorEvaluations = true;
 
     _replaceForceSet = false;   // default should be false for Forward.
     _solveForEquilibriumForAuxiliaryStates = true;
@@ -365,6 +366,7 @@ operator=(const CMCTool &aTool)
     _maxIterations = aTool._maxIterations;
     _printLevel = aTool._printLevel;
     _verbose = aTool._verbose;
+    _reuseActuatorEvaluations = aTool._reuseActuatorEvaluations;
 
     return(*this);
 }
@@ -418,6 +420,7 @@ bool CMCTool::run()
     _model->addController(controller );
     controller->setEnabled(true);
     controller->setUseCurvatureFilter(false);
+    controller->setReuseActuatorEvaluations(_reuseActuatorEvaluations);
     controller->setTargetDT(_targetDT);
     controller->setCheckTargetTime(true);
 
@@ -125,6 +125,10 @@ private:
 
     ForceSet _originalForceSet;
 
+    /** Flag indicating whether CMC reuses integrations of the actuator
+    system within a time step (not serialized). */
+    bool _reuseActuatorEvaluations;
+
 //=============================================================================
 // METHODS
 //=============================================================================
@@ -196,6 +200,16 @@ public:
     bool getUseVerbosePrinting() const {return _verbose;};
     void setUseVerbosePrinting(bool verbose) const { _verbose=verbose;};
 
+    /** Whether CMC reuses integrations of the actuator system for controls
+    it has already evaluated within a time step (default true). The
+    computed controls are the same either way. */
+    bool getReuseActuatorEvaluations() const {
+        return _reuseActuatorEvaluations;
+    }
+    void setReuseActuatorEvaluations(bool reuse) {
+        _reuseActuatorEvaluations = reuse;
+    }
+
 
     //--------------------------------------------------------------------------
     // INTERFACE
@@ -29,6 +29,7 @@
 #include <OpenSim/Simulation/Model/CMCActuatorSubsystem.h>
 #include <OpenSim/Simulation/Model/Model.h>
 #include "CMC.h"
+#include <algorithm>
 
 
 using namespace OpenSim;
@@ -43,6 +44,7 @@ using namespace std;
  */
 VectorFunctionForActuators::~VectorFunctionForActuators()
 {
+    delete _integrator;
 }
 //_____________________________________________________________________________
 /**
@@ -99,6 +101,7 @@ setNull()
     _CMCActuatorSubsystem = NULL;
     _model             = NULL;
     _integrator        = NULL;
+    _reuseEvaluations  = false;
 }
 
 //_____________________________________________________________________________
@@ -234,6 +237,22 @@ getCMCActSubsys()
     return(_CMCActuatorSubsystem);
 }
 
+//-----------------------------------------------------------------------------
+// REUSE OF EVALUATIONS
+//-----------------------------------------------------------------------------
+//_____________________________________________________________________________
+/**
+ * Set whether evaluate() reuses results stored for the same controls.
+ *
+ * @param aTrueFalse If true, store evaluations and reuse them.
+ */
+void VectorFunctionForActuators::
+setReuseEvaluations(bool aTrueFalse)
+{
+    _reuseEvaluations = aTrueFalse;
+    _evaluations.clear();
+}
+
 
 
 //=============================================================================
@@ -255,6 +274,20 @@ evaluate(const SimTK::State& s, const double *aX, double *rF)
     CMC& controller=  dynamic_cast<CMC&>(_model->updControllerSet().get("CMC" ));
     controller.updControlSet().setControlValues(_tf, aX);
 
+    // The root solver re-evaluates controls it has already tried (e.g., the
+    // bounds, and the final iterate once all roots have converged). A stored
+    // evaluation leaves the controls and the actuator states as integrating
+    // again would.
+    if(_reuseEvaluations) {
+        for(const Evaluation& e : _evaluations) {
+            if(e.ti != _ti || e.tf != _tf ||
+                    !std::equal(aX, aX + N, &e.x[0])) continue;
+            for(i=0;i<N;i++) rF[i] = e.actuation[i] - _f[i];
+            getCMCActSubsys()->rep->_completeState.updZ() = e.z;
+            return;
+        }
+    }
+
     // create a Manager that will integrate just the actuator subsystem and use only the 
     // CMC controller
     SimTK::State& actSysState = _CMCActuatorSystem->updDefaultState();
@@ -275,6 +308,16 @@ evaluate(const SimTK::State& s, const double *aX, double *rF)
         j++;
     }
 
+    if(_reuseEvaluations) {
+        Evaluation e;
+        e.ti = _ti;
+        e.tf = _tf;
+        e.x = SimTK::Vector(N, aX);
+        e.actuation.resize(N);
+        for(i=0;i<N;i++) e.actuation[i] = rF[i] + _f[i];
+        e.z = getCMCActSubsys()->getCompleteState().getZ();
+        _evaluations.push_back(e);
+    }
 
 }
 //_____________________________________________________________________________
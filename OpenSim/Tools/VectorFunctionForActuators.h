@@ -29,6 +29,7 @@
 
 #include <OpenSim/Common/Array.h>
 #include <OpenSim/Common/VectorFunctionUncoupledNxN.h>
+#include <vector>
 
 namespace SimTK {
 class Integrator;
@@ -79,6 +80,19 @@ protected:
     SimTK::Integrator* _integrator;
     /** Model */
     Model* _model;
+    /** Flag indicating whether evaluate() reuses earlier results. */
+    bool _reuseEvaluations;
+    /** A stored evaluation: the controls, the resulting actuator forces and
+    the actuator states at the final time. */
+    struct Evaluation {
+        double ti;
+        double tf;
+        SimTK::Vector x;
+        SimTK::Vector actuation;
+        SimTK::Vector z;
+    };
+    /** Evaluations stored since reuse was enabled. */
+    std::vector<Evaluation> _evaluations;
 
 
 //=============================================================================
@@ -114,6 +128,14 @@ public:
     void setTargetForces(const double *aF);
     void getTargetForces(double *rF) const;
     CMCActuatorSubsystem* getCMCActSubsys();
+    /** While enabled, evaluate() returns the stored result when it is called
+    again with the same controls, initial time and final time instead of
+    integrating the actuator system again. The stored results also depend on
+    the initial actuator states, the complete state and the coordinate
+    corrections, so enable reuse only around a sequence of evaluations that
+    shares them, such as the bounds and root solve of one CMC time step.
+    Enabling or disabling reuse clears the stored results. */
+    void setReuseEvaluations(bool aTrueFalse);
 
     
     //--------------------------------------------------------------------------
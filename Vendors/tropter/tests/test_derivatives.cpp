@@ -873,4 +873,125 @@ TEST_CASE("ProblemDecorator sparsity_detection") {
     SparsityDetectionProblem<adouble>::run_test();
 }
 
+template <typename T>
+class MeshPointTaping : public tropter::Problem<T> {
+public:
+    MeshPointTaping() {
+        this->set_time({0}, {0.5, 2});
+        this->add_state("x", {-2, 2});
+        this->add_state("v", {-2, 2});
+        this->add_control("F", {-1, 1});
+        this->add_adjunct("a", {-1, 1});
+        this->add_parameter("k", {0.5, 2});
+        this->add_path_constraint("power", {-1, 1});
+        this->add_cost("effort", 1);
+    }
+    void calc_differential_algebraic_equations(const tropter::Input<T>& in,
+            tropter::Output<T> out) const override {
+        const auto& x = in.states[0];
+        const auto& v = in.states[1];
+        const auto& F = in.controls[0];
+        const auto& k = in.parameters[0];
+        // The first mesh point takes a different branch than the others, so
+        // the sparsity pattern of the mesh point tape differs across mesh
+        // points.
+        if (in.time < 0.05) out.dynamics[0] = v;
+        else out.dynamics[0] = v + 0.1 * F;
+        out.dynamics[1] = F - k * sin(x) * in.time - in.adjuncts[0] * v * v;
+        out.path[0] = F * v - in.adjuncts[0] * in.time;
+    }
+    void calc_cost_integrand(int, const tropter::Input<T>& in,
+            T& integrand) const override {
+        integrand = in.controls[0] * in.controls[0] * in.states[0];
+    }
+    void calc_cost(int, const tropter::CostInput<T>& in,
+            T& cost) const override {
+        // The square of the integral couples all mesh points in the Hessian.
+        cost = in.integral * in.integral +
+               in.final_time * in.final_states[1] * in.parameters[0];
+    }
+};
+
+TEST_CASE("Trapezoidal mesh point ADOL-C tapes") {
+    // The derivatives from the mesh point tapes must match the derivatives
+    // from the tapes of the entire NLP.
+    auto ocp = std::make_shared<MeshPointTaping<adouble>>();
+    // Use a nonuniform mesh to test the interval weights.
+    const std::vector<double> mesh{0, 0.1, 0.35, 0.6, 1.0};
+    tropter::DirectCollocationSolver<adouble> dircol_nlp(ocp, "trapezoidal",
+            "ipopt", mesh);
+    tropter::DirectCollocationSolver<adouble> dircol_mesh_point(ocp,
+            "trapezoidal", "ipopt", mesh);
+    REQUIRE(dircol_mesh_point.get_adolc_taping_mode() == "nlp");
+    REQUIRE_THROWS(dircol_mesh_point.set_adolc_taping_mode("invalid"));
+    dircol_mesh_point.set_adolc_taping_mode("mesh_point");
+    {
+        tropter::DirectCollocationSolver<adouble> dircol_hs(ocp,
+                "hermite-simpson", "ipopt", mesh);
+        REQUIRE_THROWS_WITH(dircol_hs.set_adolc_taping_mode("mesh_point"),
+                Catch::Contains("only supported by the trapezoidal"));
+    }
+
+    const auto& nlp = dircol_nlp.get_transcription();
+    const auto decorator_nlp = nlp.make_decorator();
+    const auto decorator_mesh_point =
+            dircol_mesh_point.get_transcription().make_decorator();
+    const unsigned num_variables = nlp.get_num_variables();
+    const unsigned num_constraints = nlp.get_num_constraints();
+    const VectorXd x = decorator_nlp->make_random_iterate_within_bounds();
+    const VectorXd lambda = VectorXd::Random(num_constraints);
+    const double obj_factor = 0.7;
+
+    auto calc_dense_derivatives = [&](const ProblemDecorator& decorator,
+            double& obj, VectorXd& constr, VectorXd& grad, MatrixXd& jac,
+            MatrixXd& hes) {
+        SparsityCoordinates jac_sparsity, hes_sparsity;
+        decorator.calc_sparsity(x, jac_sparsity, true, hes_sparsity);
+        decorator.calc_objective(num_variables, x.data(), true, obj);
+        constr.resize(num_constraints);
+        decorator.calc_constraints(num_variables, x.data(), true,
+                num_constraints, constr.data());
+        grad.resize(num_variables);
+        decorator.calc_gradient(num_variables, x.data(), true, grad.data());
+
+        const unsigned num_jac_nonzeros = (unsigned)jac_sparsity.row.size();
+        VectorXd jac_values(num_jac_nonzeros);
+        decorator.calc_jacobian(num_variables, x.data(), true,
+                num_jac_nonzeros, jac_values.data());
+        jac = MatrixXd::Zero(num_constraints, num_variables);
+        for (unsigned inz = 0; inz < num_jac_nonzeros; ++inz) {
+            jac(jac_sparsity.row[inz], jac_sparsity.col[inz]) +=
+                    jac_values[inz];
+        }
+
+        const unsigned num_hes_nonzeros = (unsigned)hes_sparsity.row.size();
+        VectorXd hes_values(num_hes_nonzeros);
+        decorator.calc_hessian_lagrangian(num_variables, x.data(), true,
+                obj_factor, num_constraints, lambda.data(), true,
+                num_hes_nonzeros, hes_values.data());
+        hes = MatrixXd::Zero(num_variables, num_variables);
+        for (unsigned inz = 0; inz < num_hes_nonzeros; ++inz) {
+            const auto& irow = hes_sparsity.row[inz];
+            const auto& icol = hes_sparsity.col[inz];
+            hes(irow, icol) += hes_values[inz];
+            if (irow != icol) hes(icol, irow) += hes_values[inz];
+        }
+    };
+
+    double obj_nlp, obj_mesh_point;
+    VectorXd constr_nlp, constr_mesh_point, grad_nlp, grad_mesh_point;
+    MatrixXd jac_nlp, jac_mesh_point, hes_nlp, hes_mesh_point;
+    calc_dense_derivatives(*decorator_nlp,
+            obj_nlp, constr_nlp, grad_nlp, jac_nlp, hes_nlp);
+    calc_dense_derivatives(*decorator_mesh_point, obj_mesh_point,
+            constr_mesh_point, grad_mesh_point, jac_mesh_point,
+            hes_mesh_point);
+
+    CHECK(obj_mesh_point == Approx(obj_nlp));
+    TROPTER_REQUIRE_EIGEN_ABS(constr_mesh_point, constr_nlp, 1e-12);
+    TROPTER_REQUIRE_EIGEN_ABS(grad_mesh_point, grad_nlp, 1e-12);
+    TROPTER_REQUIRE_EIGEN_ABS(jac_mesh_point, jac_nlp, 1e-12);
+    TROPTER_REQUIRE_EIGEN_ABS(hes_mesh_point, hes_nlp, 1e-12);
+}
+
 // TODO add test_derivatives_optimal_control
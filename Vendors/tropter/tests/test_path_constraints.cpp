@@ -85,9 +85,11 @@ public:
 
         return sol;
     }
-    static void run_test(int N, std::string solver, std::string transcription) {
+    static void run_test(int N, std::string solver, std::string transcription,
+            std::string adolc_taping_mode = "nlp") {
         auto ocp = std::make_shared<SlidingMassPathConstraint<T>>();
         DirectCollocationSolver<adouble> dircol(ocp, transcription, solver, N - 1);
+        dircol.set_adolc_taping_mode(adolc_taping_mode);
         Solution solution = dircol.solve();
         solution.write("sliding_mass_minimum_time_path_constraints_"
             + transcription + "_solution.csv");
@@ -105,6 +107,10 @@ TEST_CASE("Sliding mass minimum time using path constraints", "[path]")
         SlidingMassPathConstraint<adouble>::run_test(100, "ipopt", 
             "trapezoidal");
     }
+    SECTION("trapezoidal, mesh point tapes") {
+        SlidingMassPathConstraint<adouble>::run_test(100, "ipopt",
+            "trapezoidal", "mesh_point");
+    }
     // TODO this fails since controls are zero at midpoints due to implicit
     // dynamic formulation.
     //SECTION("hermite-simpson") {
@@ -92,6 +92,18 @@ public:
     std::string get_exact_hessian_block_sparsity_mode() const
     { return m_exact_hessian_block_sparsity_mode; }
 
+    /// "nlp" to record the entire NLP into single ADOL-C tapes (default),
+    /// "mesh_point" to record the optimal control problem at a single mesh
+    /// point and evaluate that tape at every mesh point. Only has an effect
+    /// if the scalar type is adouble, and only the trapezoidal transcription
+    /// supports "mesh_point". This setting is copied into the underlying
+    /// transcription scheme.
+    /// @see transcription::Base::set_adolc_taping_mode()
+    void set_adolc_taping_mode(std::string mode);
+    /// @copydoc set_adolc_taping_mode()
+    std::string get_adolc_taping_mode() const
+    { return m_adolc_taping_mode; }
+
     /// If using a Hermite-Simpson collocation scheme, enable this setting to 
     /// contrain control values at mesh interval midpoints by linearly
     /// interpolating the values at the mesh interval endpoints. Default: true.
@@ -144,6 +156,7 @@ private:
 
     int m_verbosity = 1;
     std::string m_exact_hessian_block_sparsity_mode{"dense"};
+    std::string m_adolc_taping_mode{"nlp"};
     bool m_interpolate_control_midpoints = true;
 };
 
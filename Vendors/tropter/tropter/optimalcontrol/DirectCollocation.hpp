@@ -87,6 +87,19 @@ void DirectCollocationSolver<T>::set_exact_hessian_block_sparsity_mode(
     m_exact_hessian_block_sparsity_mode = mode;
 }
 
+template<typename T>
+void DirectCollocationSolver<T>::set_adolc_taping_mode(std::string mode) {
+    TROPTER_VALUECHECK(mode == "nlp" || mode == "mesh_point",
+        "ADOL-C taping mode", mode, "nlp or mesh_point");
+    TROPTER_THROW_IF(mode == "mesh_point" &&
+            !dynamic_cast<transcription::Trapezoidal<T>*>(
+                    m_transcription.get()),
+            "The mesh_point ADOL-C taping mode is only supported by the "
+            "trapezoidal transcription.");
+    m_transcription->set_adolc_taping_mode(mode);
+    m_adolc_taping_mode = mode;
+}
+
 template<typename T>
 void DirectCollocationSolver<T>::set_interpolate_control_midpoints(bool tf) {
     m_interpolate_control_midpoints = tf;
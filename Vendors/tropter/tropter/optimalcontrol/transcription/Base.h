@@ -96,8 +96,30 @@ public:
     std::string get_exact_hessian_block_sparsity_mode () const
     {   return m_exact_hessian_block_sparsity_mode; }
 
+    /// How should ADOL-C record the optimal control problem? This setting
+    /// only has an effect if the scalar type is adouble.
+    ///        "nlp": The entire NLP objective, constraints, and Lagrangian are
+    ///               recorded into single tapes (default).
+    /// "mesh_point": The differential-algebraic equations and path
+    ///               constraints are recorded at a single mesh point, and
+    ///               this tape is evaluated at every mesh point to assemble
+    ///               the constraint Jacobian and the Hessian of the
+    ///               Lagrangian. The tape sizes do not grow with the number
+    ///               of mesh points. The optimal control problem must not
+    ///               branch on Input::time_index. Only the trapezoidal
+    ///               transcription supports this mode.
+    void set_adolc_taping_mode(std::string mode) {
+        TROPTER_VALUECHECK(mode == "nlp" || mode == "mesh_point",
+            "ADOL-C taping mode", mode, "nlp or mesh_point");
+        m_adolc_taping_mode = mode;
+    }
+    /// @copydoc set_adolc_taping_mode()
+    std::string get_adolc_taping_mode() const
+    {   return m_adolc_taping_mode; }
+
 private:
     std::string m_exact_hessian_block_sparsity_mode{"dense"};
+    std::string m_adolc_taping_mode{"nlp"};
 
 };
 
@@ -0,0 +1,656 @@
+// ----------------------------------------------------------------------------
+// tropter: MeshPointDecorator_adouble.cpp
+// ----------------------------------------------------------------------------
+// Copyright (c) 2017 tropter authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may
+// not use this file except in compliance with the License. You may obtain a
+// copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------------------------------------------------------
+#include "MeshPointDecorator_adouble.h"
+#include <tropter/SparsityPattern.h>
+#include <tropter/Exception.hpp>
+
+#include <algorithm>
+#include <cstdlib>
+#include <map>
+#include <set>
+
+#ifdef _MSC_VER
+// Ignore warnings from ADOL-C headers.
+    #pragma warning(push)
+    // 'argument': conversion from 'size_t' to 'locint', possible loss of data.
+    #pragma warning(disable: 4267)
+#endif
+#include <adolc/adolc.h>
+#include <adolc/sparse/sparsedrivers.h>
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+
+namespace tropter {
+namespace transcription {
+
+template <>
+std::unique_ptr<optimization::ProblemDecorator>
+Trapezoidal<adouble>::make_decorator() const {
+    if (this->get_adolc_taping_mode() == "mesh_point") {
+        return std::unique_ptr<MeshPointDecorator>(
+                new MeshPointDecorator(*this));
+    }
+    return optimization::Problem<adouble>::make_decorator();
+}
+
+Trapezoidal<adouble>::MeshPointDecorator::MeshPointDecorator(
+        const Trapezoidal<adouble>& trapezoidal) :
+        optimization::Problem<adouble>::Decorator(trapezoidal),
+        m_trap(trapezoidal) {
+    m_num_point_variables =
+            m_trap.m_num_dense_variables + m_trap.m_num_continuous_variables;
+    m_num_point_outputs = m_trap.m_num_states + m_trap.m_num_path_constraints;
+    m_point_variables.resize(m_num_point_variables);
+    // The normalized time followed by the multipliers.
+    m_point_parameters = Eigen::VectorXd::Ones(1 + m_num_point_outputs);
+}
+
+Trapezoidal<adouble>::MeshPointDecorator::~MeshPointDecorator() {
+    if (m_objective_hessian_row_indices) {
+        delete [] m_objective_hessian_row_indices;
+        m_objective_hessian_row_indices = nullptr;
+    }
+    if (m_objective_hessian_col_indices) {
+        delete [] m_objective_hessian_col_indices;
+        m_objective_hessian_col_indices = nullptr;
+    }
+    if (m_objective_hessian_values) {
+        delete [] m_objective_hessian_values;
+        m_objective_hessian_values = nullptr;
+    }
+    if (m_point_jacobian_work) {
+        myfree2(m_point_jacobian_work);
+        m_point_jacobian_work = nullptr;
+    }
+    if (m_point_hessian_work) {
+        myfree2(m_point_hessian_work);
+        m_point_hessian_work = nullptr;
+    }
+}
+
+void Trapezoidal<adouble>::MeshPointDecorator::
+calc_sparsity(const Eigen::VectorXd& x,
+        SparsityCoordinates& jacobian_sparsity,
+        bool provide_hessian_sparsity,
+        SparsityCoordinates& hessian_sparsity) const
+{
+    const auto& num_variables = get_num_variables();
+    assert(x.size() == num_variables);
+    const int num_dense_vars = m_trap.m_num_dense_variables;
+    const int num_point_vars = m_trap.m_num_continuous_variables;
+    const int num_states = m_trap.m_num_states;
+    const int num_path_constraints = m_trap.m_num_path_constraints;
+    const int num_mesh_points = m_trap.m_num_mesh_points;
+
+    // This function also creates the ADOL-C tapes that are used in the other
+    // function calls.
+
+    // Objective.
+    // ----------
+    {
+        double obj_value; // We don't actually need the obj. value.
+        trace_objective(m_objective_tag, num_variables, x.data(), obj_value);
+    }
+
+    m_point_values.resize(m_num_point_outputs, num_mesh_points);
+    m_point_jacobians.assign(num_mesh_points,
+            Eigen::MatrixXd(m_num_point_outputs, m_num_point_variables));
+    if (m_num_point_outputs && !m_point_jacobian_work) {
+        m_point_jacobian_work = myalloc2(m_num_point_outputs,
+                m_num_point_variables);
+        m_point_hessian_work = myalloc2(m_num_point_variables,
+                m_num_point_variables);
+    }
+
+    // Jacobian.
+    // ---------
+    // The defects of mesh interval i depend on mesh points i and i + 1, and
+    // the path constraints at mesh point i depend only on mesh point i, so
+    // the sparsity of the Jacobian of the mesh point function repeats for
+    // each mesh interval. The problem may take different branches at
+    // different mesh points, so we record the tape at every mesh point and
+    // take the union of the patterns.
+    std::vector<std::set<int>> pattern(m_num_point_outputs);
+    for (int istate = 0; istate < num_states; ++istate) {
+        // The step size depends on initial_time and final_time.
+        pattern[istate] = {0, 1, num_dense_vars + istate};
+    }
+    for (int imesh = 0; m_num_point_outputs && imesh < num_mesh_points;
+            ++imesh) {
+        gather_point_variables(x.data(), imesh);
+        trace_point_constraints(imesh);
+        const auto point_pattern = calc_point_jacobian_pattern();
+        for (int irow = 0; irow < m_num_point_outputs; ++irow) {
+            pattern[irow].insert(
+                    point_pattern[irow].begin(), point_pattern[irow].end());
+        }
+    }
+    m_point_pattern.resize(m_num_point_outputs);
+    for (int irow = 0; irow < m_num_point_outputs; ++irow) {
+        m_point_pattern[irow].assign(pattern[irow].begin(),
+                pattern[irow].end());
+    }
+
+    auto split_row = [&](int irow, std::vector<int>& dense_cols,
+            std::vector<int>& point_cols) {
+        dense_cols.clear();
+        point_cols.clear();
+        for (const int icol : m_point_pattern[irow]) {
+            if (icol < num_dense_vars) dense_cols.push_back(icol);
+            else point_cols.push_back(icol - num_dense_vars);
+        }
+    };
+    m_defect_dense_cols.resize(num_states);
+    m_defect_point_cols.resize(num_states);
+    m_path_dense_cols.resize(num_path_constraints);
+    m_path_point_cols.resize(num_path_constraints);
+    for (int istate = 0; istate < num_states; ++istate) {
+        split_row(istate, m_defect_dense_cols[istate],
+                m_defect_point_cols[istate]);
+    }
+    for (int ipc = 0; ipc < num_path_constraints; ++ipc) {
+        split_row(num_states + ipc, m_path_dense_cols[ipc],
+                m_path_point_cols[ipc]);
+    }
+
+    jacobian_sparsity.row.clear();
+    jacobian_sparsity.col.clear();
+    auto add_jacobian_nonzero = [&](int irow, int icol) {
+        jacobian_sparsity.row.push_back(irow);
+        jacobian_sparsity.col.push_back(icol);
+    };
+    for (int imesh = 0; imesh < m_trap.m_num_defects; ++imesh) {
+        for (int istate = 0; istate < num_states; ++istate) {
+            const int irow = imesh * num_states + istate;
+            for (const auto& icol : m_defect_dense_cols[istate]) {
+                add_jacobian_nonzero(irow, icol);
+            }
+            for (const int ipoint : {imesh, imesh + 1}) {
+                const int offset = num_dense_vars + ipoint * num_point_vars;
+                for (const auto& icol : m_defect_point_cols[istate]) {
+                    add_jacobian_nonzero(irow, offset + icol);
+                }
+            }
+        }
+    }
+    for (int imesh = 0; imesh < num_mesh_points; ++imesh) {
+        const int offset = num_dense_vars + imesh * num_point_vars;
+        for (int ipc = 0; ipc < num_path_constraints; ++ipc) {
+            const int irow = m_trap.m_num_dynamics_constraints +
+                             imesh * num_path_constraints + ipc;
+            for (const auto& icol : m_path_dense_cols[ipc]) {
+                add_jacobian_nonzero(irow, icol);
+            }
+            for (const auto& icol : m_path_point_cols[ipc]) {
+                add_jacobian_nonzero(irow, offset + icol);
+            }
+        }
+    }
+
+    // Lagrangian.
+    // -----------
+    TROPTER_THROW_IF(m_trap.get_use_supplied_sparsity_hessian_lagrangian(),
+            "Cannot use supplied sparsity pattern for "
+            "Hessian of Lagrangian when using automatic differentiation.");
+    if (provide_hessian_sparsity) {
+        // The Hessian of the constraints has dense rows for the time
+        // variables and parameters, and a dense block on the diagonal for
+        // each mesh point. The order of these nonzeros must match
+        // get_hessian_index().
+        hessian_sparsity.row.clear();
+        hessian_sparsity.col.clear();
+        for (int irow = 0; irow < num_dense_vars; ++irow) {
+            for (int icol = irow; icol < (int)num_variables; ++icol) {
+                hessian_sparsity.row.push_back(irow);
+                hessian_sparsity.col.push_back(icol);
+            }
+        }
+        for (int imesh = 0; imesh < num_mesh_points; ++imesh) {
+            const int offset = num_dense_vars + imesh * num_point_vars;
+            for (int irow = 0; irow < num_point_vars; ++irow) {
+                for (int icol = irow; icol < num_point_vars; ++icol) {
+                    hessian_sparsity.row.push_back(offset + irow);
+                    hessian_sparsity.col.push_back(offset + icol);
+                }
+            }
+        }
+
+        if (m_num_point_outputs) {
+            gather_point_variables(x.data(), 0);
+            trace_point_lagrangian(0);
+        }
+
+        // The objective may couple mesh points (e.g., if a cost is nonlinear
+        // in its integral), so we append any nonzeros of the Hessian of the
+        // objective that are outside the pattern above.
+        if (m_objective_hessian_row_indices) {
+            delete [] m_objective_hessian_row_indices;
+            m_objective_hessian_row_indices = nullptr;
+        }
+        if (m_objective_hessian_col_indices) {
+            delete [] m_objective_hessian_col_indices;
+            m_objective_hessian_col_indices = nullptr;
+        }
+        if (m_objective_hessian_values) {
+            delete [] m_objective_hessian_values;
+            m_objective_hessian_values = nullptr;
+        }
+        int repeated_call = 0; // No previous call, need to create tape.
+        // Same options as Problem<adouble>::Decorator (safe mode, indirect
+        // recovery).
+        int options[2] = {0, 0};
+        int status = ::sparse_hess(m_objective_tag, num_variables,
+                repeated_call, x.data(), &m_objective_hessian_num_nonzeros,
+                &m_objective_hessian_row_indices,
+                &m_objective_hessian_col_indices,
+                &m_objective_hessian_values, options);
+        assert(status >= 0);
+        m_objective_hessian_indices.resize(m_objective_hessian_num_nonzeros);
+        std::map<std::pair<int, int>, int> coupling_indices;
+        for (int inz = 0; inz < m_objective_hessian_num_nonzeros; ++inz) {
+            const int irow = std::min(m_objective_hessian_row_indices[inz],
+                    m_objective_hessian_col_indices[inz]);
+            const int icol = std::max(m_objective_hessian_row_indices[inz],
+                    m_objective_hessian_col_indices[inz]);
+            if (irow < num_dense_vars ||
+                    (irow - num_dense_vars) / num_point_vars ==
+                    (icol - num_dense_vars) / num_point_vars) {
+                m_objective_hessian_indices[inz] =
+                        get_hessian_index(irow, icol);
+            } else {
+                const auto key = std::make_pair(irow, icol);
+                if (coupling_indices.count(key) == 0) {
+                    coupling_indices[key] = (int)hessian_sparsity.row.size();
+                    hessian_sparsity.row.push_back(irow);
+                    hessian_sparsity.col.push_back(icol);
+                }
+                m_objective_hessian_indices[inz] = coupling_indices[key];
+            }
+        }
+    }
+}
+
+void Trapezoidal<adouble>::MeshPointDecorator::
+calc_constraints(unsigned /*num_variables*/, const double* x,
+        bool /*new_x*/,
+        unsigned /*num_constraints*/, double* constr) const
+{
+    const int num_dense_vars = m_trap.m_num_dense_variables;
+    const int num_point_vars = m_trap.m_num_continuous_variables;
+    const int num_states = m_trap.m_num_states;
+    const int num_path_constraints = m_trap.m_num_path_constraints;
+    for (int imesh = 0; imesh < m_trap.m_num_mesh_points; ++imesh) {
+        calc_point_constraints(x, imesh, false);
+    }
+
+    const double duration = x[1] - x[0];
+    for (int imesh = 0; imesh < m_trap.m_num_defects; ++imesh) {
+        const double h = duration * m_trap.m_mesh_intervals[imesh];
+        const double* x_im1 = x + num_dense_vars + imesh * num_point_vars;
+        const double* x_i = x_im1 + num_point_vars;
+        for (int istate = 0; istate < num_states; ++istate) {
+            const double f = 0.5 * (m_point_values(istate, imesh + 1) +
+                                    m_point_values(istate, imesh));
+            constr[imesh * num_states + istate] =
+                    x_i[istate] - (x_im1[istate] + h * f);
+        }
+    }
+    for (int imesh = 0; imesh < m_trap.m_num_mesh_points; ++imesh) {
+        for (int ipc = 0; ipc < num_path_constraints; ++ipc) {
+            constr[m_trap.m_num_dynamics_constraints +
+                   imesh * num_path_constraints + ipc] =
+                    m_point_values(num_states + ipc, imesh);
+        }
+    }
+}
+
+void Trapezoidal<adouble>::MeshPointDecorator::
+calc_jacobian(unsigned /*num_variables*/, const double* x, bool /*new_x*/,
+        unsigned num_nonzeros, double* jacobian_values) const
+{
+    const int num_dense_vars = m_trap.m_num_dense_variables;
+    const int num_states = m_trap.m_num_states;
+    const int num_path_constraints = m_trap.m_num_path_constraints;
+    for (int imesh = 0; imesh < m_trap.m_num_mesh_points; ++imesh) {
+        calc_point_constraints(x, imesh, true);
+    }
+
+    // The order of the nonzeros must match calc_sparsity().
+    // defect_i = x_i - x_{i-1} - 0.5 * h_i * (xdot_{i-1} + xdot_i),
+    // with h_i = (final_time - initial_time) * dtau_i.
+    const double duration = x[1] - x[0];
+    unsigned inz = 0;
+    for (int imesh = 0; imesh < m_trap.m_num_defects; ++imesh) {
+        const double half_interval = 0.5 * m_trap.m_mesh_intervals[imesh];
+        const double half_h = duration * half_interval;
+        const auto& jac_im1 = m_point_jacobians[imesh];
+        const auto& jac_i = m_point_jacobians[imesh + 1];
+        for (int istate = 0; istate < num_states; ++istate) {
+            const double xdot_sum = m_point_values(istate, imesh) +
+                                    m_point_values(istate, imesh + 1);
+            for (const auto& icol : m_defect_dense_cols[istate]) {
+                double value = -half_h *
+                        (jac_im1(istate, icol) + jac_i(istate, icol));
+                // The duration is final_time - initial_time.
+                if (icol == 0) value += half_interval * xdot_sum;
+                else if (icol == 1) value -= half_interval * xdot_sum;
+                jacobian_values[inz++] = value;
+            }
+            for (const auto& icol : m_defect_point_cols[istate]) {
+                jacobian_values[inz++] =
+                        -half_h * jac_im1(istate, num_dense_vars + icol) -
+                        (icol == istate ? 1.0 : 0.0);
+            }
+            for (const auto& icol : m_defect_point_cols[istate]) {
+                jacobian_values[inz++] =
+                        -half_h * jac_i(istate, num_dense_vars + icol) +
+                        (icol == istate ? 1.0 : 0.0);
+            }
+        }
+    }
+    for (int imesh = 0; imesh < m_trap.m_num_mesh_points; ++imesh) {
+        const auto& jac = m_point_jacobians[imesh];
+        for (int ipc = 0; ipc < num_path_constraints; ++ipc) {
+            const int irow = num_states + ipc;
+            for (const auto& icol : m_path_dense_cols[ipc]) {
+                jacobian_values[inz++] = jac(irow, icol);
+            }
+            for (const auto& icol : m_path_point_cols[ipc]) {
+                jacobian_values[inz++] = jac(irow, num_dense_vars + icol);
+            }
+        }
+    }
+    assert(inz == num_nonzeros);
+}
+
+void Trapezoidal<adouble>::MeshPointDecorator::
+calc_hessian_lagrangian(unsigned num_variables, const double* x,
+        bool /*new_x*/, double obj_factor,
+        unsigned /*num_constraints*/, const double* lambda,
+        bool /*new_lambda*/,
+        unsigned num_nonzeros, double* hessian_values) const
+{
+    const int num_dense_vars = m_trap.m_num_dense_variables;
+    const int num_point_vars = m_trap.m_num_continuous_variables;
+    const int num_states = m_trap.m_num_states;
+    const int num_path_constraints = m_trap.m_num_path_constraints;
+    std::fill(hessian_values, hessian_values + num_nonzeros, 0.0);
+
+    // Objective.
+    // ----------
+    {
+        int repeated_call = 1;
+        int options[2] = {0, 0};
+        int status = ::sparse_hess(m_objective_tag, num_variables,
+                repeated_call, x, &m_objective_hessian_num_nonzeros,
+                &m_objective_hessian_row_indices,
+                &m_objective_hessian_col_indices,
+                &m_objective_hessian_values, options);
+        assert(status >= 0);
+        for (int inz = 0; inz < m_objective_hessian_num_nonzeros; ++inz) {
+            hessian_values[m_objective_hessian_indices[inz]] +=
+                    obj_factor * m_objective_hessian_values[inz];
+        }
+    }
+
+    // Constraints.
+    // ------------
+    // The state derivatives at mesh point i appear in the defects of mesh
+    // intervals i - 1 and i, so their multipliers are combined, weighted by
+    // the (normalized) duration of each interval. The tape includes the
+    // factor -0.5 * duration.
+    if (!m_num_point_outputs) return;
+    for (int imesh = 0; imesh < m_trap.m_num_mesh_points; ++imesh) {
+        gather_point_variables(x, imesh);
+        m_point_parameters[0] = m_trap.m_mesh[imesh];
+        for (int istate = 0; istate < num_states; ++istate) {
+            double multiplier = 0;
+            if (imesh > 0) {
+                multiplier += m_trap.m_mesh_intervals[imesh - 1] *
+                        lambda[(imesh - 1) * num_states + istate];
+            }
+            if (imesh < m_trap.m_num_defects) {
+                multiplier += m_trap.m_mesh_intervals[imesh] *
+                        lambda[imesh * num_states + istate];
+            }
+            m_point_parameters[1 + istate] = multiplier;
+        }
+        for (int ipc = 0; ipc < num_path_constraints; ++ipc) {
+            m_point_parameters[1 + num_states + ipc] =
+                    lambda[m_trap.m_num_dynamics_constraints +
+                           imesh * num_path_constraints + ipc];
+        }
+        set_param_vec(m_point_lagrangian_tag, (int)m_point_parameters.size(),
+                m_point_parameters.data());
+        int status = ::hessian(m_point_lagrangian_tag, m_num_point_variables,
+                m_point_variables.data(), m_point_hessian_work);
+        if (status < 0) {
+            // The control flow differs from that on the tape.
+            trace_point_lagrangian(imesh);
+            status = ::hessian(m_point_lagrangian_tag, m_num_point_variables,
+                    m_point_variables.data(), m_point_hessian_work);
+        }
+        assert(status >= 0);
+
+        // ADOL-C provides the lower triangle of the Hessian.
+        const int offset = num_dense_vars + imesh * num_point_vars;
+        auto get_global_index = [&](int ilocal) {
+            return ilocal < num_dense_vars ? ilocal
+                                           : offset + ilocal - num_dense_vars;
+        };
+        for (int irow = 0; irow < m_num_point_variables; ++irow) {
+            const int iglobalrow = get_global_index(irow);
+            for (int icol = 0; icol <= irow; ++icol) {
+                const int iglobalcol = get_global_index(icol);
+                hessian_values[get_hessian_index(
+                        std::min(iglobalrow, iglobalcol),
+                        std::max(iglobalrow, iglobalcol))] +=
+                        m_point_hessian_work[irow][icol];
+            }
+        }
+    }
+}
+
+void Trapezoidal<adouble>::MeshPointDecorator::
+gather_point_variables(const double* x, int imesh) const {
+    const int num_dense_vars = m_trap.m_num_dense_variables;
+    const int num_point_vars = m_trap.m_num_continuous_variables;
+    const double* point = x + num_dense_vars + imesh * num_point_vars;
+    std::copy(x, x + num_dense_vars, m_point_variables.data());
+    std::copy(point, point + num_point_vars,
+            m_point_variables.data() + num_dense_vars);
+}
+
+void Trapezoidal<adouble>::MeshPointDecorator::
+calc_point_differential_algebraic_equations(int imesh,
+        adouble& duration, VectorXa& derivs, VectorXa& path) const {
+    const int num_dense_vars = m_trap.m_num_dense_variables;
+    const int num_states = m_trap.m_num_states;
+    const int num_controls = m_trap.m_num_controls;
+    VectorXa vars(m_num_point_variables);
+    for (int i = 0; i < m_num_point_variables; ++i) {
+        vars[i] <<= m_point_variables[i];
+    }
+    const adouble& initial_time = vars[0];
+    duration = vars[1] - initial_time;
+    // The normalized time is the first parameter on the tape.
+    const adouble time = duration * ::mkparam(m_trap.m_mesh[imesh]) +
+                         initial_time;
+    const VectorXa parameters = vars.segment(m_trap.m_num_time_variables,
+            m_trap.m_num_parameters);
+    const VectorXa states = vars.segment(num_dense_vars, num_states);
+    const VectorXa controls = vars.segment(num_dense_vars + num_states,
+            num_controls);
+    const VectorXa adjuncts = vars.segment(
+            num_dense_vars + num_states + num_controls,
+            m_trap.m_num_adjuncts);
+
+    derivs.resize(num_states);
+    path.resize(m_trap.m_num_path_constraints);
+    m_trap.m_ocproblem->initialize_on_iterate(parameters);
+    m_trap.m_ocproblem->calc_differential_algebraic_equations(
+            {imesh, time, states, controls, adjuncts,
+                    m_trap.m_empty_diffuse_col, parameters},
+            {derivs, path});
+}
+
+void Trapezoidal<adouble>::MeshPointDecorator::
+trace_point_constraints(int imesh) const {
+    // =========================================================================
+    // START ACTIVE
+    // -------------------------------------------------------------------------
+    trace_on(m_point_constraints_tag);
+    adouble duration;
+    VectorXa derivs;
+    VectorXa path;
+    calc_point_differential_algebraic_equations(imesh, duration, derivs, path);
+    double value; // Unused.
+    for (int i = 0; i < derivs.size(); ++i) derivs[i] >>= value;
+    for (int i = 0; i < path.size(); ++i) path[i] >>= value;
+    trace_off();
+    // -------------------------------------------------------------------------
+    // END ACTIVE
+    // =========================================================================
+}
+
+void Trapezoidal<adouble>::MeshPointDecorator::
+trace_point_lagrangian(int imesh) const {
+    const int num_states = m_trap.m_num_states;
+    // =========================================================================
+    // START ACTIVE
+    // -------------------------------------------------------------------------
+    trace_on(m_point_lagrangian_tag);
+    adouble duration;
+    VectorXa derivs;
+    VectorXa path;
+    calc_point_differential_algebraic_equations(imesh, duration, derivs, path);
+    // The multipliers are parameters on the tape, after the normalized time.
+    // The defects contain -0.5 * duration * dtau * xdot, and dtau is included
+    // in the multipliers.
+    adouble lagrangian = 0;
+    for (int i = 0; i < num_states; ++i) {
+        lagrangian += ::mkparam(m_point_parameters[1 + i]) * derivs[i];
+    }
+    lagrangian *= -0.5 * duration;
+    for (int i = 0; i < path.size(); ++i) {
+        lagrangian += ::mkparam(m_point_parameters[1 + num_states + i]) *
+                      path[i];
+    }
+    double value; // Unused.
+    lagrangian >>= value;
+    trace_off();
+    // -------------------------------------------------------------------------
+    // END ACTIVE
+    // =========================================================================
+}
+
+void Trapezoidal<adouble>::MeshPointDecorator::
+calc_point_constraints(const double* x, int imesh, bool calc_jacobian) const {
+    if (!m_num_point_outputs) return;
+    gather_point_variables(x, imesh);
+    double normalized_time = m_trap.m_mesh[imesh];
+    set_param_vec(m_point_constraints_tag, 1, &normalized_time);
+    double* values = m_point_values.col(imesh).data();
+    int status = ::function(m_point_constraints_tag, m_num_point_outputs,
+            m_num_point_variables, m_point_variables.data(), values);
+    if (status < 0) {
+        // The control flow differs from that on the tape.
+        trace_point_constraints(imesh);
+        check_point_jacobian_pattern(imesh);
+        status = ::function(m_point_constraints_tag, m_num_point_outputs,
+                m_num_point_variables, m_point_variables.data(), values);
+    }
+    assert(status >= 0);
+    if (calc_jacobian) {
+        status = ::jacobian(m_point_constraints_tag, m_num_point_outputs,
+                m_num_point_variables, m_point_variables.data(),
+                m_point_jacobian_work);
+        assert(status >= 0);
+        auto& jac = m_point_jacobians[imesh];
+        for (int irow = 0; irow < m_num_point_outputs; ++irow) {
+            for (int icol = 0; icol < m_num_point_variables; ++icol) {
+                jac(irow, icol) = m_point_jacobian_work[irow][icol];
+            }
+        }
+    }
+}
+
+std::vector<std::vector<int>> Trapezoidal<adouble>::MeshPointDecorator::
+calc_point_jacobian_pattern() const {
+    // ADOL-C allocates each row of the pattern.
+    std::vector<unsigned int*> rows(m_num_point_outputs, nullptr);
+    // [0]: Way of sparsity pattern computation (propagation of index
+    //      domains).
+    // [1]: Test the computational graph control flow (safe mode).
+    // [2]: Way of bit pattern propagation (automatic detection).
+    int options[3] = {0, 0, 0};
+    int status = ::jac_pat(m_point_constraints_tag, m_num_point_outputs,
+            m_num_point_variables, m_point_variables.data(),
+            rows.data(), options);
+    assert(status >= 0);
+    std::vector<std::vector<int>> pattern(m_num_point_outputs);
+    for (int irow = 0; irow < m_num_point_outputs; ++irow) {
+        const unsigned int* row = rows[irow];
+        for (unsigned int inz = 1; inz <= row[0]; ++inz) {
+            pattern[irow].push_back((int)row[inz]);
+        }
+        std::sort(pattern[irow].begin(), pattern[irow].end());
+        std::free(rows[irow]);
+    }
+    return pattern;
+}
+
+void Trapezoidal<adouble>::MeshPointDecorator::
+check_point_jacobian_pattern(int imesh) const {
+    // The pattern is only available after calc_sparsity().
+    if ((int)m_point_pattern.size() != m_num_point_outputs) return;
+    const auto point_pattern = calc_point_jacobian_pattern();
+    for (int irow = 0; irow < m_num_point_outputs; ++irow) {
+        TROPTER_THROW_IF(!std::includes(m_point_pattern[irow].begin(),
+                m_point_pattern[irow].end(), point_pattern[irow].begin(),
+                point_pattern[irow].end()),
+                "At mesh point %i, the control flow of the optimal control "
+                "problem changed and the Jacobian of output %i has nonzeros "
+                "outside the sparsity pattern detected in "
+                "calc_sparsity().", imesh, irow);
+    }
+}
+
+int Trapezoidal<adouble>::MeshPointDecorator::
+get_hessian_index(int irow, int icol) const {
+    // See the order of the nonzeros in calc_sparsity().
+    const int num_variables = (int)get_num_variables();
+    const int num_dense_vars = m_trap.m_num_dense_variables;
+    const int num_point_vars = m_trap.m_num_continuous_variables;
+    assert(irow <= icol);
+    if (irow < num_dense_vars) {
+        return irow * num_variables - irow * (irow - 1) / 2 + (icol - irow);
+    }
+    const int num_dense_nonzeros = num_dense_vars * num_variables -
+                                   num_dense_vars * (num_dense_vars - 1) / 2;
+    const int num_block_nonzeros = num_point_vars * (num_point_vars + 1) / 2;
+    const int imesh = (irow - num_dense_vars) / num_point_vars;
+    const int offset = num_dense_vars + imesh * num_point_vars;
+    const int iblockrow = irow - offset;
+    const int iblockcol = icol - offset;
+    return num_dense_nonzeros + imesh * num_block_nonzeros +
+           iblockrow * num_point_vars - iblockrow * (iblockrow - 1) / 2 +
+           (iblockcol - iblockrow);
+}
+
+} // namespace transcription
+} // namespace tropter
@@ -0,0 +1,150 @@
+#ifndef TROPTER_OPTIMALCONTROL_TRANSCRIPTION_MESHPOINTDECORATOR_ADOUBLE_H
+#define TROPTER_OPTIMALCONTROL_TRANSCRIPTION_MESHPOINTDECORATOR_ADOUBLE_H
+// ----------------------------------------------------------------------------
+// tropter: MeshPointDecorator_adouble.h
+// ----------------------------------------------------------------------------
+// Copyright (c) 2017 tropter authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may
+// not use this file except in compliance with the License. You may obtain a
+// copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------------------------------------------------------
+
+#include "Trapezoidal.h"
+
+namespace tropter {
+namespace transcription {
+
+/// This decorator records the differential-algebraic equations and path
+/// constraints of the optimal control problem at a single mesh point,
+/// instead of recording the entire NLP constraints and Lagrangian. The
+/// tapes are evaluated at every mesh point, and the constraint Jacobian and
+/// the Hessian of the Lagrangian are assembled from these dense blocks using
+/// the structure of the trapezoidal defects. The objective and its gradient
+/// are computed from a tape of the entire objective, as in
+/// Problem<adouble>::Decorator, since costs may be nonlinear in the integral.
+///
+/// The mesh point tapes take the following independent variables:
+/// @verbatim
+/// initial_time
+/// final_time
+/// parameters
+/// states
+/// controls
+/// adjuncts
+/// @endverbatim
+/// The normalized time of the mesh point is an ADOL-C parameter, so that a
+/// tape is valid for all mesh points. If ADOL-C reports that the control
+/// flow at a mesh point differs from the control flow on the tape, the tape
+/// is recorded again at that mesh point.
+///
+/// The sparsity pattern of the mesh point function is the union of its
+/// patterns at every mesh point of the iterate passed to calc_sparsity(),
+/// so the constraint Jacobian has the same pattern as with a tape of the
+/// entire NLP. If a tape recorded again during the solve has a nonzero
+/// outside this pattern, an exception is thrown.
+/// @ingroup optimalcontrol
+template<>
+class Trapezoidal<adouble>::MeshPointDecorator
+        : public optimization::Problem<adouble>::Decorator {
+public:
+    MeshPointDecorator(const Trapezoidal<adouble>& trapezoidal);
+    /// Delete memory allocated by ADOL-C.
+    ~MeshPointDecorator() override;
+    void calc_sparsity(const Eigen::VectorXd& variables,
+            SparsityCoordinates& jacobian,
+            bool provide_hessian_sparsity,
+            SparsityCoordinates& hessian) const override;
+    void calc_constraints(unsigned num_variables, const double* variables,
+            bool new_variables,
+            unsigned num_constraints, double* constr) const override;
+    void calc_jacobian(unsigned num_variables, const double* variables,
+            bool new_variables,
+            unsigned num_nonzeros, double* nonzeros) const override;
+    void calc_hessian_lagrangian(unsigned num_variables,
+            const double* variables, bool new_variables, double obj_factor,
+            unsigned num_constraints, const double* lambda, bool new_lambda,
+            unsigned num_nonzeros, double* nonzeros) const override;
+private:
+    /// Copy the time, parameter, and mesh point variables into
+    /// m_point_variables.
+    void gather_point_variables(const double* variables, int i_mesh) const;
+    /// Mark m_point_variables as independent variables and evaluate the
+    /// duration, derivatives, and path constraints at mesh point i_mesh. This
+    /// must be called between trace_on() and trace_off().
+    void calc_point_differential_algebraic_equations(int i_mesh,
+            adouble& duration, VectorXa& derivs, VectorXa& path) const;
+    /// Record the derivatives and path constraints at mesh point i_mesh,
+    /// using m_point_variables.
+    void trace_point_constraints(int i_mesh) const;
+    /// Compute the sparsity pattern of the Jacobian of the mesh point
+    /// constraints tape at m_point_variables. Each row contains the sorted
+    /// columns of its nonzeros.
+    std::vector<std::vector<int>> calc_point_jacobian_pattern() const;
+    /// Throw an exception if the mesh point constraints tape, recorded again
+    /// at mesh point i_mesh, has a nonzero outside m_point_pattern.
+    void check_point_jacobian_pattern(int i_mesh) const;
+    /// Record the sum of the derivatives and path constraints, weighted by
+    /// the multipliers, at mesh point i_mesh using m_point_variables.
+    void trace_point_lagrangian(int i_mesh) const;
+    /// Evaluate the derivatives and path constraints at mesh point i_mesh,
+    /// and store them in m_point_values. Optionally, also compute the
+    /// Jacobian of the mesh point function.
+    void calc_point_constraints(const double* variables, int i_mesh,
+            bool calc_jacobian) const;
+    /// Index into the Hessian nonzeros for the upper triangle element
+    /// (irow, icol) of the dense rows or diagonal blocks.
+    int get_hessian_index(int irow, int icol) const;
+
+    const Trapezoidal<adouble>& m_trap;
+
+    // The number of independent and dependent variables of the mesh point
+    // tapes.
+    int m_num_point_variables = -1;
+    int m_num_point_outputs = -1;
+
+    static const short int m_point_constraints_tag = 4;
+    static const short int m_point_lagrangian_tag  = 5;
+
+    // The sparsity pattern of each row of the Jacobian of the mesh point
+    // function (sorted columns within the mesh point variables), and the
+    // same pattern split into the dense variables and the continuous
+    // variables (0-based within the mesh point). The defect rows always
+    // depend on the time variables and on their own state.
+    mutable std::vector<std::vector<int>> m_point_pattern;
+    mutable std::vector<std::vector<int>> m_defect_dense_cols;
+    mutable std::vector<std::vector<int>> m_defect_point_cols;
+    mutable std::vector<std::vector<int>> m_path_dense_cols;
+    mutable std::vector<std::vector<int>> m_path_point_cols;
+
+    // The sparsity pattern of the Hessian of the objective, which we must
+    // pass to subsequent calls to sparse_hess(). ADOL-C allocates this
+    // memory, but we must delete it. The indices map each nonzero of the
+    // Hessian of the objective to a nonzero of the Hessian of the Lagrangian.
+    mutable int m_objective_hessian_num_nonzeros = -1;
+    mutable unsigned int* m_objective_hessian_row_indices = nullptr;
+    mutable unsigned int* m_objective_hessian_col_indices = nullptr;
+    mutable double* m_objective_hessian_values = nullptr;
+    mutable std::vector<int> m_objective_hessian_indices;
+
+    // Working memory.
+    mutable Eigen::VectorXd m_point_variables;
+    mutable Eigen::VectorXd m_point_parameters;
+    // The derivatives and path constraints at each mesh point (columns).
+    mutable Eigen::MatrixXd m_point_values;
+    // The Jacobian of the mesh point function at each mesh point.
+    mutable std::vector<Eigen::MatrixXd> m_point_jacobians;
+    mutable double** m_point_jacobian_work = nullptr;
+    mutable double** m_point_hessian_work = nullptr;
+};
+
+} // namespace transcription
+} // namespace tropter
+
+#endif // TROPTER_OPTIMALCONTROL_TRANSCRIPTION_MESHPOINTDECORATOR_ADOUBLE_H
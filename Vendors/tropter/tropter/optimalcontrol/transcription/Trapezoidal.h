@@ -80,6 +80,12 @@ public:
             SymmetricSparsityPattern&,
             SymmetricSparsityPattern&) const override;
 
+    /// If the scalar type is adouble and the ADOL-C taping mode is
+    /// "mesh_point" (see set_adolc_taping_mode()), the decorator evaluates a
+    /// single mesh point tape at every mesh point to assemble the derivatives.
+    std::unique_ptr<optimization::ProblemDecorator>
+    make_decorator() const override;
+
     /// For continuous variables, the format is
     /// `<continuous-variable-name>_<mesh-point-index>`. The mesh point index is
     /// 0-based.
@@ -177,6 +183,9 @@ protected:
     make_constraints_view(Eigen::Ref<VectorX<T>> constraints) const;
 
 private:
+    /// Computes the derivatives of the NLP from tapes of the optimal control
+    /// functions at a single mesh point. See set_adolc_taping_mode().
+    class MeshPointDecorator;
 
     std::shared_ptr<const OCProblem> m_ocproblem;
 
@@ -213,6 +222,10 @@ private:
     mutable VectorX<T> m_empty_diffuse_col;
 };
 
+template <>
+std::unique_ptr<optimization::ProblemDecorator>
+Trapezoidal<adouble>::make_decorator() const;
+
 } // namespace transcription
 } // namespace tropter
 
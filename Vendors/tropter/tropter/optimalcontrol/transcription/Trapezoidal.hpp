@@ -330,6 +330,12 @@ void Trapezoidal<T>::calc_constraints(
     }
 }
 
+template <typename T>
+std::unique_ptr<optimization::ProblemDecorator>
+Trapezoidal<T>::make_decorator() const {
+    return optimization::Problem<T>::make_decorator();
+}
+
 template <typename T>
 void Trapezoidal<T>::calc_sparsity_hessian_lagrangian(const Eigen::VectorXd& x,
         SymmetricSparsityPattern& hescon_sparsity,
@@ -69,7 +69,7 @@ public:
     /// optimization solver, but users might call this if they are interested
     /// in obtaining the sparsity pattern or derivatives for their problem.
     std::unique_ptr<ProblemDecorator> make_decorator()
-            const override final;
+            const override;
 
     // TODO can override to provide custom derivatives.
     //virtual void gradient(const std::vector<T>& x, std::vector<T>& grad) const;
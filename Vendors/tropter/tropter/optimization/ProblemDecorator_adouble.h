@@ -55,10 +55,21 @@ public:
             const double* variables, bool new_variables, double obj_factor,
             unsigned num_constraints, const double* lambda, bool new_lambda,
             unsigned num_nonzeros, double* nonzeros) const override;
-private:
+protected:
     void trace_objective(short int tag,
             unsigned num_variables, const double* variables,
             double& obj_value) const;
+
+    // ADOL-C
+    // ------
+    // TODO if we want to be able to solve multiple problems at once, these
+    // cannot be static. We could create a registry of tags, and the tags can
+    // be "checked out" and "returned."
+    static const short int m_objective_tag   = 1;
+    static const short int m_constraints_tag = 2;
+    static const short int m_lagrangian_tag  = 3;
+
+private:
     void trace_constraints(short int tag,
             unsigned num_variables, const double* variables,
             unsigned num_constraints, double* constr) const;
@@ -70,15 +81,6 @@ private:
 
     const Problem<adouble>& m_problem;
 
-    // ADOL-C
-    // ------
-    // TODO if we want to be able to solve multiple problems at once, these
-    // cannot be static. We could create a registry of tags, and the tags can
-    // be "checked out" and "returned."
-    static const short int m_objective_tag   = 1;
-    static const short int m_constraints_tag = 2;
-    static const short int m_lagrangian_tag  = 3;
-
     // We must hold onto the sparsity pattern for the Jacobian and
     // Hessian so that we can pass them to subsequent calls to sparse_jac().
     // ADOL-C allocates this memory, but we must delete it.